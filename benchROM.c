@@ -0,0 +1,1847 @@
+// benchROM - time ROMs starting on an emulated Spectrum with ZX PicoIF2Lite
+//
+// benchROM is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// benchROM is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with benchROM. If not, see <http://www.gnu.org/licenses/>.
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//v1.0 initial release
+//v1.1 -v checks converted snapshots against the snapshot itself
+//v1.2 banked 128k snapshots show when their loader first reads bank 1
+//v1.3 the ROMs given are a catalogue, a stream port ROM opens the data files after it & its bytes/s are shown
+//v1.4 tape mode runs until the tape is read, the tape window only opens when LD-BYTES asks for it
+//v1.5 refresh cycles read I<<8|R below 0x4000, -p runs each ROM until the sequencer would see it park
+//v1.6 a snapshot's time from being selected to its game, the Pico's unpacking modelled, -w as before banked unpacking
+//v1.7 a streamed launch's reply waits for the Pico to unpack every RAM bank
+
+// Runs ROMs on a Z80 with the interface served the way romServe() in
+// picoif2lite.c serves it, so a change to a ROM, a converter or the way the
+// Pico pages can be measured without a Spectrum. For each ROM it reports in
+// T states from the Spectrum leaving RESET:
+//   first int  the first maskable interrupt taken, IM1 unless marked im2.
+//              For the ROM Explorer this is its menu being up, for a ROM
+//              usually its first screen
+//   ROMCS off  the interface switching itself off, the last 0x3fff read of
+//              a snapshot's loader or a ZXC2 page out
+//   game       the jump out of the final loader into the snapshot's own code
+// and for a 128k snapshot compressed bank by bank when its loader pages to
+// bank 1, the time core 1 has to unpack banks 1-7 in. There is no WAIT line,
+// a bank that isn't ready by then is served stale & the Pico relaunches.
+// A stream port ROM (compressROM -s) is run until it has read a whole data
+// file & its size & bytes/s from the open command to the last byte are shown.
+// A tape (TAPtoROM) is run until every block has been read & a few frames
+// more, for a program it loaded to take its interrupts
+// The interface model is the unpacked ROM served from bank 0 (romData), 48k &
+// 128k snapshot paging on 0x3fff reads including the banks left out of a
+// sparse snapshot, ZXC2 paging, ROMCS released, the stream port & command
+// window for streamed launch & tape mode, and for the ROM Explorer the reply
+// navStart() leaves & the watchdog's 10 IM1 fetches in half a second. The
+// Spectrum is a 48k or 128k machine (7ffd paging & AY registers) with a frame
+// interrupt 32 T states long. Every M1 ends with a refresh cycle, which the
+// interface sees as a read of I<<8|R while I is below 0x40 as it has no RFSH
+// line, & a HALT keeps reading the byte after it. Not modelled is contended
+// memory, so real times are a little longer. The Spectrum's own ROM (-r) is only needed once ROMCS is off,
+// without one it reads as 0xff. The ROMs given, from the command line & -c in
+// that order, are the catalogue a stream port ROM opens its data files from,
+// so a data file goes after its ROM as it would in the ROM list.
+//
+// A snapshot that never releases ROMCS or never reaches its game, a ROM
+// Explorer the watchdog would reset, or a stream port ROM that opens
+// something other than a data file or doesn't read all of it, or a tape that
+// takes an interrupt with the tape window open or has anything but 0xff at
+// 0x39ff & 0x3a00 for an IM2 vector table there, is a failure & benchROM stops with E05
+// after the table so it can be run over a whole catalog by a build.
+//
+// A snapshot also shows its time from being selected to its game, what the
+// firmware reports over USB as unpack + game: what romLoad() unpacks with
+// RESET held, bank 0 only for a banked snapshot & the loader for a streamed
+// launch, resetButton()'s 100ms wait & the Z80's time to its game. The Pico's
+// unpacking isn't run, it is counted from the tokens at the cycles dtoBank()'s
+// loops take on a Cortex-M0+ at 125MHz reading the ROM through the XIP cache
+// (PICO_ below), an estimate good to 20% or so that a USB launch line can
+// correct. With -w every bank is unpacked before RESET is lifted as before
+// v0.8, to see what unpacking bank by bank saves.
+//
+// With -p each ROM is run until the sequencer in picoif2lite.c would see it
+// park, the address read sampled every ms & one range of it having 45% of the
+// samples for 3 seconds with IM1 not coming at 25 to 100 a second, and one
+// that doesn't within the frames it is given is a failure.
+//
+// With -v the files given are snapshots instead, each with the header
+// Z80toROM made next to it (game.z80 & game.h, as Z80toROM & Z80toROM -a
+// leave them). The cartridge is run until the final loader jumps into the
+// game & the registers, interrupt mode & state, 7ffd, the AY, the border &
+// every byte of RAM except the 13 bytes of the final loader are compared
+// with the snapshot, read here without any of Z80toROM's code so a mistake
+// in its parsing shows up too. IFF2 isn't compared, the loader can only set
+// it the same as IFF1. A loader runs in a few ms so thousands of snapshots
+// can be checked by a build, any that differ are listed & it stops with E05.
+//
+// usage: benchROM <options> rom.h rom.bin ...
+//        benchROM -v snapshot.z80 snapshot.sna ...
+
+#define MAXROM    (8*16384+34)  // largest ROM as stored, see mkcatalog
+#define MAXTAPE   (1<<20)       // tape mode ROMs carry their tape, allow for a long one
+#define FRAME48   69888         // T states a frame
+#define FRAME128  70908
+#define INT_LEN   32            // T states the ULA holds INT
+#define FRAMES    250           // default frames to give a ROM, 5s
+#define MAXSNAP   (147487+1)    // largest snapshot, a 128k SNA with the paged bank twice
+#define LOADER_LEN 13           // Z80toROM's final loader, jp to the game at +10
+// as picoif2lite.c
+#define poMask    0b0011111111010000
+#define lkMask    0b0011111111100000
+#define bkMask    0b0000000000001111
+#define CMD_WINDOW    0x3e00
+#define CMD_SELECT    0x01
+#define CMD_KEY       0x02
+#define CMD_PREVIEW   0x03
+#define CMD_STREAM    0x04
+#define CMD_TAPE      0x05
+#define REPLY_WINDOW  0x3f00
+#define STREAM_WINDOW 0x3d00
+#define TAPE_WINDOW   0x3900
+#define SCREEN_WINDOW 0x2300
+#define FLAG_BANKED   0x01
+#define FLAG_STREAM   0x02
+#define FLAG_LAUNCH   0x04
+#define FLAG_SPARSE   0x08
+#define SNAP_SPARSE   0x31
+#define SEQ_PARK      2         // sequencer park, as picoif2lite.c
+#define SEQ_PARK_SHARE 45
+#define SEQ_PARK_SLOTS 8
+#define SEQ_PARK_MS   3000
+#define WD_IM1_MIN    25
+#define WD_IM1_MAX    100
+#define RESET_WAIT    100.0     // ms RESET is held after unpacking, resetButton()
+#define PICO_MHZ      125.0     // RP2040 clock, the SDK's default
+#define PICO_TOKEN    14        // cycles a token takes in dtoBank(), read from flash & decoded
+#define PICO_LITERAL  11        // cycles a literal byte, read through XIP & stored
+#define PICO_COPY     8         // cycles a byte of a match, SRAM to SRAM
+#define PICO_XIP      6         // cycles a compressed byte costs streaming into the XIP cache
+
+typedef struct {
+	uint8_t a,f,b,c,d,e,h,l;
+	uint8_t a_,f_,b_,c_,d_,e_,h_,l_;	// alternate set
+	uint16_t ix,iy,sp,pc;
+	uint8_t i,r,im;
+	bool iff1,iff2,halted;
+	int eiDelay;	// interrupts stay off for the instruction after EI
+	uint64_t cycles;	// T states since RESET
+} z80_t;
+typedef struct {
+	uint64_t intT;	// first interrupt taken, 0 none
+	uint8_t intIm;	// its interrupt mode
+	uint64_t offT;	// ROMCS released, 0 never
+	uint64_t gameT;	// jump out of the final loader, 0 never
+	uint16_t gamePc;	// where it went
+	uint64_t dogT;	// ROM Explorer, 10th fetch from 0x0038
+	uint64_t menuT;	// ROM Explorer, both ends of the screen window read
+	uint64_t screenT[2];
+	int32_t selected;	// ROM Explorer, ROM picked (none are, no keys are pressed)
+	uint16_t jpAt;	// where the jump into the game was
+	uint64_t bankT[8];	// banked snapshot, loader paged to each bank, 0 never
+	uint64_t streamT;	// stream port ROM, data file opened, 0 never
+	uint64_t streamEndT;	// its last byte read, 0 never
+	uint32_t streamLen;	// its size, 0 not a data file
+	uint16_t streamArg;	// entries after the ROM
+	uint64_t tapeT;	// tape mode, last block read, 0 never
+	uint64_t openIntT;	// tape mode, interrupt taken with the tape window open, 0 never
+	uint64_t parkT;	// -p, the sequencer would see it parked, 0 never
+	uint16_t parkAt;	// where
+} bench_t;
+typedef struct {
+	char *name;	// file or catalog line
+	uint8_t *rom;	// as stored, NULL for a catalog line that isn't a header
+	uint32_t len,frames;
+	int line;	// ROM number in its catalog, -1 from the command line
+	bool isExplorer,force128;
+} entry_t;
+typedef struct {
+	z80_t z;	// registers at the snapshot's PC
+	bool is128,hasAy;	// SNA doesn't keep the AY
+	uint8_t p7ffd,ayReg,ay[16],border;
+	uint8_t ram[8][16384];
+} snap_t;
+
+void error(int errorcode);
+void catalogAdd(const char *name,const uint8_t *rom,uint32_t len,int line,bool isExplorer,bool force128,uint32_t frames);
+uint32_t readHeader(char *fname,uint8_t *to,uint32_t max);
+uint32_t readRom(char *fname,uint8_t *to,uint32_t max);
+bool romCheck(const uint8_t *from,uint32_t size);
+unsigned int romStreams(const uint8_t *from);
+double picoUnpack(const uint8_t *from,unsigned int streams);
+uint32_t romSize(const uint8_t *from);
+uint32_t dtoBank(uint8_t *to,const uint8_t *from,uint32_t j);
+const char *snapRead(char *fname,snap_t *s);
+uint32_t snapUnpack(const uint8_t *from,uint32_t len,uint8_t *to,uint32_t max);
+bool verifySnap(char *fname,bool force128);
+bool benchRom(char *fname,const uint8_t *from,uint32_t size,bool isExplorer,bool force128,uint32_t frames);
+void romStart(const uint8_t *from,bool isExplorer,bool force128);
+void benchRun(bench_t *res,uint32_t frames);
+void parkSample(bench_t *res,uint16_t a,bool reads);
+char *tText(char *buf,uint64_t t);
+bool cmdByte(uint8_t b);
+void command();
+uint8_t memRead(uint16_t a);
+uint8_t memPeek(uint16_t a);
+void memWrite(uint16_t a,uint8_t v);
+uint8_t portIn(uint16_t port);
+void portOut(uint16_t port,uint8_t v);
+void z80Reset(z80_t *z);
+int z80Step(z80_t *z);
+int z80Irq(z80_t *z);
+
+// the Spectrum
+z80_t z;
+uint8_t specRom[16384];	// its own ROM, both 128k ROMs are this one
+uint8_t ram[8][16384];
+bool is128;
+double tHz;	// T states a millisecond
+uint8_t p7ffd;
+uint8_t ayReg,ay[16];
+uint8_t border;
+bool verify;	// -v, stop at the jump into the game
+bool wholeUnpack;	// -w, every bank unpacked with RESET held
+snap_t snap;
+// the interface, names as picoif2lite.c
+const uint8_t *romEntry;	// ROM as stored
+uint8_t *romImage;	// whole ROM unpacked
+uint8_t *romData;	// what is served, the ROM or the ROM Explorer
+uint32_t romLen;
+uint8_t romMode;
+uint32_t adder;
+bool romcs,pagingOn,romStream,romLaunch,explorer;
+uint32_t streamWindow;
+const uint8_t *streamData;	// the open stream, unpacked in full so the ring never runs dry
+uint32_t streamLen,streamPos;
+bool streamLoop;	// tape mode, the tape starts again after the end
+uint64_t replyT;	// when core 1 has the reply in place, 0 none waiting
+uint8_t cmdFrame[6];
+unsigned int cmdPos;
+uint32_t im1Count,legacyCount;
+bench_t *cur;
+bool parkCheck;	// -p
+uint32_t readCount;	// ROM reads, fetchCount in picoif2lite.c
+uint16_t readRing[8];	// the last few, the sequencer samples one read part way through an instruction
+entry_t *catalog;	// every ROM given, in order
+unsigned int catalogCount,catalogPos;	// catalogPos is the ROM being run
+
+int main(int argc, char* argv[]) {
+	if (argc < 2) {
+		fprintf(stdout,"Usage benchROM <options> rom.h rom.bin ...\n");
+		fprintf(stdout,"  rom.h is a header file made by compressROM or Z80toROM, rom.bin a ROM as stored (-o)\n");
+		fprintf(stdout,"  -r rom  Spectrum ROM, a 16kB .rom or a .h like rominc/48.h, used once ROMCS is off\n");
+		fprintf(stdout,"  -c catalog.txt  every .h in a catalog manifest, the first is the ROM Explorer\n");
+		fprintf(stdout,"  -e the next ROM is the ROM Explorer\n");
+		fprintf(stdout,"  -m 128 run every ROM on a 128k Spectrum, otherwise only 128k snapshots are\n");
+		fprintf(stdout,"  -f frames to give each ROM, default %d\n",FRAMES);
+		fprintf(stdout,"  -p run each ROM until the sequencer would see it park, failing if it doesn't\n");
+		fprintf(stdout,"  -w a snapshot's banks are all unpacked before RESET is lifted, as before v0.8\n");
+		fprintf(stdout,"  -v the files after are snapshots, check the header Z80toROM made next to each\n");
+		fprintf(stdout,"  the ROMs are a catalogue in the order given, a data file goes after the stream port ROM that opens it\n");
+		exit(0);
+	}
+	static uint8_t rom[MAXTAPE];
+	uint32_t frames=FRAMES,len;
+	bool force128=false,isExplorer=false,failed=false;
+	memset(specRom,0xff,sizeof(specRom));
+	unsigned int checked=0,bad=0;
+	verify=argc>1&&!strcmp(argv[1],"-v");
+	if(!verify) fprintf(stdout,"%-32s %-5s %-23s %-17s %-23s\n","ROM","mode","first int","ROMCS off","game or menu");
+	for(int a=1;a<argc;a++) {
+		if(argv[a][0]=='-'&&argv[a][1]!=0&&argv[a][2]==0) {
+			char o=argv[a][1];
+			if(o=='e') {
+				isExplorer=true;
+				continue;
+			}
+			if(o=='p') {
+				parkCheck=true;
+				continue;
+			}
+			if(o=='w') {
+				wholeUnpack=true;
+				continue;
+			}
+			if(o=='v') {
+				if(a!=1) error(0); // the whole run is one or the other
+				continue;
+			}
+			if(a+1>=argc) error(0);
+			char *v=argv[++a];
+			if(o=='r') {
+				len=readRom(v,rom,MAXROM);
+				if(len==16384&&!(strlen(v)>2&&!strcmp(&v[strlen(v)-2],".h"))) memcpy(specRom,rom,16384);
+				else if(romCheck(rom,len)&&rom[0]==0) dtoBank(specRom,rom,34);
+				else error(1);
+			} else if(o=='m') {
+				force128=atoi(v)==128;
+			} else if(o=='f') {
+				frames=atoi(v);
+				if(frames==0) error(0);
+			} else if(o=='c') {
+				// the catalog as romcatalog.cmake reads it, only headers can be run without converting
+				FILE *fp_in;
+				if((fp_in=fopen(v,"r"))==NULL) error(4);
+				char dir[1024]="",line[1024],path[2048];
+				char *slash=strrchr(v,'/');
+				if(slash!=NULL) snprintf(dir,sizeof(dir),"%.*s",(int)(slash-v+1),v);
+				int n=0;
+				while(fgets(line,sizeof(line),fp_in)!=NULL) {
+					char *s=line,*e;
+					while(*s==' '||*s=='\t') s++;
+					if(*s=='#'||*s=='\r'||*s=='\n'||*s==0) continue;
+					if((e=strchr(s,'|'))==NULL) e=s+strcspn(s,"\r\n");
+					while(e>s&&(e[-1]==' '||e[-1]=='\t')) e--;
+					*e=0;
+					snprintf(path,sizeof(path),"%s%s",dir,s);
+					if(e-s>2&&!strcmp(e-2,".h")) {
+						len=readHeader(path,rom,MAXTAPE);
+						catalogAdd(s,rom,len,n,n==0,force128,frames);
+					} else {
+						catalogAdd(s,NULL,0,n,false,force128,frames);
+					}
+					n++;
+				}
+				fclose(fp_in);
+			} else error(0);
+			continue;
+		}
+		if(verify) {
+			checked++;
+			if(!verifySnap(argv[a],force128)) bad++;
+			continue;
+		}
+		len=readRom(argv[a],rom,MAXTAPE);
+		catalogAdd(argv[a],rom,len,-1,isExplorer,force128,frames);
+		isExplorer=false;
+	}
+	for(catalogPos=0;catalogPos<catalogCount;catalogPos++) {
+		entry_t *e=&catalog[catalogPos];
+		if(e->rom==NULL) {
+			fprintf(stdout,"%-32.32s not a header, run the one the catalog build makes (catalog/rom_%d.bin)\n",e->name,e->line);
+		} else if(!benchRom(e->name,e->rom,e->len,e->isExplorer,e->force128,e->frames)) {
+			failed=true;
+		}
+	}
+	if(verify) {
+		fprintf(stdout,"%u snapshots checked, %u differ\n",checked,bad);
+		failed=bad!=0;
+	}
+	if(failed) error(5);
+	return 0;
+}
+
+//
+// ---------------------------------------------------------------------------
+// catalogAdd - a ROM given, kept so a stream port ROM can open the ones after
+// it. Nothing is run until all of them have been read
+// ---------------------------------------------------------------------------
+void catalogAdd(const char *name,const uint8_t *rom,uint32_t len,int line,bool isExplorer,bool force128,uint32_t frames) {
+	static unsigned int max=0;
+	if(catalogCount==max) {
+		max=max?max*2:64;
+		if((catalog=realloc(catalog,max*sizeof(entry_t)))==NULL) error(6);
+	}
+	entry_t *e=&catalog[catalogCount++];
+	if((e->name=strdup(name))==NULL) error(6);
+	e->rom=NULL;
+	if(rom!=NULL) {
+		if((e->rom=malloc(len))==NULL) error(6);
+		memcpy(e->rom,rom,len);
+	}
+	e->len=len;
+	e->line=line;
+	e->isExplorer=isExplorer;
+	e->force128=force128;
+	e->frames=frames;
+}
+
+//
+// ---------------------------------------------------------------------------
+// readHeader - the bytes of the array in a ROM header file, the comment line
+// with the ROM name & size before it is skipped
+// ---------------------------------------------------------------------------
+uint32_t readHeader(char *fname,uint8_t *to,uint32_t max) {
+	FILE *fp_in;
+	if ((fp_in=fopen(fname,"rb"))==NULL) error(2);
+	int c;
+	uint32_t len=0;
+	bool inArray=false;
+	while((c=fgetc(fp_in))!=EOF) {
+		if(!inArray) {
+			if(c=='{') inArray=true;
+			else if(c=='/') { // skip the comment line so a { in the name can't confuse things
+				while((c=fgetc(fp_in))!=EOF&&c!='\n');
+			}
+		} else if(c=='}') {
+			break;
+		} else if(c=='x'||c=='X') {
+			unsigned int v;
+			if(fscanf(fp_in,"%2x",&v)!=1) error(3);
+			if(len>=max) error(3);
+			to[len++]=v;
+		}
+	}
+	fclose(fp_in);
+	return len;
+}
+
+//
+// ---------------------------------------------------------------------------
+// readRom - a ROM header file, or any other file as it is, a ROM as stored
+// (compressROM, Z80toROM or mkcatalog -o) or a plain Spectrum ROM
+// ---------------------------------------------------------------------------
+uint32_t readRom(char *fname,uint8_t *to,uint32_t max) {
+	size_t n=strlen(fname);
+	if(n>2&&!strcmp(&fname[n-2],".h")) return readHeader(fname,to,max);
+	FILE *fp_in;
+	if ((fp_in=fopen(fname,"rb"))==NULL) error(2);
+	uint32_t len=fread(to,sizeof(uint8_t),max,fp_in);
+	fclose(fp_in);
+	return len;
+}
+
+//
+// ---------------------------------------------------------------------------
+// romCheck - the header has a mode the firmware knows & the compressed
+// streams end exactly at the end, the same test the Pico does on uploads
+// ---------------------------------------------------------------------------
+bool romCheck(const uint8_t *from,uint32_t size) {
+	if(size<35||from[0]==2||from[0]==6||from[0]==7||from[0]>8) return false;
+	uint32_t b=romStreams(from),j=34;
+	if(b==0) return false;
+	while(b&&j<size) {
+		uint8_t c=from[j++];
+		if(c<128) j+=c+1;
+		else if(c>128) j++;
+		else b--;
+	}
+	return b==0&&j==size;
+}
+
+//
+// ---------------------------------------------------------------------------
+// romStreams - number of compressed streams in a ROM, less the banks left out
+// of a sparse snapshot which are counted from the bitmap at 0x31 of ROM 0
+// ---------------------------------------------------------------------------
+unsigned int romStreams(const uint8_t *from) {
+	unsigned int b=1,k;
+	if(from[1]&FLAG_LAUNCH) b=from[0]==5?2:from[0]+1; // loader ROM then the RAM banks or tape
+	else if(from[1]&FLAG_BANKED) b=from[0]; // 128k snapshot, bank by bank
+	if(from[1]&FLAG_SPARSE) {
+		static uint8_t bank0[16384];
+		dtoBank(bank0,from,34);
+		for(k=0;k<8;k++) if(bank0[SNAP_SPARSE]&(1<<k)) b--;
+	}
+	return b;
+}
+
+//
+// ---------------------------------------------------------------------------
+// picoUnpack - the Pico's time to unpack the first streams of a ROM, counted
+// from its tokens at the PICO_ cycle costs
+// output:
+//   ms
+// ---------------------------------------------------------------------------
+double picoUnpack(const uint8_t *from,unsigned int streams) {
+	uint32_t j=34;
+	uint64_t cycles=0;
+	uint8_t c;
+	while(streams) {
+		c=from[j++];
+		cycles+=PICO_TOKEN+PICO_XIP;
+		if(c<128) {
+			cycles+=(c+1u)*(PICO_LITERAL+PICO_XIP);
+			j+=c+1;
+		} else if(c>128) {
+			cycles+=(c-126u)*PICO_COPY+PICO_XIP;
+			j++;
+		} else {
+			streams--;
+		}
+	}
+	return cycles/(PICO_MHZ*1000.0);
+}
+
+//
+// ---------------------------------------------------------------------------
+// romSize - unpacked size of a ROM, walks the tokens without unpacking
+// ---------------------------------------------------------------------------
+uint32_t romSize(const uint8_t *from) {
+	uint32_t i=0,j=34;
+	unsigned int b=romStreams(from);
+	uint8_t c;
+	do {
+		c=from[j++];
+		if(c<128) {
+			i+=c+1;
+			j+=c+1;
+		} else if(c>128) {
+			i+=c-126;
+			j++;
+		} else {
+			b--;
+		}
+	} while(b);
+	return i;
+}
+
+//
+// ---------------------------------------------------------------------------
+// dtoBank - unpack one stream of a ROM
+// input:
+//   to - where it goes, 16kB is enough for anything but a tape
+//   j - where the stream starts in from
+// output:
+//   where the next stream starts
+// ---------------------------------------------------------------------------
+uint32_t dtoBank(uint8_t *to,const uint8_t *from,uint32_t j) {
+	uint32_t i=0,k;
+	uint8_t c,o;
+	while((c=from[j++])!=128) {
+		if(c<128) {
+			for(k=0;k<c+1u;k++) to[i++]=from[j++];
+		} else {
+			o=from[j++];
+			for(k=0;k<c-126u;k++,i++) to[i]=i>o?to[i-(o+1)]:0;
+		}
+	}
+	return j;
+}
+
+//
+// ---------------------------------------------------------------------------
+// benchRom - set the interface up for one ROM as romLoad() & romSetup() would,
+// run it & print its line of the table
+// output:
+//   false if it failed
+// ---------------------------------------------------------------------------
+bool benchRom(char *fname,const uint8_t *from,uint32_t size,bool isExplorer,bool force128,uint32_t frames) {
+	static const char *modes[]={"ROM","ZXC2","?","48k","data","tape","?","?","128k"};
+	if(!romCheck(from,size)) error(3);
+	char name[33];
+	memcpy(name,&from[2],32);
+	name[32]=0;
+	for(int k=31;k>=0&&(name[k]==' '||name[k]==0);k--) name[k]=0;
+	if(isExplorer) snprintf(name,sizeof(name),"ROM Explorer");
+	else if(name[0]==0) snprintf(name,sizeof(name),"%s",fname);
+	if(from[0]==4) {
+		fprintf(stdout,"%-32.32s %-5s only streamed by other ROMs\n",name,modes[4]);
+		return true;
+	}
+	romStart(from,isExplorer,force128);
+	bench_t res;
+	benchRun(&res,frames);
+	// report
+	bool failed=false;
+	char t1[32],t2[32],t3[32];
+	if(res.intT&&res.intIm==2) strcat(tText(t1,res.intT)," im2");
+	else tText(t1,res.intT);
+	tText(t2,res.offT);
+	tText(t3,res.gameT);
+	if(res.gameT) sprintf(&t3[strlen(t3)]," $%04x",res.gamePc);
+	if(isExplorer&&res.menuT) strcat(tText(t3,res.menuT)," menu");
+	fprintf(stdout,"%-32.32s %-5s %-23s %-17s %-23s",name,modes[romMode],t1,t2,t3);
+	if((from[1]&FLAG_BANKED)&&res.bankT[1]) fprintf(stdout," bank 1 read at %.1fms",res.bankT[1]/tHz);
+	if(res.gameT) {
+		// what romLoad() unpacks before RESET is lifted
+		unsigned int streams=1;
+		if(wholeUnpack) streams=romStreams(from);
+		else if(!(from[1]&FLAG_LAUNCH)&&!(from[1]&FLAG_BANKED)) streams=romStreams(from);
+		double held=picoUnpack(from,streams)+RESET_WAIT;
+		fprintf(stdout," select to game %.1fms, RESET held %.1fms",held+res.gameT/tHz,held);
+	}
+	if(res.tapeT) fprintf(stdout," tape read at %.1fms",res.tapeT/tHz);
+	if(res.parkT) fprintf(stdout," parked at $%04x, seen at %.1fms",res.parkAt,res.parkT/tHz);
+	if(res.streamEndT) {
+		double ms=(res.streamEndT-res.streamT)/tHz;
+		fprintf(stdout," stream %u bytes in %.1fms, %.0f bytes/s",res.streamLen,ms,res.streamLen*1000.0/ms);
+	}
+	if((romMode==3||romMode==8)&&!res.offT) {
+		fprintf(stdout," never released ROMCS");
+		failed=true;
+	} else if((romMode==3||romMode==8)&&!res.gameT) {
+		fprintf(stdout," never reached its game");
+		failed=true;
+	} else if(isExplorer&&(!res.dogT||res.dogT>tHz*500)) {
+		fprintf(stdout," watchdog would reset it");
+		failed=true;
+	} else if(isExplorer&&!res.menuT) {
+		fprintf(stdout," never showed its menu");
+		failed=true;
+	} else if(romMode==5&&(romData[0x39ff]!=0xff||romData[0x3a00]!=0xff)) {
+		fprintf(stdout," 0x39ff & 0x3a00 aren't 0xff for IM2");
+		failed=true;
+	} else if(res.openIntT) {
+		fprintf(stdout," interrupt at %.1fms with the tape window open",res.openIntT/tHz);
+		failed=true;
+	} else if(parkCheck&&!res.parkT) {
+		fprintf(stdout," never parked");
+		failed=true;
+	} else if(res.streamT&&!res.streamLen) {
+		fprintf(stdout," stream %u entries on isn't a data file",res.streamArg);
+		failed=true;
+	} else if(res.streamT&&!res.streamEndT) {
+		fprintf(stdout," stream read %u of %u bytes",streamPos,res.streamLen);
+		failed=true;
+	}
+	fprintf(stdout,"\n");
+	return !failed;
+}
+
+//
+// ---------------------------------------------------------------------------
+// romStart - set the interface up for a ROM as romLoad() & romSetup() would
+// & reset the Spectrum, a 128k for a 128k snapshot or with -m 128
+// ---------------------------------------------------------------------------
+void romStart(const uint8_t *from,bool isExplorer,bool force128) {
+	romEntry=from;
+	// unpack it all, the Pico has it ready before RESET is lifted
+	unsigned int b,streams=romStreams(from);
+	uint32_t j=34,len=romSize(from);
+	free(romImage);
+	if((romImage=malloc(len+16384))==NULL) error(6);
+	for(b=0;b<streams;b++) j=dtoBank(&romImage[b*16384],from,j); // only a tape is more than 16kB & it is last
+	romMode=from[0];
+	romData=romImage;
+	romLen=len;
+	romStream=!isExplorer&&(from[1]&FLAG_STREAM)!=0;
+	romLaunch=!isExplorer&&(from[1]&FLAG_LAUNCH)!=0;
+	explorer=isExplorer;
+	streamWindow=0x4000;
+	if(romStream) streamWindow=STREAM_WINDOW;
+	streamData=NULL;
+	streamLen=streamPos=0;
+	streamLoop=false;
+	replyT=0;
+	if(romLaunch) {
+		romLen=16384; // loader ROM only, its banks or tape come through the stream port
+		if(romMode==5) { // tape mode, opened at RESET but only read through the window once LD-BYTES opens it
+			streamData=&romImage[16384];
+			streamLen=len-16384;
+			streamLoop=true;
+		}
+	}
+	pagingOn=!romLaunch&&(romMode==1||romMode==3||romMode==8);
+	if(isExplorer) {
+		// navStart with the cursor on the first ROM, page already drawn
+		pagingOn=false;
+		memset(&romData[REPLY_WINDOW],0,6);
+		romData[REPLY_WINDOW+1]=1;
+		romData[REPLY_WINDOW+3]=1;
+		romData[0x000e]=0;
+		romData[REPLY_WINDOW]=1;
+	}
+	adder=0;
+	romcs=true;
+	cmdPos=0;
+	im1Count=legacyCount=0;
+	// the Spectrum
+	is128=force128||romMode==8;
+	tHz=is128?3546.9:3500.0;
+	memset(ram,0,sizeof(ram));
+	p7ffd=0;
+	ayReg=0;
+	memset(ay,0,sizeof(ay));
+	border=7;
+	z80Reset(&z);
+}
+
+//
+// ---------------------------------------------------------------------------
+// benchRun - run from RESET with a frame interrupt until everything that can
+// be timed for this ROM has happened or frames have gone by
+// ---------------------------------------------------------------------------
+void benchRun(bench_t *res,uint32_t frames) {
+	uint32_t frameLen=is128?FRAME128:FRAME48;
+	uint64_t intAt=0,limit=(uint64_t)frames*frameLen;
+	uint32_t samples=0,sampleReads=readCount;
+	memset(res,0,sizeof(bench_t));
+	res->selected=-1;
+	cur=res;
+	parkSample(NULL,0,false);
+	while(z.cycles<limit&&res->selected<0) {
+		if(z.cycles>=intAt) {
+			bool taken=false;
+			if(z.cycles<intAt+INT_LEN&&z80Irq(&z)) {
+				taken=true;
+				if(!res->intT) {
+					res->intT=z.cycles;
+					res->intIm=z.im;
+				}
+			}
+			if(taken||z.cycles>=intAt+INT_LEN) intAt+=frameLen;
+			if(taken&&streamWindow==TAPE_WINDOW&&!res->openIntT) res->openIntT=z.cycles;
+		}
+		if((romMode==3||romMode==8)&&!romcs&&!res->gameT&&!z.halted&&memPeek(z.pc)==0xc3) {
+			res->jpAt=z.pc;
+			z80Step(&z); // jp out of the final loader
+			res->gameT=z.cycles;
+			res->gamePc=z.pc;
+			if(verify) break;
+			continue;
+		}
+		uint32_t before=readCount;
+		z80Step(&z);
+		if(!res->offT&&!romcs) res->offT=z.cycles;
+		if(parkCheck&&z.cycles>=(samples+1)*tHz) {
+			// every ms, one of the reads the instruction made as core 1 could catch any of them
+			uint32_t n=readCount-before;
+			if(n>8) n=8;
+			samples++;
+			parkSample(res,readRing[(n?before+samples%n:readCount-1)&7],readCount!=sampleReads);
+			sampleReads=readCount;
+		}
+		// done once nothing else can happen, a stream port ROM once it has read a data file
+		if(parkCheck) {
+			if(res->parkT) break;
+		} else if(explorer) {
+			if(res->dogT&&res->menuT) break;
+		} else if(romMode==5) {
+			if(res->tapeT&&z.cycles>res->tapeT+5*frameLen) break;
+		} else if(res->intT&&!(romStream&&!romLaunch&&!res->streamEndT)) {
+			if(romMode!=3&&romMode!=8) break;
+			if(res->gameT) break;
+		}
+	}
+}
+
+//
+// ---------------------------------------------------------------------------
+// parkSample - the sequencer's park check in seqPoll(), fed a sample of the
+// address read every ms. Each range of SEQ_PARK addresses seen is counted,
+// SEQ_PARK_SLOTS of them at once with the least seen giving way to a new one,
+// & every SEQ_PARK_MS it is parked if one range has SEQ_PARK_SHARE of the
+// samples & IM1 isn't coming at a rate the watchdog would call running
+// input:
+//   res - the ROM's results, NULL to start again
+//   a - address sampled
+//   reads - any ROM reads since the last sample
+// ---------------------------------------------------------------------------
+void parkSample(bench_t *res,uint16_t a,bool reads) {
+	static uint32_t samples,im1,hits[SEQ_PARK_SLOTS],miss[SEQ_PARK_SLOTS];
+	static uint16_t at[SEQ_PARK_SLOTS];
+	unsigned int k,least=0;
+	if(res==NULL||samples==SEQ_PARK_MS) {
+		samples=0;
+		im1=im1Count;
+		memset(hits,0,sizeof(hits));
+		memset(miss,0,sizeof(miss));
+		if(res==NULL) return;
+	}
+	samples++;
+	if(reads) {
+		for(k=0;k<SEQ_PARK_SLOTS;k++) {
+			if(hits[k]&&(uint16_t)(a-at[k]+SEQ_PARK-1)<2*SEQ_PARK-1) break;
+			if(hits[k]<hits[least]) least=k;
+		}
+		if(k<SEQ_PARK_SLOTS) {
+			hits[k]++;
+		} else {
+			at[least]=a;
+			miss[least]=hits[least];
+			hits[least]++;
+		}
+	}
+	if(samples<SEQ_PARK_MS) return;
+	unsigned int most=0;
+	for(k=1;k<SEQ_PARK_SLOTS;k++) {
+		if(hits[k]-miss[k]>hits[most]-miss[most]) most=k;
+	}
+	uint32_t rate=(im1Count-im1)/(SEQ_PARK_MS/1000);
+	if((hits[most]-miss[most])*100>=samples*SEQ_PARK_SHARE&&(rate<WD_IM1_MIN||rate>WD_IM1_MAX)&&!res->parkT) {
+		res->parkT=z.cycles;
+		res->parkAt=at[most];
+	}
+}
+
+//
+// ---------------------------------------------------------------------------
+// verifySnap - run the ROM Z80toROM made from a snapshot to the jump into the
+// game & compare everything with the snapshot, one line for each snapshot
+// output:
+//   false if anything differs or it couldn't be run
+// ---------------------------------------------------------------------------
+bool verifySnap(char *fname,bool force128) {
+	static uint8_t rom[MAXROM];
+	char hname[1024];
+	const char *why=snapRead(fname,&snap);
+	if(why!=NULL) {
+		fprintf(stdout,"%s: %s\n",fname,why);
+		return false;
+	}
+	// the header is next to it, game.z80 -> game.h
+	snprintf(hname,sizeof(hname),"%s",fname);
+	char *dot=strrchr(hname,'.');
+	if(dot!=NULL) strcpy(dot,".h");
+	FILE *fp_in;
+	if((fp_in=fopen(hname,"rb"))==NULL) {
+		fprintf(stdout,"%s: no %s, not converted\n",fname,hname);
+		return false;
+	}
+	fclose(fp_in);
+	uint32_t len=readHeader(hname,rom,MAXROM);
+	if(!romCheck(rom,len)||(rom[0]!=3&&rom[0]!=8)) {
+		fprintf(stdout,"%s: %s isn't a snapshot ROM\n",fname,hname);
+		return false;
+	}
+	if((rom[0]==8)!=snap.is128) {
+		fprintf(stdout,"%s: %s is a %s snapshot\n",fname,hname,rom[0]==8?"128k":"48k");
+		return false;
+	}
+	romStart(rom,false,force128);
+	bench_t res;
+	benchRun(&res,FRAMES);
+	if(!res.offT||!res.gameT) {
+		fprintf(stdout,"%s: %s\n",fname,res.offT?"never reached its game":"never released ROMCS");
+		return false;
+	}
+	// registers
+	char diff[1024]="";
+	z80_t *w=&snap.z;
+#define CHECK(name,got,want,fmt) if((got)!=(want)) snprintf(&diff[strlen(diff)],sizeof(diff)-strlen(diff)," " name " " fmt " not " fmt,got,want)
+	CHECK("pc",z.pc,w->pc,"$%04x");
+	CHECK("sp",z.sp,w->sp,"$%04x");
+	CHECK("af",(z.a<<8)|z.f,(w->a<<8)|w->f,"$%04x");
+	CHECK("bc",(z.b<<8)|z.c,(w->b<<8)|w->c,"$%04x");
+	CHECK("de",(z.d<<8)|z.e,(w->d<<8)|w->e,"$%04x");
+	CHECK("hl",(z.h<<8)|z.l,(w->h<<8)|w->l,"$%04x");
+	CHECK("af'",(z.a_<<8)|z.f_,(w->a_<<8)|w->f_,"$%04x");
+	CHECK("bc'",(z.b_<<8)|z.c_,(w->b_<<8)|w->c_,"$%04x");
+	CHECK("de'",(z.d_<<8)|z.e_,(w->d_<<8)|w->e_,"$%04x");
+	CHECK("hl'",(z.h_<<8)|z.l_,(w->h_<<8)|w->l_,"$%04x");
+	CHECK("ix",z.ix,w->ix,"$%04x");
+	CHECK("iy",z.iy,w->iy,"$%04x");
+	CHECK("i",z.i,w->i,"$%02x");
+	CHECK("r",z.r,w->r,"$%02x");
+	CHECK("im",z.im,w->im,"%d");
+	CHECK("iff1",z.iff1,w->iff1,"%d");
+	CHECK("border",border,snap.border,"%d");
+	if(snap.is128) {
+		CHECK("7ffd",p7ffd,snap.p7ffd,"$%02x");
+		if(snap.hasAy) {
+			CHECK("fffd",ayReg,snap.ayReg&0x0f,"$%02x");
+			for(int k=0;k<16;k++) CHECK("ay",ay[k],snap.ay[k],"$%02x");
+		}
+	}
+	// RAM, less the final loader wherever it ended up
+	uint8_t top=snap.is128?p7ffd&7:0;
+	for(int b=0;b<8;b++) {
+		if(!snap.is128&&b!=5&&b!=2&&b!=0) continue;
+		uint32_t n=0,first=0;
+		for(uint32_t k=0;k<16384;k++) {
+			if(ram[b][k]==snap.ram[b][k]) continue;
+			uint16_t at=b==5?0x4000+k:b==2?0x8000+k:0xc000+k;
+			if((b==5||b==2||b==top)&&(uint16_t)(at-(res.jpAt-10))<LOADER_LEN) continue;
+			if(n++==0) first=k;
+		}
+		if(n) snprintf(&diff[strlen(diff)],sizeof(diff)-strlen(diff)," bank %d %u bytes from $%04x",b,n,first);
+	}
+#undef CHECK
+	if(diff[0]) {
+		fprintf(stdout,"%s:%s\n",fname,diff);
+		return false;
+	}
+	fprintf(stdout,"%s: ok, %lluT %.1fms",fname,(unsigned long long)res.gameT,res.gameT/tHz);
+	if((rom[1]&FLAG_BANKED)&&res.bankT[1]) fprintf(stdout,", bank 1 read at %.1fms",res.bankT[1]/tHz);
+	fprintf(stdout,"\n");
+	return true;
+}
+
+//
+// ---------------------------------------------------------------------------
+// snapRead - the registers & memory of a 48k or 128k SNA or Z80 snapshot
+// output:
+//   NULL if it was read, otherwise why not
+// ---------------------------------------------------------------------------
+const char *snapRead(char *fname,snap_t *s) {
+	static uint8_t buf[MAXSNAP];
+	FILE *fp_in;
+	if((fp_in=fopen(fname,"rb"))==NULL) return "cannot open";
+	uint32_t len=fread(buf,sizeof(uint8_t),MAXSNAP,fp_in);
+	fclose(fp_in);
+	memset(s,0,sizeof(snap_t));
+	z80_t *r=&s->z;
+	size_t n=strlen(fname);
+	if(n>4&&(fname[n-3]|0x20)=='s'&&(fname[n-2]|0x20)=='n'&&(fname[n-1]|0x20)=='a') {
+		if(len!=49179&&len!=131103&&len!=147487) return "not a 48k or 128k SNA";
+		r->i=buf[0];
+		r->l_=buf[1];
+		r->h_=buf[2];
+		r->e_=buf[3];
+		r->d_=buf[4];
+		r->c_=buf[5];
+		r->b_=buf[6];
+		r->f_=buf[7];
+		r->a_=buf[8];
+		r->l=buf[9];
+		r->h=buf[10];
+		r->e=buf[11];
+		r->d=buf[12];
+		r->c=buf[13];
+		r->b=buf[14];
+		r->iy=buf[15]|(buf[16]<<8);
+		r->ix=buf[17]|(buf[18]<<8);
+		r->iff1=r->iff2=(buf[19]&0x04)!=0;
+		r->r=buf[20];
+		r->f=buf[21];
+		r->a=buf[22];
+		r->sp=buf[23]|(buf[24]<<8);
+		r->im=buf[25]&3;
+		s->border=buf[26]&7;
+		memcpy(s->ram[5],&buf[27],16384);
+		memcpy(s->ram[2],&buf[27+16384],16384);
+		if(len==49179) {
+			// 48k, PC is on the stack for a RETN
+			memcpy(s->ram[0],&buf[27+32768],16384);
+			if(r->sp<0x4000||r->sp>0xfffe) return "PC on the stack in ROM";
+			uint8_t *lo=r->sp<0x8000?s->ram[5]:r->sp<0xc000?s->ram[2]:s->ram[0];
+			uint8_t *hi=r->sp+1<0x8000?s->ram[5]:r->sp+1<0xc000?s->ram[2]:s->ram[0];
+			r->pc=lo[r->sp&0x3fff]|(hi[(r->sp+1)&0x3fff]<<8);
+			r->sp+=2;
+		} else {
+			// 128k, the paged bank in the 48k part then the rest in order
+			s->is128=true;
+			r->pc=buf[49179]|(buf[49180]<<8);
+			s->p7ffd=buf[49181];
+			uint8_t top=s->p7ffd&7;
+			memcpy(s->ram[top],&buf[27+32768],16384);
+			uint32_t j=49183;
+			for(int b=0;b<8;b++) {
+				if(b==5||b==2||b==top) continue;
+				if(j+16384>len) return "128k SNA too short";
+				memcpy(s->ram[b],&buf[j],16384);
+				j+=16384;
+			}
+		}
+		return NULL;
+	}
+	if(len<30) return "not a Z80 snapshot";
+	r->a=buf[0];
+	r->f=buf[1];
+	r->c=buf[2];
+	r->b=buf[3];
+	r->l=buf[4];
+	r->h=buf[5];
+	r->pc=buf[6]|(buf[7]<<8);
+	r->sp=buf[8]|(buf[9]<<8);
+	r->i=buf[10];
+	uint8_t flags=buf[12]==0xff?1:buf[12];
+	r->r=(buf[11]&0x7f)|((flags&1)<<7);
+	s->border=(flags>>1)&7;
+	r->e=buf[13];
+	r->d=buf[14];
+	r->c_=buf[15];
+	r->b_=buf[16];
+	r->e_=buf[17];
+	r->d_=buf[18];
+	r->l_=buf[19];
+	r->h_=buf[20];
+	r->a_=buf[21];
+	r->f_=buf[22];
+	r->iy=buf[23]|(buf[24]<<8);
+	r->ix=buf[25]|(buf[26]<<8);
+	r->iff1=buf[27]!=0;
+	r->iff2=buf[28]!=0;
+	r->im=buf[29]&3;
+	if(r->pc!=0) {
+		// version 1, 48k in one block
+		static uint8_t mem[49152];
+		if(flags&0x20) {
+			if(snapUnpack(&buf[30],len-30,mem,49152)!=49152) return "Z80 memory too short";
+		} else {
+			if(len<30+49152) return "Z80 memory too short";
+			memcpy(mem,&buf[30],49152);
+		}
+		memcpy(s->ram[5],mem,16384);
+		memcpy(s->ram[2],&mem[16384],16384);
+		memcpy(s->ram[0],&mem[32768],16384);
+		return NULL;
+	}
+	// version 2 & 3, a block for each 16kB page
+	if(len<35) return "not a Z80 snapshot";
+	uint16_t extra=buf[30]|(buf[31]<<8);
+	r->pc=buf[32]|(buf[33]<<8);
+	uint8_t hw=buf[34];
+	if(hw==2||hw==10||hw==11||hw>13) return "hardware not supported";
+	s->is128=extra==23?hw>=3:hw>=4;
+	if(len<32u+extra) return "Z80 header too short";
+	if(s->is128) {
+		s->hasAy=true;
+		s->p7ffd=buf[35];
+		s->ayReg=buf[38];
+		for(int k=0;k<16;k++) s->ay[k]=buf[39+k];
+	}
+	if(extra==55&&(buf[86]&1)) return "+2A/+3 special paging not supported";
+	uint32_t j=32+extra,got=0;
+	while(j+3<=len) {
+		uint16_t blen=buf[j]|(buf[j+1]<<8);
+		uint8_t page=buf[j+2];
+		j+=3;
+		uint32_t dlen=blen==0xffff?16384:blen;
+		if(j+dlen>len) return "Z80 page too short";
+		int b=-1;
+		if(s->is128&&page>=3&&page<=10) b=page-3;
+		else if(!s->is128&&page==4) b=2;
+		else if(!s->is128&&page==5) b=0;
+		else if(!s->is128&&page==8) b=5;
+		if(b>=0) {
+			if(blen==0xffff) memcpy(s->ram[b],&buf[j],16384);
+			else if(snapUnpack(&buf[j],dlen,s->ram[b],16384)!=16384) return "Z80 page damaged";
+			got|=1<<b;
+		}
+		j+=dlen;
+	}
+	if(got!=(s->is128?0xffu:0x25u)) return "Z80 pages missing";
+	return NULL;
+}
+
+//
+// ---------------------------------------------------------------------------
+// snapUnpack - Z80 snapshot compression, ED ED count value for a run
+// output:
+//   bytes unpacked
+// ---------------------------------------------------------------------------
+uint32_t snapUnpack(const uint8_t *from,uint32_t len,uint8_t *to,uint32_t max) {
+	uint32_t i=0,j=0;
+	while(i<max&&j<len) {
+		if(j+3<len&&from[j]==0xed&&from[j+1]==0xed) {
+			uint8_t n=from[j+2],v=from[j+3];
+			j+=4;
+			while(n--&&i<max) to[i++]=v;
+		} else {
+			to[i++]=from[j++];
+		}
+	}
+	return i;
+}
+
+//
+// ---------------------------------------------------------------------------
+// tText - T states & milliseconds for the table, - for never
+// ---------------------------------------------------------------------------
+char *tText(char *buf,uint64_t t) {
+	if(t==0) strcpy(buf,"-");
+	else sprintf(buf,"%lluT %.1fms",(unsigned long long)t,t/tHz);
+	return buf;
+}
+
+//
+// ---------------------------------------------------------------------------
+// cmdByte - feed one byte read through the command window into the frame,
+// as picoif2lite.c
+// output:
+//   true when a complete frame with a good checksum is in cmdFrame
+// ---------------------------------------------------------------------------
+bool cmdByte(uint8_t b) {
+	if(cmdPos==0) {
+		if(b==0xa5) cmdFrame[cmdPos++]=b;
+	} else if(cmdPos==1) {
+		if(b==0x5a) cmdFrame[cmdPos++]=b;
+		else if(b!=0xa5) cmdPos=0;
+	} else if(cmdPos<5) {
+		cmdFrame[cmdPos++]=b;
+	} else {
+		cmdPos=0;
+		if(b==(cmdFrame[2]^cmdFrame[3]^cmdFrame[4]^0xff)) return true;
+		if(b==0xa5) cmdFrame[cmdPos++]=b;
+	}
+	return false;
+}
+
+//
+// ---------------------------------------------------------------------------
+// command - a complete command frame, answered at once as if core 1 were
+// infinitely quick. A stream opens the ROM's own banks or the data file that
+// many entries after it in the catalogue, anything else opens empty. The
+// banks are all unpacked before the reply, so that waits the Pico's time
+// ---------------------------------------------------------------------------
+void command() {
+	uint8_t *reply=&romData[REPLY_WINDOW];
+	uint16_t arg=cmdFrame[3]|(cmdFrame[4]<<8);
+	if(explorer) {
+		if(cmdFrame[2]==CMD_SELECT) {
+			cur->selected=arg;
+		} else if(cmdFrame[2]==CMD_KEY||cmdFrame[2]==CMD_PREVIEW) {
+			reply[1]=0; // page unchanged, no preview
+			reply[0]=1;
+		}
+		return;
+	}
+	if(cmdFrame[2]==CMD_TAPE&&romMode==5) {
+		streamWindow=cmdFrame[3]?TAPE_WINDOW:0x4000; // LD-BYTES opening or closing the tape window
+		return;
+	}
+	if(cmdFrame[2]!=CMD_STREAM) return;
+	// streamOpen, a streamed launch snapshot opening itself gets its RAM banks
+	uint32_t len=0;
+	streamPos=0;
+	if(arg==0&&romLaunch) {
+		streamData=&romImage[16384];
+		len=romSize(romEntry)-16384;
+		// every RAM bank is unpacked into bank1 before the reply, the loader polls till then
+		double ms=picoUnpack(romEntry,romStreams(romEntry))-picoUnpack(romEntry,1);
+		replyT=z.cycles+(uint64_t)(ms*tHz);
+	} else {
+		static uint8_t data[65536]; // a data file is up to 64kB
+		const uint8_t *from=catalogPos+arg<catalogCount?catalog[catalogPos+arg].rom:NULL;
+		if(arg!=0&&from!=NULL&&from[0]==4) {
+			dtoBank(data,from,34);
+			streamData=data;
+			len=romSize(from);
+		}
+		cur->streamT=z.cycles;
+		cur->streamEndT=0;
+		cur->streamLen=len;
+		cur->streamArg=arg;
+	}
+	streamLen=len;
+	reply[1]=len;
+	reply[2]=len>>8;
+	reply[3]=len>>16;
+	reply[4]=len>>24;
+	reply[0]=replyT==0;
+}
+
+//
+// ---------------------------------------------------------------------------
+// memRead - a read by the Z80, below 0x4000 the Pico sees it & does what
+// romServe() does whether or not ROMCS is on
+// ---------------------------------------------------------------------------
+uint8_t memRead(uint16_t a) {
+	if(a>=0x4000) return memPeek(a);
+	readRing[readCount++&7]=a;
+	if(replyT&&z.cycles>=replyT) {
+		romData[REPLY_WINDOW]=1;
+		replyT=0;
+	}
+	bool cs=romcs;
+	uint8_t c;
+	if((a&0x3f00)==streamWindow) {
+		c=0xff;
+		if(streamPos<streamLen) {
+			c=streamData[streamPos++];
+			if(streamPos==streamLen&&cur->streamT&&!cur->streamEndT) cur->streamEndT=z.cycles;
+			if(streamLoop&&streamPos==streamLen-2&&!cur->tapeT) cur->tapeT=z.cycles; // up to the end marker
+		}
+		if(streamPos==streamLen&&streamLoop) streamPos=0;
+	} else c=romData[a+adder];
+	if(a==0x0038&&++im1Count==10&&explorer) cur->dogT=z.cycles;
+	if(explorer&&(a==SCREEN_WINDOW||a==SCREEN_WINDOW+6911)&&!cur->screenT[a!=SCREEN_WINDOW]) {
+		cur->screenT[a!=SCREEN_WINDOW]=z.cycles;
+		if(cur->screenT[0]&&cur->screenT[1]) cur->menuT=z.cycles;
+	}
+	if(explorer) {
+		// the ROM Explorer's commands are only looked at once the watchdog is happy
+		if(im1Count>=10) {
+			if((a&0x3f00)==CMD_WINDOW&&cmdByte(a)) command();
+			else if(a>=0x3f80&&++legacyCount>=256) cur->selected=a-0x3f80;
+		}
+	} else if((romStream||romMode==5)&&(a&0x3f00)==CMD_WINDOW&&cmdByte(a)) {
+		command();
+	}
+	if(romMode==3||romMode==8) {
+		if(a==0x3fff) {
+			if(pagingOn) {
+				adder+=16384;
+				if(adder==romLen) { // banks left out of a sparse snapshot are not served
+					adder=0;
+					pagingOn=false;
+				} else if(!cur->bankT[adder>>14]) cur->bankT[adder>>14]=z.cycles;
+			} else romcs=false;
+		}
+	} else if(romMode==1&&pagingOn&&a>=0x3fc0&&!explorer) {
+		romcs=(a&poMask)!=poMask;
+		adder=(a&bkMask)*16384;
+		if(adder>=romLen) adder=0;
+		if((a&lkMask)==lkMask) pagingOn=false;
+	}
+	return cs?c:specRom[a];
+}
+
+//
+// ---------------------------------------------------------------------------
+// memPeek - RAM as the Z80 sees it, or the Spectrum's ROM without the Pico
+// seeing the read
+// ---------------------------------------------------------------------------
+uint8_t memPeek(uint16_t a) {
+	if(a<0x4000) return romcs?romData[a+adder]:specRom[a];
+	if(a<0x8000) return ram[5][a&0x3fff];
+	if(a<0xc000) return ram[2][a&0x3fff];
+	return ram[is128?p7ffd&7:0][a&0x3fff];
+}
+
+//
+// ---------------------------------------------------------------------------
+// memWrite - a write by the Z80, the interface ignores them
+// ---------------------------------------------------------------------------
+void memWrite(uint16_t a,uint8_t v) {
+	if(a<0x4000) return;
+	if(a<0x8000) ram[5][a&0x3fff]=v;
+	else if(a<0xc000) ram[2][a&0x3fff]=v;
+	else ram[is128?p7ffd&7:0][a&0x3fff]=v;
+}
+
+//
+// ---------------------------------------------------------------------------
+// portIn - no keys pressed, floating bus 0xff, the AY register on a 128k
+// ---------------------------------------------------------------------------
+uint8_t portIn(uint16_t port) {
+	if(is128&&(port&0xc002)==0xc000) return ay[ayReg];
+	return 0xff;
+}
+
+//
+// ---------------------------------------------------------------------------
+// portOut - the border, 128k paging until it is locked & the AY registers
+// ---------------------------------------------------------------------------
+void portOut(uint16_t port,uint8_t v) {
+	if(!(port&0x0001)) border=v&7;
+	if(!is128) return;
+	if(!(port&0x8002)) {
+		if(!(p7ffd&0x20)) p7ffd=v;
+	} else if((port&0xc002)==0xc000) {
+		ayReg=v&0x0f;
+	} else if((port&0xc002)==0x8000) {
+		ay[ayReg]=v;
+	}
+}
+
+//
+// ---------------------------------------------------------------------------
+// Z80 core - instruction level with the documented T states, undocumented
+// flags (X/Y) & IXh/IXl/SLL as the real chip. Enough to run ROMs & games to
+// their first interrupt, nothing here knows about the interface
+// ---------------------------------------------------------------------------
+#define FC 0x01
+#define FN 0x02
+#define FP 0x04
+#define FX 0x08
+#define FH 0x10
+#define FY 0x20
+#define FZ 0x40
+#define FS 0x80
+
+static const uint8_t cyc[256]={
+	 4,10, 7, 6, 4, 4, 7, 4, 4,11, 7, 6, 4, 4, 7, 4,
+	 8,10, 7, 6, 4, 4, 7, 4,12,11, 7, 6, 4, 4, 7, 4,
+	 7,10,16, 6, 4, 4, 7, 4, 7,11,16, 6, 4, 4, 7, 4,
+	 7,10,13, 6,11,11,10, 4, 7,11,13, 6, 4, 4, 7, 4,
+	 4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+	 4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+	 4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+	 7, 7, 7, 7, 7, 7, 4, 7, 4, 4, 4, 4, 4, 4, 7, 4,
+	 4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+	 4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+	 4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+	 4, 4, 4, 4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4,
+	 5,10,10,10,10,11, 7,11, 5,10,10, 0,10,17, 7,11,
+	 5,10,10,11,10,11, 7,11, 5, 4,10,11,10, 0, 7,11,
+	 5,10,10,19,10,11, 7,11, 5, 4,10, 4,10, 0, 7,11,
+	 5,10,10, 4,10,11, 7,11, 5, 6,10, 4,10, 0, 7,11 };
+
+static uint8_t szxy[256],szxyp[256];	// S Z X Y flags of a result, & P for parity
+
+static inline uint8_t rd(uint16_t a) { return memRead(a); }
+static inline void wr(uint16_t a,uint8_t v) { memWrite(a,v); }
+static inline uint16_t rd16(uint16_t a) { return rd(a)|(rd(a+1)<<8); }
+static inline void wr16(uint16_t a,uint16_t v) { wr(a,v); wr(a+1,v>>8); }
+static inline uint8_t fetch(z80_t *z) { return rd(z->pc++); }
+// refresh - the end of every M1, R goes up & I<<8|R is on the bus with MREQ
+static inline void refresh(z80_t *z) {
+	z->r=(z->r&0x80)|((z->r+1)&0x7f);
+	if(z->i<0x40) memRead((z->i<<8)|z->r);
+}
+static inline uint8_t fetchM1(z80_t *z) {
+	uint8_t op=rd(z->pc++);
+	refresh(z);
+	return op;
+}
+static inline uint16_t fetch16(z80_t *z) { uint16_t v=fetch(z); return v|(fetch(z)<<8); }
+static inline uint16_t BC(z80_t *z) { return (z->b<<8)|z->c; }
+static inline uint16_t DE(z80_t *z) { return (z->d<<8)|z->e; }
+static inline uint16_t HL(z80_t *z) { return (z->h<<8)|z->l; }
+static inline void setBC(z80_t *z,uint16_t v) { z->b=v>>8; z->c=v; }
+static inline void setDE(z80_t *z,uint16_t v) { z->d=v>>8; z->e=v; }
+static inline void setHL(z80_t *z,uint16_t v) { z->h=v>>8; z->l=v; }
+static inline void push(z80_t *z,uint16_t v) { z->sp-=2; wr16(z->sp,v); }
+static inline uint16_t pop(z80_t *z) { uint16_t v=rd16(z->sp); z->sp+=2; return v; }
+
+// 16bit register pair p (0 BC, 1 DE, 2 HL/IX/IY, 3 SP)
+static uint16_t getRP(z80_t *z,int p,int ix) {
+	switch(p) {
+		case 0: return BC(z);
+		case 1: return DE(z);
+		case 2: return ix==1?z->ix:ix==2?z->iy:HL(z);
+		default: return z->sp;
+	}
+}
+static void setRP(z80_t *z,int p,int ix,uint16_t v) {
+	switch(p) {
+		case 0: setBC(z,v); break;
+		case 1: setDE(z,v); break;
+		case 2: if(ix==1) z->ix=v; else if(ix==2) z->iy=v; else setHL(z,v); break;
+		default: z->sp=v;
+	}
+}
+// 8bit register r (6 is memory, done by the caller), ix picks IXh/IXl for 4 & 5
+static uint8_t get8(z80_t *z,int r,int ix) {
+	switch(r) {
+		case 0: return z->b;
+		case 1: return z->c;
+		case 2: return z->d;
+		case 3: return z->e;
+		case 4: return ix==1?z->ix>>8:ix==2?z->iy>>8:z->h;
+		case 5: return ix==1?z->ix&0xff:ix==2?z->iy&0xff:z->l;
+		default: return z->a;
+	}
+}
+static void set8(z80_t *z,int r,int ix,uint8_t v) {
+	switch(r) {
+		case 0: z->b=v; break;
+		case 1: z->c=v; break;
+		case 2: z->d=v; break;
+		case 3: z->e=v; break;
+		case 4: if(ix==1) z->ix=(z->ix&0xff)|(v<<8); else if(ix==2) z->iy=(z->iy&0xff)|(v<<8); else z->h=v; break;
+		case 5: if(ix==1) z->ix=(z->ix&0xff00)|v; else if(ix==2) z->iy=(z->iy&0xff00)|v; else z->l=v; break;
+		default: z->a=v;
+	}
+}
+
+static void alu(z80_t *z,int op,uint8_t v) {
+	uint8_t a=z->a;
+	unsigned int r;
+	switch(op) {
+		case 0: // add
+		case 1: // adc
+			r=a+v+(op==1?(z->f&FC):0);
+			z->f=szxy[r&0xff]|((a^v^r)&FH)|(((a^~v)&(a^r)&0x80)?FP:0)|(r>0xff?FC:0);
+			z->a=r;
+			break;
+		case 2: // sub
+		case 3: // sbc
+		case 7: // cp
+			r=a-v-(op==3?(z->f&FC):0);
+			z->f=(szxy[r&0xff]&~(FX|FY))|FN|((a^v^r)&FH)|(((a^v)&(a^r)&0x80)?FP:0)|((r>>8)&FC);
+			if(op==7) z->f|=v&(FX|FY);
+			else {
+				z->f|=r&(FX|FY);
+				z->a=r;
+			}
+			break;
+		case 4: z->a&=v; z->f=szxyp[z->a]|FH; break;
+		case 5: z->a^=v; z->f=szxyp[z->a]; break;
+		default: z->a|=v; z->f=szxyp[z->a];
+	}
+}
+static uint8_t inc8(z80_t *z,uint8_t v) {
+	uint8_t r=v+1;
+	z->f=(z->f&FC)|szxy[r]|(r==0x80?FP:0)|((r&0x0f)==0?FH:0);
+	return r;
+}
+static uint8_t dec8(z80_t *z,uint8_t v) {
+	uint8_t r=v-1;
+	z->f=(z->f&FC)|szxy[r]|FN|(v==0x80?FP:0)|((v&0x0f)==0?FH:0);
+	return r;
+}
+static uint16_t add16(z80_t *z,uint16_t a,uint16_t b) {
+	uint32_t r=a+b;
+	z->f=(z->f&(FS|FZ|FP))|(((a^b^r)>>8)&FH)|((r>>16)&FC)|((r>>8)&(FX|FY));
+	return r;
+}
+static uint16_t adc16(z80_t *z,uint16_t a,uint16_t b) {
+	uint32_t r=a+b+(z->f&FC);
+	z->f=((r>>8)&(FS|FX|FY))|((r&0xffff)==0?FZ:0)|(((a^b^r)>>8)&FH)|(((a^~b)&(a^r)&0x8000)?FP:0)|((r>>16)&FC);
+	return r;
+}
+static uint16_t sbc16(z80_t *z,uint16_t a,uint16_t b) {
+	uint32_t r=a-b-(z->f&FC);
+	z->f=((r>>8)&(FS|FX|FY))|((r&0xffff)==0?FZ:0)|(((a^b^r)>>8)&FH)|(((a^b)&(a^r)&0x8000)?FP:0)|((r>>16)&FC)|FN;
+	return r;
+}
+static uint8_t rot(z80_t *z,int op,uint8_t v) {
+	uint8_t c;
+	switch(op) {
+		case 0: c=v>>7; v=(v<<1)|c; break;                 // rlc
+		case 1: c=v&1; v=(v>>1)|(c<<7); break;             // rrc
+		case 2: c=v>>7; v=(v<<1)|(z->f&FC); break;         // rl
+		case 3: c=v&1; v=(v>>1)|((z->f&FC)<<7); break;     // rr
+		case 4: c=v>>7; v<<=1; break;                      // sla
+		case 5: c=v&1; v=(v>>1)|(v&0x80); break;           // sra
+		case 6: c=v>>7; v=(v<<1)|1; break;                 // sll
+		default: c=v&1; v>>=1;                             // srl
+	}
+	z->f=szxyp[v]|c;
+	return v;
+}
+static void daa(z80_t *z) {
+	uint8_t a=z->a,add=0,c=z->f&FC,h;
+	if((z->f&FH)||(a&0x0f)>9) add=0x06;
+	if(c||a>0x99) {
+		add|=0x60;
+		c=FC;
+	}
+	if(z->f&FN) {
+		h=((z->f&FH)&&(a&0x0f)<6)?FH:0;
+		z->a=a-add;
+	} else {
+		h=(a&0x0f)>9?FH:0;
+		z->a=a+add;
+	}
+	z->f=szxyp[z->a]|h|(z->f&FN)|c;
+}
+static bool cond(z80_t *z,int y) {
+	switch(y) {
+		case 0: return !(z->f&FZ);
+		case 1: return z->f&FZ;
+		case 2: return !(z->f&FC);
+		case 3: return z->f&FC;
+		case 4: return !(z->f&FP);
+		case 5: return z->f&FP;
+		case 6: return !(z->f&FS);
+		default: return z->f&FS;
+	}
+}
+
+//
+// ---------------------------------------------------------------------------
+// z80Reset - state after RESET, the flag tables are made the first time
+// ---------------------------------------------------------------------------
+void z80Reset(z80_t *z) {
+	if(szxy[0]==0) {
+		for(int i=0;i<256;i++) {
+			uint8_t f=(i&(FS|FX|FY))|(i==0?FZ:0);
+			int p=i;
+			p^=p>>4;
+			p^=p>>2;
+			p^=p>>1;
+			szxy[i]=f;
+			szxyp[i]=f|((p&1)?0:FP);
+		}
+	}
+	memset(z,0,sizeof(z80_t));
+	z->sp=0xffff;
+	z->a=z->f=0xff;
+	z->ix=z->iy=0xffff;
+}
+
+// ED prefixed instructions
+static int edOp(z80_t *z) {
+	uint8_t op=fetchM1(z);
+	int x=op>>6,y=(op>>3)&7,zz=op&7,p=y>>1,q=y&1;
+	if(x==1) {
+		uint16_t nn;
+		uint8_t v;
+		switch(zz) {
+			case 0:
+				v=portIn(BC(z));
+				if(y!=6) set8(z,y,0,v);
+				z->f=(z->f&FC)|szxyp[v];
+				return 12;
+			case 1:
+				portOut(BC(z),y==6?0:get8(z,y,0));
+				return 12;
+			case 2:
+				if(q==0) setHL(z,sbc16(z,HL(z),getRP(z,p,0)));
+				else setHL(z,adc16(z,HL(z),getRP(z,p,0)));
+				return 15;
+			case 3:
+				nn=fetch16(z);
+				if(q==0) wr16(nn,getRP(z,p,0));
+				else setRP(z,p,0,rd16(nn));
+				return 20;
+			case 4:
+				v=z->a;
+				z->a=0;
+				alu(z,2,v);
+				return 8;
+			case 5:
+				z->pc=pop(z);
+				z->iff1=z->iff2;
+				return 14;
+			case 6:
+				z->im=(y&3)==2?1:(y&3)==3?2:0;
+				return 8;
+			default:
+				switch(y) {
+					case 0: z->i=z->a; return 9;
+					case 1: z->r=z->a; return 9;
+					case 2: z->a=z->i; z->f=(z->f&FC)|szxy[z->a]|(z->iff2?FP:0); return 9;
+					case 3: z->a=z->r; z->f=(z->f&FC)|szxy[z->a]|(z->iff2?FP:0); return 9;
+					case 4: { // rrd
+						uint8_t m=rd(HL(z));
+						wr(HL(z),(z->a<<4)|(m>>4));
+						z->a=(z->a&0xf0)|(m&0x0f);
+						z->f=(z->f&FC)|szxyp[z->a];
+						return 18;
+					}
+					case 5: { // rld
+						uint8_t m=rd(HL(z));
+						wr(HL(z),(m<<4)|(z->a&0x0f));
+						z->a=(z->a&0xf0)|(m>>4);
+						z->f=(z->f&FC)|szxyp[z->a];
+						return 18;
+					}
+					default: return 8;
+				}
+		}
+	}
+	if(x==2&&y>=4&&zz<=3) {
+		int dir=(y&1)?-1:1;
+		bool rep=y>=6;
+		uint16_t bc;
+		uint8_t v,n;
+		switch(zz) {
+			case 0: // ldi ldd ldir lddr
+				v=rd(HL(z));
+				wr(DE(z),v);
+				setHL(z,HL(z)+dir);
+				setDE(z,DE(z)+dir);
+				bc=BC(z)-1;
+				setBC(z,bc);
+				n=v+z->a;
+				z->f=(z->f&(FS|FZ|FC))|(bc?FP:0)|(n&FX)|((n<<4)&FY);
+				if(rep&&bc) {
+					z->pc-=2;
+					return 21;
+				}
+				return 16;
+			case 1: { // cpi cpd cpir cpdr
+				v=rd(HL(z));
+				uint8_t r=z->a-v;
+				setHL(z,HL(z)+dir);
+				bc=BC(z)-1;
+				setBC(z,bc);
+				z->f=(z->f&FC)|(szxy[r]&~(FX|FY))|FN|((z->a^v^r)&FH)|(bc?FP:0);
+				n=r-((z->f&FH)?1:0);
+				z->f|=(n&FX)|((n<<4)&FY);
+				if(rep&&bc&&r) {
+					z->pc-=2;
+					return 21;
+				}
+				return 16;
+			}
+			case 2: // ini ind inir indr
+				v=portIn(BC(z));
+				wr(HL(z),v);
+				setHL(z,HL(z)+dir);
+				z->b--;
+				z->f=szxy[z->b]|FN;
+				if(rep&&z->b) {
+					z->pc-=2;
+					return 21;
+				}
+				return 16;
+			default: // outi outd otir otdr
+				v=rd(HL(z));
+				z->b--;
+				portOut(BC(z),v);
+				setHL(z,HL(z)+dir);
+				z->f=szxy[z->b]|FN;
+				if(rep&&z->b) {
+					z->pc-=2;
+					return 21;
+				}
+				return 16;
+		}
+	}
+	return 8; // the rest are nops
+}
+
+// CB prefixed instructions, DDCB/FDCB with ix
+static int cbOp(z80_t *z,int ix) {
+	uint16_t addr=HL(z);
+	int t;
+	uint8_t op;
+	if(ix) {
+		int8_t d=fetch(z);
+		addr=(ix==1?z->ix:z->iy)+d;
+		op=fetch(z);
+		t=19; // plus the prefix
+	} else {
+		op=fetchM1(z);
+		t=8;
+	}
+	int x=op>>6,y=(op>>3)&7,r=op&7;
+	bool mem=ix||r==6;
+	uint8_t v=mem?rd(addr):get8(z,r,0);
+	if(mem&&!ix) t=15;
+	switch(x) {
+		case 0: v=rot(z,y,v); break;
+		case 1:
+			z->f=(z->f&FC)|FH|((v&(1<<y))?0:(FZ|FP))|((y==7&&(v&0x80))?FS:0)|(v&(FX|FY));
+			return ix?16:mem?12:8;
+		case 2: v&=~(1<<y); break;
+		default: v|=1<<y;
+	}
+	if(mem) {
+		wr(addr,v);
+		if(ix&&r!=6) set8(z,r,0,v); // undocumented copy into a register
+	} else set8(z,r,0,v);
+	return t;
+}
+
+//
+// ---------------------------------------------------------------------------
+// z80Step - run one instruction, or 4 T states of HALT
+// output:
+//   T states taken
+// ---------------------------------------------------------------------------
+int z80Step(z80_t *z) {
+	if(z->eiDelay) z->eiDelay--;
+	if(z->halted) {
+		rd(z->pc); // the byte after HALT, read & ignored
+		refresh(z);
+		z->cycles+=4;
+		return 4;
+	}
+	int ix=0,t=0;
+	uint8_t op=fetchM1(z);
+	while(op==0xdd||op==0xfd) {
+		ix=op==0xdd?1:2;
+		t+=4;
+		op=fetchM1(z);
+	}
+	if(op==0xcb) {
+		t+=cbOp(z,ix);
+		z->cycles+=t;
+		return t;
+	}
+	if(op==0xed) {
+		t+=edOp(z);
+		z->cycles+=t;
+		return t;
+	}
+	t+=cyc[op];
+	int x=op>>6,y=(op>>3)&7,zz=op&7,p=y>>1,q=y&1;
+	// (hl) becomes (ix+d) with a prefix, h & l become IXh & IXl except alongside (ix+d)
+	uint16_t maddr=HL(z);
+	bool usesMem=(x==1&&(y==6||zz==6)&&op!=0x76)||(x==2&&zz==6)||(x==0&&(zz==4||zz==5||zz==6)&&y==6);
+	if(ix&&usesMem) {
+		int8_t d=fetch(z);
+		maddr=(ix==1?z->ix:z->iy)+d;
+		t+=8;
+		if(x==0&&zz==6) t-=3; // ld (ix+d),n
+	}
+	uint16_t nn;
+	uint8_t v;
+	switch(x) {
+		case 0:
+			switch(zz) {
+				case 0:
+					if(y==0) break;
+					if(y==1) {
+						uint8_t ta=z->a,tf=z->f;
+						z->a=z->a_;
+						z->f=z->f_;
+						z->a_=ta;
+						z->f_=tf;
+						break;
+					}
+					{
+						int8_t d=fetch(z);
+						bool go;
+						if(y==2) {
+							z->b--;
+							go=z->b!=0;
+							if(go) t+=5;
+						} else if(y==3) go=true;
+						else {
+							go=cond(z,y-4);
+							if(go) t+=5;
+						}
+						if(go) z->pc+=d;
+					}
+					break;
+				case 1:
+					if(q==0) setRP(z,p,ix,fetch16(z));
+					else setRP(z,2,ix,add16(z,getRP(z,2,ix),getRP(z,p,ix)));
+					break;
+				case 2:
+					switch(y) {
+						case 0: wr(BC(z),z->a); break;
+						case 1: z->a=rd(BC(z)); break;
+						case 2: wr(DE(z),z->a); break;
+						case 3: z->a=rd(DE(z)); break;
+						case 4: wr16(fetch16(z),getRP(z,2,ix)); break;
+						case 5: setRP(z,2,ix,rd16(fetch16(z))); break;
+						case 6: wr(fetch16(z),z->a); break;
+						default: z->a=rd(fetch16(z));
+					}
+					break;
+				case 3:
+					setRP(z,p,ix,getRP(z,p,ix)+(q?-1:1));
+					break;
+				case 4:
+				case 5:
+					if(y==6) {
+						v=rd(maddr);
+						wr(maddr,zz==4?inc8(z,v):dec8(z,v));
+					} else {
+						v=get8(z,y,ix);
+						set8(z,y,ix,zz==4?inc8(z,v):dec8(z,v));
+					}
+					break;
+				case 6:
+					v=fetch(z);
+					if(y==6) wr(maddr,v);
+					else set8(z,y,ix,v);
+					break;
+				default:
+					switch(y) {
+						case 0: z->a=(z->a<<1)|(z->a>>7); z->f=(z->f&(FS|FZ|FP))|(z->a&(FC|FX|FY)); break;
+						case 1: z->f=(z->f&(FS|FZ|FP))|(z->a&FC); z->a=(z->a>>1)|(z->a<<7); z->f|=z->a&(FX|FY); break;
+						case 2: { uint8_t c=z->a>>7; z->a=(z->a<<1)|(z->f&FC); z->f=(z->f&(FS|FZ|FP))|c|(z->a&(FX|FY)); break; }
+						case 3: { uint8_t c=z->a&1; z->a=(z->a>>1)|((z->f&FC)<<7); z->f=(z->f&(FS|FZ|FP))|c|(z->a&(FX|FY)); break; }
+						case 4: daa(z); break;
+						case 5: z->a=~z->a; z->f=(z->f&(FS|FZ|FP|FC))|FH|FN|(z->a&(FX|FY)); break;
+						case 6: z->f=(z->f&(FS|FZ|FP))|FC|(z->a&(FX|FY)); break;
+						default: z->f=((z->f&(FS|FZ|FP|FC))|((z->f&FC)?FH:0)|(z->a&(FX|FY)))^FC;
+					}
+			}
+			break;
+		case 1:
+			if(op==0x76) {
+				z->halted=true;
+				break;
+			}
+			if(y==6) wr(maddr,get8(z,zz,0));
+			else if(zz==6) set8(z,y,0,rd(maddr));
+			else set8(z,y,ix,get8(z,zz,ix));
+			break;
+		case 2:
+			alu(z,y,zz==6?rd(maddr):get8(z,zz,ix));
+			break;
+		default:
+			switch(zz) {
+				case 0:
+					if(cond(z,y)) {
+						z->pc=pop(z);
+						t+=6;
+					}
+					break;
+				case 1:
+					if(q==0) {
+						uint16_t w=pop(z);
+						if(p==3) {
+							z->a=w>>8;
+							z->f=w;
+						} else setRP(z,p,ix,w);
+					} else switch(p) {
+						case 0: z->pc=pop(z); break;
+						case 1: {
+							uint8_t tb=z->b,tc=z->c,td=z->d,te=z->e,th=z->h,tl=z->l;
+							z->b=z->b_; z->c=z->c_; z->d=z->d_; z->e=z->e_; z->h=z->h_; z->l=z->l_;
+							z->b_=tb; z->c_=tc; z->d_=td; z->e_=te; z->h_=th; z->l_=tl;
+							break;
+						}
+						case 2: z->pc=getRP(z,2,ix); break;
+						default: z->sp=getRP(z,2,ix);
+					}
+					break;
+				case 2:
+					nn=fetch16(z);
+					if(cond(z,y)) z->pc=nn;
+					break;
+				case 3:
+					switch(y) {
+						case 0: z->pc=fetch16(z); break;
+						case 2: v=fetch(z); portOut((z->a<<8)|v,z->a); break;
+						case 3: v=fetch(z); z->a=portIn((z->a<<8)|v); break;
+						case 4: {
+							uint16_t w=rd16(z->sp);
+							wr16(z->sp,getRP(z,2,ix));
+							setRP(z,2,ix,w);
+							break;
+						}
+						case 5: {
+							uint16_t w=DE(z);
+							setDE(z,HL(z));
+							setHL(z,w);
+							break;
+						}
+						case 6: z->iff1=z->iff2=false; break;
+						default: z->iff1=z->iff2=true; z->eiDelay=1; break;
+					}
+					break;
+				case 4:
+					nn=fetch16(z);
+					if(cond(z,y)) {
+						push(z,z->pc);
+						z->pc=nn;
+						t+=7;
+					}
+					break;
+				case 5:
+					if(q==0) {
+						uint16_t w=p==3?(z->a<<8)|z->f:getRP(z,p,ix);
+						push(z,w);
+					} else {
+						nn=fetch16(z);
+						push(z,z->pc);
+						z->pc=nn;
+					}
+					break;
+				case 6:
+					alu(z,y,fetch(z));
+					break;
+				default:
+					push(z,z->pc);
+					z->pc=y*8;
+			}
+	}
+	z->cycles+=t;
+	return t;
+}
+
+//
+// ---------------------------------------------------------------------------
+// z80Irq - maskable interrupt with 0xff on the bus, IM0 & IM1 both RST 38
+// output:
+//   T states taken, 0 if interrupts are off
+// ---------------------------------------------------------------------------
+int z80Irq(z80_t *z) {
+	if(!z->iff1||z->eiDelay) return 0;
+	z->halted=false;
+	z->iff1=z->iff2=false;
+	refresh(z); // the acknowledge is an M1
+	push(z,z->pc);
+	int t;
+	if(z->im==2) {
+		z->pc=rd16((z->i<<8)|0xff);
+		t=19;
+	} else {
+		z->pc=0x0038;
+		t=13;
+	}
+	z->cycles+=t;
+	return t;
+}
+
+// E00 - invalid option
+// E01 - Spectrum ROM not a 16kB ROM or a ROM header
+// E02 - cannot open a ROM
+// E03 - ROM not as compressROM or Z80toROM make them
+// E04 - cannot open the catalog manifest
+// E05 - some ROMs failed, see the table
+// E06 - not enough memory
+void error(int errorcode) {
+	fprintf(stdout, "[E%02d]\n", errorcode);
+	exit(errorcode);
+}
@@ -22,10 +22,13 @@
 
 //v1.0 initial release
 //v1.1 added header to compressed ROM, limit names to 32chars
+//v1.2 -s flags a ROM as using the stream port, -x data file (any size up to 64kB) for it to stream
+//v1.3 -o writes the ROM as it is stored (header & compressed data) for the CMake catalog build
+//v1.4 compressed size no longer wraps at 64kB, a data file that doesn't compress grows past it
 
 void error(int errorcode);
-uint16_t simplelz(uint8_t* fload,uint8_t* store,uint16_t filesize);
-void printOut(FILE *fp,uint8_t *buffer,uint16_t filesize,char *name,uint8_t cm,char *oname,bool noCompression);
+uint32_t simplelz(uint8_t* fload,uint8_t* store,uint32_t filesize);
+void printOut(FILE *fp,uint8_t *buffer,uint32_t filesize,char *name,uint8_t cm,uint8_t flags,char *oname,bool noCompression);
 
 // convert binary ROM file to compressed const uint8_t array, pads 8kB ROMs with zeros if needed
 int main(int argc, char* argv[]) {
@@ -37,13 +40,17 @@ int main(int argc, char* argv[]) {
 		fprintf(stdout,"    -b produce binary file instead of header\n");
 		fprintf(stdout,"    -c check compression of binary file\n");
 		fprintf(stdout,"    -d do not compress just create header, also ignores size check\n");
+		fprintf(stdout,"    -s ROM reads data files through the stream port\n");
+		fprintf(stdout,"    -x data file for the stream port, any size up to 64kB\n");
+		fprintf(stdout,"    -o outfile write the ROM as it is stored, header & all, instead of a header file\n");
 		fprintf(stdout,"  if no displayname given infile filename will be used\n");
         exit(0);
     }
 	// check for options
 	bool padSpace=false,binaryOn=false,testCompression=false,noCompression=false;
 	unsigned int argNum=1;
-	uint8_t whichROM=0;
+	uint8_t whichROM=0,flags=0;
+	char *romOut=NULL;
 	while(argv[argNum][0]=='-') {
 		if(argv[argNum][1]=='p') {
 			padSpace=true;
@@ -55,6 +62,12 @@ int main(int argc, char* argv[]) {
 			noCompression=true;
 		} else if(argv[argNum][1]=='z') {
 			whichROM=1;
+		} else if(argv[argNum][1]=='s') {
+			flags|=0x02;	// stream port
+		} else if(argv[argNum][1]=='x') {
+			whichROM=4;
+		} else if(argv[argNum][1]=='o'&&argNum+1<(unsigned int)argc) {
+			romOut=argv[++argNum];
 		} else {
 			error(0);
 		}
@@ -64,14 +77,16 @@ int main(int argc, char* argv[]) {
     FILE *fp_in,*fp_out;
 	if ((fp_in=fopen(argv[argNum],"rb"))==NULL) error(1);
     fseek(fp_in,0,SEEK_END); // jump to the end of the file to get the length
-	uint16_t filesize=ftell(fp_in); // get the file size
+	long fileLen=ftell(fp_in); // get the file size
+	uint16_t filesize=fileLen;
     rewind(fp_in);
     //
 	if(padSpace==true&&filesize!=8192) error(2); // only pad 8kB ROMs
+	if(whichROM==4&&(fileLen==0||fileLen>65535||padSpace)) error(5); // data file too big
     uint8_t *readin;
 	unsigned int i,j;
 	if(testCompression==false) {
-		if(noCompression==false) {
+		if(noCompression==false&&whichROM!=4) {
     		if(filesize%8192!=0) error(2); // doesn't seem to be a ROM so error	
 		}
 		if(filesize>16384) {
@@ -89,9 +104,9 @@ int main(int argc, char* argv[]) {
     //
 	if(testCompression==false) {
 		uint8_t *comp;	
-		if((comp=malloc(filesize+(filesize/32)))==NULL) error(3); // cannot allocate memory for compression
-		uint16_t compsize;
 		if(padSpace==true) filesize=16384;
+		if((comp=malloc(filesize+(filesize/32)+2))==NULL) error(3); // cannot allocate memory for compression
+		uint32_t compsize; // a data file that doesn't compress is 1 byte in 128 bigger, past 64kB
 		if(noCompression==false) {
 			compsize=simplelz(readin,comp,filesize);
 		} else {
@@ -129,7 +144,16 @@ int main(int argc, char* argv[]) {
 			i++;
 		} while(i<32&&(argv[argNum][i]!='.'||i<strlen(argv[argNum])-4));
 		outName[i]=headerName[j]='\0';
-		if(binaryOn) {
+		if(romOut!=NULL) {
+			// 34byte header then the compressed ROM, exactly what ends up in flash
+			uint8_t head[34]={ whichROM,flags };
+			char *oname=argNum<argc-1?argv[argc-1]:outName;
+			for(i=0;i<32&&i<strlen(oname);i++) head[2+i]=oname[i];
+			if ((fp_out=fopen(romOut,"wb"))==NULL) error(1);
+			fwrite(head,sizeof(uint8_t),34,fp_out);
+			fwrite(comp,sizeof(uint8_t),compsize,fp_out);
+			fclose(fp_out);
+		} else if(binaryOn) {
 			strcat(fName,".bin");
 			if(strcmp(fName,argv[argNum])==0) strcat(fName,"1"); // just in case the same as the input file
 			if ((fp_out=fopen(fName,"wb"))==NULL) error(1); 
@@ -141,12 +165,12 @@ int main(int argc, char* argv[]) {
 			if(noCompression==false) {
 				fprintf(fp_out,"// ,%s",headerName);
 				for(i=strlen(headerName);i<35;i++) fprintf(fp_out," ");
-				fprintf(fp_out,"// xx - %dbytes\n",compsize+34);
+				fprintf(fp_out,"// xx - %ubytes\n",compsize+34);
 			}
 			if(argNum<argc-1) {
-				printOut(fp_out,comp,compsize,headerName,whichROM,argv[argc-1],noCompression);
+				printOut(fp_out,comp,compsize,headerName,whichROM,flags,argv[argc-1],noCompression);
 			} else {
-				printOut(fp_out,comp,compsize,headerName,whichROM,outName,noCompression);
+				printOut(fp_out,comp,compsize,headerName,whichROM,flags,outName,noCompression);
 			}
 			fclose(fp_out);
 		}
@@ -176,12 +200,12 @@ int main(int argc, char* argv[]) {
     return 0;
 }
 //
-void printOut(FILE *fp,uint8_t *buffer,uint16_t filesize,char *name,uint8_t cm,char *oname,bool noCompression) {
+void printOut(FILE *fp,uint8_t *buffer,uint32_t filesize,char *name,uint8_t cm,uint8_t flags,char *oname,bool noCompression) {
     unsigned int i,j;
     fprintf(fp,"    const uint8_t %s[]={ ",name);
 	if(noCompression==false) {
 		fprintf(fp,"0x%02x,",cm);	// compatibility mode
-		fprintf(fp,"0x00,");	// spare
+		fprintf(fp,"0x%02x,",flags);	// flags
 		j=0;
 		do {
 			if(j<strlen(oname)) fprintf(fp,"0x%02x,",oname[j]); 
@@ -201,7 +225,7 @@ void printOut(FILE *fp,uint8_t *buffer,uint16_t filesize,char *name,uint8_t cm,c
         }
     }
 	if(noCompression==false) fprintf(fp," };\n");
-	else fprintf(fp," };\n // %dbytes",filesize);
+	else fprintf(fp," };\n // %ubytes",filesize);
 }
 
 //
@@ -210,24 +234,24 @@ void printOut(FILE *fp,uint8_t *buffer,uint16_t filesize,char *name,uint8_t cm,c
 // x=128+ then copy sequence from x-offset from next byte offset 
 // x=0-127 then copy literal x+1 times
 // minimum sequence size 2
-uint16_t simplelz(uint8_t* fload,uint8_t* store,uint16_t filesize)
+uint32_t simplelz(uint8_t* fload,uint8_t* store,uint32_t filesize)
 {
-	uint16_t i;
+	uint32_t i;
 	uint8_t * store_p, * store_c;
 	uint8_t litsize = 1;
-	uint16_t repsize, offset, repmax, offmax;
+	uint32_t repsize, offset, repmax, offmax;
 	store_c = store;
 	store_p = store_c + 1;
 	//
 	i = 0;
 	*store_p++ = fload[i++];
-	do {
+	while (i < filesize) { // a 1 byte data file is just that byte
 		// scan for sequence
 		repmax = 2;
 		if (i > 255) offset = i - 256; else offset = 0;
 		do {
 			repsize = 0;
-			while (fload[offset + repsize] == fload[i + repsize] && i + repsize < filesize && repsize < 129) {
+			while (i + repsize < filesize && fload[offset + repsize] == fload[i + repsize] && repsize < 129) {
 				repsize++;
 			}
 			if (repsize > repmax) {
@@ -256,7 +280,7 @@ uint16_t simplelz(uint8_t* fload,uint8_t* store,uint16_t filesize)
 				litsize = 0;
 			}
 		}
-	} while (i < filesize);
+	}
 	if (litsize > 0) {
 		*store_c = litsize - 1;
 		store_c = store_p++;
@@ -270,6 +294,7 @@ uint16_t simplelz(uint8_t* fload,uint8_t* store,uint16_t filesize)
 // E02 - incorrect ROM file
 // E03 - cannot allocate memory
 // E04 - problem reading ROM file
+// E05 - data file empty or over 64kB
 void error(int errorcode) {
 	fprintf(stdout, "[E%02d]\n", errorcode);
 	exit(errorcode);
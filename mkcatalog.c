@@ -0,0 +1,127 @@
+// mkcatalog - pull a ROM out of its header file for the CMake catalog build
+//
+// mkcatalog is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// mkcatalog is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with mkcatalog. If not, see <http://www.gnu.org/licenses/>.
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//v1.0 initial release
+
+// The catalog build (romcatalog.cmake) links every ROM into the firmware as
+// a binary object rather than compiling a header of 0x%02x literals for it.
+// ROMs given as files to convert go straight through compressROM or Z80toROM
+// with -o, ROMs that only exist as a header made by one of them, like the
+// ones in rominc, come through here. The output is the ROM as it is stored,
+// 34byte header & compressed data, checked so a damaged header stops the
+// build rather than the Pico.
+//
+// usage: mkcatalog rom.h outfile.bin
+
+#define MAXROM (8*16384+34)    // largest a ROM can be, a 128k snapshot that doesn't compress at all
+
+void error(int errorcode);
+uint32_t readHeader(char *fname,uint8_t *to,uint32_t max);
+bool romCheck(const uint8_t *from,uint32_t size);
+
+int main(int argc, char* argv[]) {
+	if (argc < 3) {
+		fprintf(stdout,"Usage mkcatalog rom.h outfile.bin\n");
+		fprintf(stdout,"  rom.h is a header file made by compressROM or Z80toROM\n");
+		exit(0);
+	}
+	static uint8_t rom[MAXROM];
+	uint32_t len=readHeader(argv[1],rom,MAXROM);
+	if(!romCheck(rom,len)) error(4);
+	FILE *fp_out;
+	if ((fp_out=fopen(argv[2],"wb"))==NULL) error(1);
+	if(fwrite(rom,sizeof(uint8_t),len,fp_out)!=len) error(1);
+	fclose(fp_out);
+	return 0;
+}
+
+//
+// ---------------------------------------------------------------------------
+// readHeader - the bytes of the array in a ROM header file, the comment line
+// with the ROM name & size before it is skipped
+// ---------------------------------------------------------------------------
+uint32_t readHeader(char *fname,uint8_t *to,uint32_t max) {
+	FILE *fp_in;
+	if ((fp_in=fopen(fname,"rb"))==NULL) error(2);
+	int c;
+	uint32_t len=0;
+	bool inArray=false;
+	while((c=fgetc(fp_in))!=EOF) {
+		if(!inArray) {
+			if(c=='{') inArray=true;
+			else if(c=='/') { // skip the comment line so a { in the name can't confuse things
+				while((c=fgetc(fp_in))!=EOF&&c!='\n');
+			}
+		} else if(c=='}') {
+			break;
+		} else if(c=='x'||c=='X') {
+			unsigned int v;
+			if(fscanf(fp_in,"%2x",&v)!=1) error(3);
+			if(len>=max) error(3);
+			to[len++]=v;
+		}
+	}
+	fclose(fp_in);
+	return len;
+}
+
+//
+// ---------------------------------------------------------------------------
+// romCheck - the header has a mode the firmware knows & the compressed
+// streams end exactly at the end, the same test the Pico does on uploads
+// ---------------------------------------------------------------------------
+bool romCheck(const uint8_t *from,uint32_t size) {
+	if(size<35||from[0]==2||from[0]==6||from[0]==7||from[0]>8) return false;
+	uint32_t b=1,j=34;
+	if(from[1]&0x04) b=from[0]==5?2:from[0]+1; // streamed launch, loader ROM then the RAM banks or tape
+	else if(from[1]&0x01) b=from[0]; // 128k snapshot, bank by bank
+	if(from[1]&0x08) { // banks left out of a sparse snapshot, the bitmap is at 0x31 of ROM 0
+		uint8_t bank0[0x32];
+		uint32_t i=0,k,jj=34;
+		while(i<sizeof(bank0)&&jj<size) {
+			uint8_t c=from[jj++];
+			if(c==128) break;
+			else if(c<128) for(k=0;k<c+1u&&i<sizeof(bank0)&&jj<size;k++) bank0[i++]=from[jj++];
+			else {
+				uint8_t o=from[jj++];
+				for(k=0;k<c-126u&&i<sizeof(bank0);k++,i++) bank0[i]=i>o?bank0[i-(o+1)]:0;
+			}
+		}
+		if(i<sizeof(bank0)) return false;
+		for(k=0;k<8;k++) if(bank0[0x31]&(1<<k)) b--;
+	}
+	while(b&&j<size) {
+		uint8_t c=from[j++];
+		if(c<128) j+=c+1;
+		else if(c>128) j++;
+		else b--;
+	}
+	return b==0&&j==size;
+}
+
+// E01 - cannot open output file
+// E02 - cannot open the ROM header file
+// E03 - ROM header file not as compressROM or Z80toROM make them
+// E04 - ROM damaged, the compressed data doesn't match its header
+void error(int errorcode) {
+	fprintf(stdout, "[E%02d]\n", errorcode);
+	exit(errorcode);
+}
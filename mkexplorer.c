@@ -0,0 +1,209 @@
+// mkexplorer - build the ROM Explorer image for ZX PicoIF2Lite at compile time
+// 
+// mkexplorer is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// mkexplorer is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with mkexplorer. If not, see <http://www.gnu.org/licenses/>. 
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef ROM_CATALOG
+const uint8_t **roms;           // ROMs as stored, read from the files the catalog build gives
+#else
+#include "picoif2lite_lite.h"   // same ROM list the firmware is built with
+#endif
+
+//v1.0 initial release, moved out of the firmware boot
+//v1.1 menu text now served a page at a time by the Pico, just unpacks the ROM Explorer
+//v1.2 ROMs sorted by name for the ROM Explorer search
+//v1.3 built with ROM_CATALOG reads the ROMs from files, output only rewritten when it changes
+
+// Unpacking the ROM Explorer used to run in main() on every power on, it
+// only depends on the ROMs compiled in so is done once on the host by CMake
+// instead. The output is the unpacked 16kB ROM Explorer image as a const
+// array the firmware simply copies, the menu text & counts are patched in
+// by the Pico a page at a time. It also writes romOrder, ROMs 1 onwards
+// sorted by name ignoring case, which the Pico searches as the name is typed.
+//
+// The catalog build (romcatalog.cmake) doesn't compile the ROM headers, it
+// builds this with ROM_CATALOG & gives it the ROM files in menu order instead.
+// The output is left alone if nothing in it changed, so changing a ROM
+// without changing its name doesn't recompile the firmware.
+//
+// usage: mkexplorer outfile.h
+//        mkexplorer outfile.h rom0.bin rom1.bin ... (built with ROM_CATALOG)
+
+void error(int errorcode);
+const uint8_t *readRom(char *fname);
+bool sameFile(char *a,char *b);
+void dtoBuffer(uint8_t *to,const uint8_t *from);
+int nameCmp(const void *a,const void *b);
+
+int main(int argc, char* argv[]) {
+#ifdef ROM_CATALOG
+	if (argc < 3) {
+		fprintf(stdout,"Usage mkexplorer outfile.h rom0.bin rom1.bin ...\n");
+		exit(0);
+	}
+	const unsigned int MAXROMS=argc-2;
+	if((roms=malloc(MAXROMS*sizeof(roms[0])))==NULL) error(3);
+	for(unsigned int r=0;r<MAXROMS;r++) roms[r]=readRom(argv[r+2]);
+#else
+	if (argc < 2) {
+		fprintf(stdout,"Usage mkexplorer outfile.h\n");
+		exit(0);
+	}
+	const unsigned int MAXROMS=sizeof(roms)/sizeof(roms[0]);
+#endif
+	if(MAXROMS>65535) error(2); // ROM numbers are 16bit
+	static uint8_t romSelector[16384];
+	unsigned int i;
+	// ---------------------------------------------------------------------
+	//   ** this is specific to the ROM Explorer ROM **
+	// ---------------------------------------------------------------------
+	dtoBuffer(romSelector,roms[0]); // ROM Explorer ROM into romSelector
+	// write out
+	FILE *fp_out;
+	char tmpName[1024];
+	snprintf(tmpName,sizeof(tmpName),"%s.tmp",argv[1]);
+	if ((fp_out=fopen(tmpName,"wb"))==NULL) error(1); 
+	fprintf(fp_out,"// generated by mkexplorer from picoif2lite_lite.h - do not edit\n");
+	fprintf(fp_out,"    const uint8_t romExplorer[16384]={ ");
+	for(i=0;i<16384;i++) {
+		if((i%32)==0&&i!=0) {
+			fprintf(fp_out,"\n");
+			for(unsigned int j=0;j<39;j++) fprintf(fp_out," ");   
+		}
+		fprintf(fp_out,"0x%02x",romSelector[i]);
+		if(i<16383) {
+			fprintf(fp_out,",");
+		}
+	}
+	fprintf(fp_out," };\n");
+	// name order, at least one entry so the array is never empty
+	static uint16_t order[65535];
+	for(i=1;i<MAXROMS;i++) order[i-1]=i;
+	qsort(order,MAXROMS-1,sizeof(order[0]),nameCmp);
+	fprintf(fp_out,"    const uint16_t romOrder[%d]={ ",MAXROMS>1?MAXROMS-1:1);
+	for(i=0;i<MAXROMS-1;i++) {
+		if((i%16)==0&&i!=0) {
+			fprintf(fp_out,"\n");
+			for(unsigned int j=0;j<32;j++) fprintf(fp_out," ");
+		}
+		fprintf(fp_out,"%d",order[i]);
+		if(i<MAXROMS-2) {
+			fprintf(fp_out,",");
+		}
+	}
+	if(MAXROMS<2) fprintf(fp_out,"0");
+	fprintf(fp_out," };\n");
+	fclose(fp_out);
+	// only replace the output if it changed, it is what the firmware depends on
+	if(sameFile(tmpName,argv[1])) {
+		remove(tmpName);
+	} else {
+		remove(argv[1]);
+		if(rename(tmpName,argv[1])!=0) error(1);
+	}
+	return 0;
+}
+
+//
+// ---------------------------------------------------------------------------
+// readRom - a whole ROM file, header & compressed data as made by the catalog
+// build, into memory
+// ---------------------------------------------------------------------------
+const uint8_t *readRom(char *fname) {
+	FILE *fp_in;
+	uint8_t *rom;
+	if ((fp_in=fopen(fname,"rb"))==NULL) error(4);
+	fseek(fp_in,0,SEEK_END);
+	long len=ftell(fp_in);
+	rewind(fp_in);
+	if(len<35) error(4);
+	if((rom=malloc(len))==NULL) error(3);
+	if(fread(rom,sizeof(uint8_t),len,fp_in)!=(size_t)len) error(4);
+	fclose(fp_in);
+	return rom;
+}
+
+//
+// ---------------------------------------------------------------------------
+// sameFile - true if both files are there & have the same bytes
+// ---------------------------------------------------------------------------
+bool sameFile(char *a,char *b) {
+	FILE *fa,*fb;
+	int ca,cb;
+	if ((fa=fopen(a,"rb"))==NULL) return false;
+	if ((fb=fopen(b,"rb"))==NULL) {
+		fclose(fa);
+		return false;
+	}
+	do {
+		ca=fgetc(fa);
+		cb=fgetc(fb);
+	} while(ca==cb&&ca!=EOF);
+	fclose(fa);
+	fclose(fb);
+	return ca==cb;
+}
+
+//
+// ---------------------------------------------------------------------------
+// dtoBuffer - decompress compressed ROM directly into buffer (simple LZ)
+// ---------------------------------------------------------------------------
+void dtoBuffer(uint8_t *to,const uint8_t *from) { 
+	unsigned int i=0,j=34,k; // start j at 34 to skip header
+	uint8_t c,o;
+	do {
+		c=from[j++];
+		if(c==128) return;
+		else if(c<128) {
+			for(k=0;k<c+1;k++) to[i++]=from[j++];
+		}
+		else {
+			o=from[j++]; // offset
+			for(k=0;k<(c-126);k++) {
+				to[i]=to[i-(o+1)];
+				i++;
+			}
+		}
+	} while(true);
+}
+
+//
+// ---------------------------------------------------------------------------
+// nameCmp - qsort order of two ROM numbers by the name in their headers,
+// upper case, the same order the firmware's search expects
+// ---------------------------------------------------------------------------
+int nameCmp(const void *a,const void *b) {
+	uint16_t ra=*(const uint16_t *)a,rb=*(const uint16_t *)b;
+	for(unsigned int i=2;i<34;i++) {
+		uint8_t ca=roms[ra][i],cb=roms[rb][i];
+		if(ca>='a'&&ca<='z') ca-=32;
+		if(cb>='a'&&cb<='z') cb-=32;
+		if(ca!=cb) return ca-cb;
+		if(ca==0) break;
+	}
+	return ra-rb; // same name, keep menu order
+}
+
+// E01 - cannot open output file
+// E02 - too many ROMs (max 65535)
+// E03 - not enough memory
+// E04 - cannot read a ROM file
+void error(int errorcode) {
+	fprintf(stdout, "[E%02d]\n", errorcode);
+	exit(errorcode);
+}
@@ -0,0 +1,240 @@
+// packROM - build a ROM pack UF2 for ZX PicoIF2Lite
+// 
+// packROM is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// 
+// packROM is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+// 
+// You should have received a copy of the GNU General Public License
+// along with packROM. If not, see <http://www.gnu.org/licenses/>. 
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//v1.0 initial release
+//v1.1 pack can go anywhere in flash, flash size option, up to 65534 ROMs
+//v1.2 no menu text, the Pico builds each page from the ROM headers
+//v1.3 ROMs sorted by name for the ROM Explorer search (pack version 4)
+//v1.4 pack must end below the firmware's flash store
+//v1.5 the index is in the checksum & the pack carries when it was made (pack version 5)
+
+// Packs ROM headers made by compressROM or Z80toROM into one image that is
+// flashed on its own, well above the firmware, so the ROM list can be changed
+// by dropping a small UF2 onto the Pico instead of rebuilding the firmware.
+// The layout must match pack_t in picoif2lite.c (all little endian):
+//   0x00 magic "PPAK", version, count, size, made, check
+//   0x14 count x uint32 offset of each ROM from the start of the pack
+//        count x uint16 ROM numbers (1 onwards) sorted by name ignoring
+//        case, padded to a word
+//        the ROMs themselves (34byte header & compressed data) in order,
+//        word aligned with 0xff
+// made is the time the pack was made & check is the sum of the header bytes
+// before it and of the offsets & ROM numbers, the firmware ignores the pack
+// if it is wrong. The firmware looks for a pack in every flash sector after
+// the program so any sector aligned offset will do, as long as the pack ends
+// before the flash store below the settings, & uses the newest it finds. The
+// ROM Explorer itself stays in the firmware as ROM 0.
+//
+// usage: packROM <options> outfile.uf2 rom1.h rom2.h ...
+
+#define PACK_OFFSET  0x100000   // default flash offset of the pack
+#define PACK_MAGIC   0x4b415050 // "PPAK"
+#define PACK_VERSION 5
+#define PACK_HEADER  20
+#define MAXPACK      65534      // plus the ROM Explorer, ROM numbers are 16bit
+#define SECTOR       4096
+#define STORE_SIZE   (32*SECTOR) // firmware's flash store, below the settings in the last sector
+#define XIP_BASE     0x10000000
+#define UF2_FAMILY   0xe48bff56 // RP2040
+
+void error(int errorcode);
+uint32_t readHeader(char *fname,uint8_t *to,uint32_t max);
+void put16(uint8_t *p,uint16_t v);
+void put32(uint8_t *p,uint32_t v);
+int nameCmp(const void *a,const void *b);
+
+uint8_t *pack;
+uint32_t romAt[MAXPACK];      // offset of each ROM in the pack
+
+int main(int argc, char* argv[]) {
+	if (argc < 3) {
+		fprintf(stdout,"Usage packROM <options> outfile.uf2 rom1.h rom2.h ...\n");
+		fprintf(stdout,"  Options:\n");
+		fprintf(stdout,"    -b also write the raw pack to outfile.bin\n");
+		fprintf(stdout,"    -a flash offset of the pack in hex, default 100000 (1MB)\n");
+		fprintf(stdout,"    -f flash size in MB, default 2\n");
+		fprintf(stdout,"  ROMs are header files made by compressROM or Z80toROM, in menu order\n");
+		exit(0);
+	}
+	// check for options
+	bool binaryOn=false;
+	uint32_t packOffset=PACK_OFFSET,flashSize=2;
+	int argNum=1;
+	while(argNum<argc&&argv[argNum][0]=='-') {
+		if(argv[argNum][1]=='b') {
+			binaryOn=true;
+		} else if(argv[argNum][1]=='a'&&argNum+1<argc) {
+			packOffset=strtoul(argv[++argNum],NULL,16);
+		} else if(argv[argNum][1]=='f'&&argNum+1<argc) {
+			flashSize=strtoul(argv[++argNum],NULL,10);
+		} else {
+			error(1); // unknown option
+		}
+		argNum++;
+	}
+	if(argNum>=argc-1) error(1);
+	char *outName=argv[argNum++];
+	unsigned int count=argc-argNum;
+	if(count>MAXPACK) error(2);
+	// from the offset up to the flash store, below the settings in the last sector
+	if(flashSize<2||flashSize>16||(flashSize&(flashSize-1))!=0) error(1);
+	flashSize<<=20;
+	if((packOffset%SECTOR)!=0||packOffset>=flashSize-SECTOR-STORE_SIZE) error(1);
+	uint32_t packMax=flashSize-SECTOR-STORE_SIZE-packOffset;
+	pack=malloc(packMax);
+	if(pack==NULL) error(3);
+	memset(pack,0xff,packMax);
+	// index straight after the header, then the name order, then the ROMs
+	static uint8_t rom[262144];
+	static uint32_t romLen[MAXPACK];
+	static uint16_t order[MAXPACK];
+	uint32_t i;
+	uint32_t size=(PACK_HEADER+count*6+3)&~3;
+	if(size>packMax) error(6);
+	for(i=0;i<count;i++) {
+		romLen[i]=readHeader(argv[argNum+i],rom,sizeof(rom));
+		if(romLen[i]<35) error(4);
+		if(size+romLen[i]>packMax) error(6);
+		memcpy(&pack[size],rom,romLen[i]);
+		put32(&pack[PACK_HEADER+i*4],size);
+		romAt[i]=size;
+		size=(size+romLen[i]+3)&~3;
+		order[i]=i+1;
+	}
+	qsort(order,count,sizeof(order[0]),nameCmp);
+	for(i=0;i<count;i++) put16(&pack[PACK_HEADER+count*4+i*2],order[i]);
+	put32(&pack[0x00],PACK_MAGIC);
+	put16(&pack[0x04],PACK_VERSION);
+	put16(&pack[0x06],count);
+	put32(&pack[0x08],size);
+	put32(&pack[0x0c],(uint32_t)time(NULL));
+	uint32_t check=0;
+	for(i=0;i<0x10;i++) check+=pack[i];
+	for(i=0;i<count*6;i++) check+=pack[PACK_HEADER+i];
+	put32(&pack[0x10],check);
+	// UF2, 256 bytes of pack per 512 byte block
+	FILE *fp_out;
+	if ((fp_out=fopen(outName,"wb"))==NULL) error(7);
+	uint32_t blocks=(size+255)/256;
+	uint8_t block[512];
+	for(i=0;i<blocks;i++) {
+		memset(block,0,512);
+		put32(&block[0],0x0a324655);
+		put32(&block[4],0x9e5d5157);
+		put32(&block[8],0x00002000); // family ID present
+		put32(&block[12],XIP_BASE+packOffset+i*256);
+		put32(&block[16],256);
+		put32(&block[20],i);
+		put32(&block[24],blocks);
+		put32(&block[28],UF2_FAMILY);
+		memcpy(&block[32],&pack[i*256],256);
+		put32(&block[508],0x0ab16f30);
+		if(fwrite(block,1,512,fp_out)!=512) error(7);
+	}
+	fclose(fp_out);
+	if(binaryOn) {
+		char binName[1024];
+		snprintf(binName,sizeof(binName)-4,"%s",outName);
+		char *dot=strrchr(binName,'.');
+		if(dot!=NULL) *dot=0;
+		strcat(binName,".bin");
+		if ((fp_out=fopen(binName,"wb"))==NULL) error(7);
+		fwrite(pack,1,size,fp_out);
+		fclose(fp_out);
+	}
+	for(i=0;i<count;i++) fprintf(stdout,"%3d - %6dbytes - %s\n",i+1,romLen[i],argv[argNum+i]);
+	fprintf(stdout,"%d ROMs, pack %d bytes at flash offset 0x%06x\n",count,size,packOffset);
+	free(pack);
+	return 0;
+}
+
+//
+// ---------------------------------------------------------------------------
+// readHeader - pull the bytes back out of a compressROM/Z80toROM header, the
+// array is the comma separated 0x.. values between { and }
+// ---------------------------------------------------------------------------
+uint32_t readHeader(char *fname,uint8_t *to,uint32_t max) {
+	FILE *fp_in;
+	if ((fp_in=fopen(fname,"rb"))==NULL) error(8);
+	int c;
+	uint32_t len=0;
+	bool inArray=false;
+	while((c=fgetc(fp_in))!=EOF) {
+		if(!inArray) {
+			if(c=='{') inArray=true;
+			else if(c=='/') { // skip the comment line so a { in the name can't confuse things
+				while((c=fgetc(fp_in))!=EOF&&c!='\n');
+			}
+		} else if(c=='}') {
+			break;
+		} else if(c=='x'||c=='X') {
+			unsigned int v;
+			if(fscanf(fp_in,"%2x",&v)!=1) error(4);
+			if(len>=max) error(6);
+			to[len++]=v;
+		}
+	}
+	fclose(fp_in);
+	return len;
+}
+
+void put16(uint8_t *p,uint16_t v) {
+	p[0]=v;
+	p[1]=v>>8;
+}
+
+void put32(uint8_t *p,uint32_t v) {
+	p[0]=v;
+	p[1]=v>>8;
+	p[2]=v>>16;
+	p[3]=v>>24;
+}
+
+//
+// ---------------------------------------------------------------------------
+// nameCmp - qsort order of two ROM numbers by the name in their headers,
+// upper case, the same order the firmware's search expects
+// ---------------------------------------------------------------------------
+int nameCmp(const void *a,const void *b) {
+	uint16_t ra=*(const uint16_t *)a,rb=*(const uint16_t *)b;
+	const uint8_t *ha=&pack[romAt[ra-1]],*hb=&pack[romAt[rb-1]];
+	for(unsigned int i=2;i<34;i++) {
+		uint8_t ca=ha[i],cb=hb[i];
+		if(ca>='a'&&ca<='z') ca-=32;
+		if(cb>='a'&&cb<='z') cb-=32;
+		if(ca!=cb) return ca-cb;
+		if(ca==0) break;
+	}
+	return ra-rb; // same name, keep menu order
+}
+
+// E01 - bad options
+// E02 - too many ROMs (max 65534 plus the ROM Explorer)
+// E03 - out of memory
+// E04 - not a ROM header file
+// E06 - pack too big for the flash between the offset & the flash store
+// E07 - cannot write output file
+// E08 - cannot open ROM header file
+void error(int errorcode) {
+	fprintf(stdout, "[E%02d]\n", errorcode);
+	exit(errorcode);
+}
@@ -5,21 +5,51 @@
 // v0.4 fixed issue with not loading correctly on earlier Spectrums, needed i register setting at 0x80
 // v0.5 big ZX Spectrum machine code refactoring, LED matches ROMCS on/off, attempt to fix crash on reset
 // v0.6 simplified ROM includes, added header to each ROM to replace romName & compatMode 
+// v0.8 SRAM cache of unpacked ROMs for instant switching, housekeeping on core 1 with USB stats
+//      lazy bank by bank unpacking of 128k snapshots on core 1, launch timing over USB
+//      ROM Explorer image built at compile time by mkexplorer, no compression at boot
+//      last selected ROM saved to flash, optional fast boot straight into it
+//      command window handshake for ROM selection, 16bit ROM numbers
+//      bus watchdog, resets & relaunches failed launches
+//      ROM pack, ROM list can be flashed on its own (packROM) without rebuilding
+//      flash size detected, ROM pack found anywhere in flash, up to 65534 ROMs
+//      ROM Explorer menu served a page at a time by core 1, cursor kept by the Pico
+//      ROM Explorer search, typing a name narrows the menu to the ROMs starting with it
+//      ROM Explorer snapshot preview, loading screen decoded by core 1 on demand
+//      ROM Explorer pages drawn by core 1, the Spectrum just copies them to the screen
+//      stream port, ROMs flagged for it can read data entries from the catalogue a byte at a time
+//      streamed snapshot launch, RAM banks unpacked by core 1 & read by the loader through the stream port
+//      tape mode (TAPtoROM), 48k ROM with LD-BYTES reading the TAP's blocks through the stream port
+//      USB shell, list the ROMs, select one & show the counters without touching the button
+//      USB upload, a ROM sent over USB is unpacked into the cache as it arrives & goes in at the next reset
+//      flash store, ROMs sent over USB kept in a log below the settings & added to the catalogue at power on
+//      sequencer, a list of ROMs run in turn for a set time each, moving on early when one parks or fails to launch
 //
 #define PROG_NAME   "ZX PicoIF2Lite"
-#define VERSION_NUM "v0.6"
+#define VERSION_NUM "v0.8"
 // ---------------------------------------------------------------------------
 // includes
 // ---------------------------------------------------------------------------
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <inttypes.h>
 #include "pico/stdlib.h"
+#include "pico/multicore.h"
 #include "hardware/pio.h"
+#include "hardware/sync.h"
+#include "hardware/flash.h"
+#include "hardware/structs/iobank0.h"
 #include "picoif2lite.pio.h"
 //#include "picoif2lite.h"   // header
 //#include "picoif2lite_jh.h"   // header
+#ifdef ROM_CATALOG
+#include "catalog_gen.h"        // ROMs from the catalog manifest, generated by romcatalog.cmake
+#else
 #include "picoif2lite_lite.h"   // header (lite version for GitHub)
+#endif
+#include "romexplorer_gen.h"    // ROM Explorer with menu text for the above, generated by mkexplorer
 // ---------------------------------------------------------------------------
 // gpio pins
 // ---------------------------------------------------------------------------
@@ -41,61 +71,399 @@
 #define lkMask   0b0011111111100000
 #define bkMask   0b0000000000001111
 //
-const uint8_t MAXROMS=*(&roms + 1) - roms; // test
+// command window - Spectrum code talks to the Pico by reading 0x3e00-0x3eff,
+// the low byte of each address read is one byte of a command frame:
+//   0xa5 0x5a cmd lo hi chk    (chk=cmd^lo^hi^0xff)
+// reads outside the window are ignored, a byte out of sequence or a bad
+// checksum restarts the frame. Commands:
+//   0x01 select ROM lo+hi*256
+//   0x02 ROM Explorer key lo (bits as read by the ROM Explorer), moves the cursor,
+//        bit 5 is a letter, digit, space or delete (0x08) in hi for the search,
+//        bit 6 draws the page again (after a preview)
+//   0x03 loading screen of snapshot lo+hi*256 into the screen window
+//   0x04 stream port, opens the data entry lo+hi*256 after the ROM (0 its own RAM
+//        banks), reply +1-+4 its length, +5 set if a read ran the ring dry
+//   0x05 tape mode, lo 1 opens the tape window & 0 closes it, TAPtoROM's
+//        LD-BYTES has it open while it loads with interrupts off
+// commands with an answer clear byte 0 of the reply window straight away and
+// set it to 1 once the rest of the reply is there, the Spectrum polls it:
+//   +0 ready, +1 bit0 new page in the text & screen windows, bit1 snapshot
+//   screen in the screen window, +2 cursor row, +3 page bar position,
+//   +4/+5 ROM under the cursor
+#define CMD_WINDOW   0x3e00
+#define CMD_SELECT   0x01
+#define CMD_KEY      0x02
+#define CMD_PREVIEW  0x03
+#define CMD_STREAM   0x04
+#define CMD_TAPE     0x05
+#define TEXT_WINDOW  0x1e00 // menu text for the page being shown, read in place by the ROM Explorer
+#define SCREEN_WINDOW 0x2300 // 6912byte Spectrum screen, copied to 0x4000 by the ROM Explorer
+#define REPLY_WINDOW 0x3f00
+#define STREAM_WINDOW 0x3d00 // any read here is the next byte of the open stream
+#define STREAM_RING  2048   // bytes core 1 keeps unpacked ahead of the Spectrum, power of 2
+#define TAPE_WINDOW  0x3900 // stream port for tape mode, in the spare space of the 48k ROM. Only
+                            // there while LD-BYTES has it open, IM2 vector tables read 0xff there
+#define MENU_ROWS    21     // ROMs per page
+#define MENU_BARS    5      // ROM Explorer page bar patterns, the one for 6 runs on into code
+#define MENU_TITLE   0x02a9 // ROM Explorer title, replaced by the search while there is one
+#define MENU_QUERY   16     // longest search
+#define MENU_SLOTS   2      // ROM Explorer pages kept ready drawn, all but the first in bank1
+//
+// ** this is specific to the ROM Explorer ROM **, what it draws a page with
+#define EXP_BACKDROP 0x067f // screen background, simple LZ
+#define EXP_FONT     0x01f8 // 8 bytes a character, drawn from 0x1a up
+#define EXP_WIDTHS   0x05de // pixels a character
+#define EXP_BARS     0x0080 // page bar, pixel rows of each part for 1-5 parts at 6 bytes each
+//
+// bus watchdog (core 1), watches the ROM reads counted by the serving loop
+#define WD_LAUNCH_US 1000000  // no ROM reads at all this long after RESET lifted = failed launch
+#define WD_LOAD_US   3000000  // snapshot loader should have switched the interface off by now
+#define WD_IM1_MIN   25       // IM1 (0x0038) reads in a second for a relaunch to count as running, 50 normally
+#define WD_IM1_MAX   100      // more than this is refresh cycles with I=0 hitting 0x0038, not IM1
+#define WD_RETRIES   3        // resets before giving up, wait doubles each time from 100ms
+#define SHELL_LINE   80       // longest USB shell command
+#define SHELL_SERVE_US 1000000 // no ROM read this long after a shell select is reported as such
+#define UPLOAD_BUSY  -2       // cacheRom of the slots a USB upload is going into or waiting in
+#define UPLOAD_IDLE_US 2000000 // upload given up when nothing arrives for this long
+#define SEQ_STAGES   16       // ROMs in a sequence
+#define SEQ_TEXT     512      // longest sequence entry read from the catalogue
+#define SEQ_SECONDS  60       // stage length when none is given
+#define SEQ_PARK     2        // a parked program (DI HALT, JR $) keeps reading addresses less than this apart
+#define SEQ_PARK_SHARE 45     // % of the samples they are, refresh cycles make up the rest while I is below 0x40 (DI HALT 50%)
+#define SEQ_PARK_SLOTS 8      // address ranges counted at once, any with more than 1/8 of the samples is among them
+#define SEQ_PARK_US  3000000  // parked this long with no IM1 = the stage has finished
+#define SEQ_SAMPLE_US 1000    // how often the sequencer samples the address being read
+//
+#define CACHE_SLOTS 4      // 16kB slots of spare SRAM kept for unpacked ROMs
+#define SRAM_SIZE (256*1024) // RP2040 SRAM, less the two 4kB scratch banks the stacks are in
+#define SRAM_SDK (24*1024)   // left over for the SDK, the USB stack, code run from SRAM & the heap
+                             // of which the SDK's defaults need about 8kB: the 2kB heap (PICO_HEAP_SIZE),
+                             // TinyUSB with its 256 byte CDC buffers 2kB, newlib's reent & stdio 1kB,
+                             // the SDK's .data with the vector table & flash routines copied to SRAM
+                             // 2kB, romServe() & cmdByte() 1kB. 24kB leaves it room to grow threefold
+#define CACHE_MAXSIZE 32768 // largest ROM held in the cache (2 slots), bigger ones go in bank1
+#define FLAG_BANKED 0x01    // header byte 1, each 16kB bank compressed on its own (Z80toROM 128k snapshots)
+#define FLAG_STREAM 0x02    // header byte 1, ROM uses the stream port so 0x3d00-0x3fff are left to the Pico
+#define FLAG_LAUNCH 0x04    // header byte 1, a 16kB loader ROM then its own data streamed to it, each RAM
+                            // bank of a Z80toROM -l snapshot or the blocks of a TAPtoROM tape (mode 5)
+#define FLAG_SPARSE 0x08    // header byte 1, 128k banks that are all one value are left out & filled by the
+                            // loader, bit per bank in byte SNAP_SPARSE of the unpacked ROM 0
+#define SNAP_SPARSE 0x31    // Z80toROM loader byte holding the banks left out of a FLAG_SPARSE snapshot
+#define SNAP_LOADER 236     // Z80toROM loader at the start of a snapshot, bank 5 compressed again after it
+#define PREVIEW_SLOTS 2     // loading screens kept for the ROM Explorer preview, all but the first in bank1
+#define BORROW_SLOTS (MENU_SLOTS-1+PREVIEW_SLOTS-1) // 6912 byte screens borrowed from the top of bank1
+#define BORROW_AT (131072-BORROW_SLOTS*6912)       // where they start in bank1
+//
+#define SETTINGS_PAGES (FLASH_SECTOR_SIZE/FLASH_PAGE_SIZE)       // one record per page, sector erased when all used
+#define SETTINGS_MAGIC 0x32464950 // "PIF2"
+#define FAST_BOOT_DEFAULT false   // serve the last selected ROM from power on, hold user button at power on to toggle
+//
+// ROM pack - made by packROM and flashed as its own UF2, replaces the ROMs
+// compiled in (apart from the ROM Explorer) when it is found at power on. It
+// can go in any flash sector between the end of the program and the flash store
+#define PACK_MAGIC 0x4b415050      // "PPAK"
+#define PACK_VERSION 5
+#define PACK_MAXROMS 65534         // plus the ROM Explorer, rompos is 16bit
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;     // ROMs in the pack, ROM 0 is always the ROM Explorer compiled in
+    uint32_t size;      // bytes including this header
+    uint32_t made;      // when packROM made it, the newest pack in flash is used
+    uint32_t check;     // sum of the bytes above & of the index & name order
+    uint32_t index[];   // offset of each ROM (34byte header & compressed data) in order,
+                        // each up to the next, followed by count uint16 ROM numbers in
+                        // name order for the search
+} pack_t;
+//
+// flash store - ROMs added over USB (store command), a log of entries in the
+// STORE_SECTORS below the settings sector. Each entry starts on a page with
+// a store_t then the ROM exactly as in the catalogue (34byte header &
+// compressed data). Entries are only ever appended, going round the store
+// so every sector is erased once a lap, and deleting one only clears bits.
+// Room is kept ahead of the head for the live entries of the oldest sector,
+// they are copied to the head and the sector reused whenever it runs short
+#define STORE_SECTORS 32           // 128kB, packs must end below it
+#define STORE_MAGIC 0x524f5453     // "STOR"
+#define STORE_MAXROMS 64
+#define SECTOR_PAGES (FLASH_SECTOR_SIZE/FLASH_PAGE_SIZE)
+#define STORE_ENTRY_PAGES(size) ((sizeof(store_t)+(size)+FLASH_PAGE_SIZE-1)/FLASH_PAGE_SIZE)
+typedef struct {
+    uint32_t magic;
+    uint32_t live;      // 0xffffffff, programmed to 0 when the entry is deleted
+    uint32_t seq;       // increases with every entry written, the newest copy of an id wins
+    uint32_t id;        // catalogue order, kept when the entry is moved
+    uint32_t size;      // bytes of ROM after this
+    uint32_t check;     // sum of them plus seq, id & size
+} store_t;
+typedef struct {
+    const uint8_t *from;
+    uint32_t j;         // next compressed byte
+    uint8_t ring[256];  // last 256 bytes out, as far back as a copy can reach
+    uint8_t i;          // next ring position
+    uint8_t o;          // offset of the copy being done
+    uint8_t run;        // bytes left of the literal run or copy
+    bool copy;
+    uint8_t more;       // streams still to come after this one, read straight on into them
+} lzStream_t;
+typedef struct {
+    uint32_t size;      // bytes to come, 0 when no upload
+    uint32_t got;
+    uint32_t sum;       // of the bytes so far, must end up as check
+    uint32_t check;
+    uint32_t out;       // bytes unpacked into the slots
+    uint32_t max;       // room in the slots
+    uint32_t start;     // time_us_32() of the first byte & the latest
+    uint32_t last;
+    uint8_t *to;        // first slot
+    uint8_t head[34];   // header, made up for a raw image
+    bool lz;            // 34byte header & simplelz like a ROM in the catalogue, or a raw image
+    uint8_t c;          // control byte being worked through
+    uint8_t run;        // literal bytes still to come
+    bool offset;        // next byte is a copy offset
+    bool end;           // end marker seen
+    bool bad;           // not a ROM that can be uploaded, the rest is read & thrown away
+} upload_t;
+typedef struct {
+    uint32_t size;      // bytes to come, 0 when not storing
+    uint32_t got;
+    uint32_t sum;
+    uint32_t check;
+    uint32_t at;        // first page of the entry
+    uint32_t start;     // time_us_32() of the first byte & the latest
+    uint32_t last;
+    bool bad;           // a page couldn't be written, the rest is read & thrown away
+    uint8_t first[FLASH_PAGE_SIZE]; // page with the store_t, written last so a half sent ROM is never an entry
+    uint8_t page[FLASH_PAGE_SIZE];  // page being filled
+} storeNew_t;
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;       // increases with every write, highest is current
+    uint16_t rompos;    // last ROM selected in the ROM Explorer
+    uint8_t mode;       // header byte 0 of rompos when saved, ignored if the ROM list has changed
+    uint8_t fastBoot;   // boot policy
+    uint32_t check;
+} settings_t;
+typedef struct {
+    uint16_t rom;       // catalogue position
+    uint16_t seconds;   // longest it is given, 0 until it parks or fails to launch
+    uint32_t ran;       // ms from RESET lifted to the end of the stage
+    const char *end;    // why it ended, NULL until it has
+} seqStage_t;
+//
+const uint16_t MAXROMS=*(&roms + 1) - roms; // test
+const pack_t *pack=NULL;              // ROM pack in flash, NULL to use the ROMs compiled in
+uint16_t romCount;                    // ROMs that can be selected, MAXROMS or pack->count+1
+const uint16_t *nameOrder=romOrder;   // ROMs 1 onwards sorted by name, from mkexplorer or the pack
+uint32_t flashSize=PICO_FLASH_SIZE_BYTES; // read from the flash chip at power on
+uint32_t settingsOffset;              // last flash sector, well clear of the program
+uint32_t storeOffset;                 // flash store, STORE_SECTORS below the settings
+uint32_t storePages=0;                // pages in it, 0 when the program leaves no room
+int32_t storePage[STORE_MAXROMS];     // first page of each live entry, -1 none. The first storeCount
+                                      // are catalogue ROMs storeBase onwards, -1 once deleted
+uint16_t storeBase;                   // catalogue position of the first ROM from the store
+uint16_t storeCount=0;                // ROMs from the store in the catalogue
+uint32_t storeHead=0;                 // page the next entry goes at
+uint32_t storeUsed=0;                 // bit per sector with a live entry in it
+uint32_t storeSeq=0;                  // highest seq & id written
+uint32_t storeId=0;
+storeNew_t storeNew;                  // ROM being written to the store from USB
+const uint8_t storeGone[35]={4,0,'(','d','e','l','e','t','e','d',')',[34]=128}; // catalogue ROM deleted since power on
+const uint8_t packBad[35]={4,0,'(','d','a','m','a','g','e','d',')',[34]=128}; // pack index entry pointing outside the pack
+volatile bool serving=false;          // core 0 is in romServe(), running from SRAM
 uint8_t bank1[131072];   // equivalent to a 128K EPROM
 uint8_t romSelector[16384];
-volatile uint8_t rompos=0;     
+uint8_t romCache[CACHE_SLOTS][16384]; // LRU cache of unpacked 16kB/32kB ROMs
+int32_t cacheRom[CACHE_SLOTS];        // rompos held in each slot, -1 empty (32kB ROMs fill two slots)
+uint32_t cacheUsed[CACHE_SLOTS];      // last use of each slot for LRU eviction
+uint32_t cacheClock=0;
+int32_t bank1Rom=-1;                  // rompos currently unpacked in bank1, -1 none
+volatile uint32_t cacheHits=0;
+volatile uint32_t cacheMisses=0;
+volatile bool statsChanged=false;     // tell core 1 there is something to report
+uint8_t * volatile romData=bank1;     // unpacked ROM being served, bank1 or a cache slot
+volatile uint32_t romLen=0;           // unpacked size of the ROM being served
+volatile uint8_t romMode=0;           // header byte 0 of rompos kept in RAM for the serving loop
+volatile bool romStream=false;        // rompos has FLAG_STREAM, serve the stream & command windows
+volatile uint32_t streamWindow=0x4000; // where the stream port is for rompos, 0x4000 none
+bool romLaunch=false;                 // rompos has FLAG_LAUNCH
+const uint8_t * volatile bankJob=NULL; // banked snapshot core 1 is unpacking into bank1, NULL when idle
+volatile uint32_t bankNext=0;         // where in bankJob the compressed bank 1 starts
+volatile uint8_t banksReady=8;        // 16kB banks of bank1 unpacked and safe to serve
+volatile uint32_t bankStalls=0;       // times the snapshot loader got to a bank before core 1 had unpacked it
+volatile bool bankLate=false;         // it did on this launch, core 1 relaunches once every bank is in
+volatile uint32_t launchStart=0;      // time_us_32() when the ROM was selected
+volatile uint32_t launchUnpack=0;     // us from selection to RESET lifted
+volatile uint32_t launchGame=0;       // us from selection to the snapshot switching the interface off
+volatile bool launchDone=false;
+settings_t settings={SETTINGS_MAGIC,0,0,0,FAST_BOOT_DEFAULT,0}; // RAM copy of the current flash record
+int settingsPage=-1;                  // page of the settings sector holding it, -1 none
+volatile bool core1Ready=false;       // core 1 can be parked for flash writes
+volatile uint32_t fetchCount=0;       // ROM reads seen by the serving loop
+volatile uint32_t im1Count=0;         // of which IM1 interrupts (0x0038)
+volatile uint32_t launchEpoch=0;      // bumped every time RESET is lifted on a ROM
+volatile uint32_t launchLift=0;       // time_us_32() it was lifted
+volatile bool buttonBusy=false;       // resetButton() in charge of RESET, watchdog keeps off
+volatile int32_t shellJob=-1;         // ROM the USB shell wants resetButton() to switch to, -1 none
+upload_t upload;                      // ROM being received over USB
+uint8_t uploadHead[35]={0,0,'U','S','B',' ','u','p','l','o','a','d',[34]=128}; // served upload as ROM romCount
+uint32_t uploadLen=0;                 // its unpacked size
+volatile bool uploadSwap=false;       // upload received, waiting in UPLOAD_BUSY slots for the next reset
+volatile uint32_t shellStart=0;       // time_us_32() the select command was read
+uint32_t shellEpoch=0;                // launchEpoch when it was read
+bool shellWait=false;                 // select not reported yet
+int32_t shellListPos=-1;              // next ROM to list, -1 not listing
+bool wdEnabled=true;                  // watchdog on, the shell's wd on|off
+bool wdGaveUp=false;                  // watchdog has given up on the ROM being served
+uint32_t wdRecoveries=0;              // failed launches reset by the watchdog or ROM Explorer check
+uint32_t wdRecoverUs=0;               // last time from spotting a failed launch to the program running again
+uint32_t wdRecoverTotal=0;
+uint32_t bootReady=0;                 // us from power on to being ready to serve
+volatile uint16_t rompos=0;     
 volatile bool pagingOn=false;    
 volatile uint32_t adder=0;     
 PIO pio;
 uint addr_data_sm;
+uint8_t cmdFrame[6];                  // command being read through the command window
+uint cmdPos=0;
+uint16_t navPos=0;                    // menu line under the ROM Explorer cursor
+int32_t navPage=-1;                   // page in the text window, -1 none
+volatile int32_t navJob=-1;           // key bits & character for core 1 to move the cursor with, -1 idle
+char navQuery[MENU_QUERY];            // search typed in the ROM Explorer, upper case
+uint navQueryLen=0;                   // 0 for the whole catalogue in order
+uint16_t viewFirst=0;                 // ROMs matching the search are nameOrder[viewFirst...]
+uint16_t viewCount;                   // menu lines, romCount without a search
+uint16_t viewStore[STORE_MAXROMS];    // then the store's ROMs matching it, which nameOrder doesn't have
+uint16_t viewStores=0;
+volatile int32_t previewJob=-1;       // snapshot for core 1 to fetch the loading screen of, -1 idle
+uint8_t previewCache[6912];           // first loading screen, the rest borrowed from bank1
+int32_t previewRom[PREVIEW_SLOTS]={[0 ... PREVIEW_SLOTS-1]=-1}; // rompos in each slot, -1 empty
+uint32_t previewUsed[PREVIEW_SLOTS];  // last use of each slot for LRU eviction
+uint32_t previewClock=0;
+uint8_t menuCache[6912];              // first drawn ROM Explorer page, the rest borrowed from bank1
+uint32_t menuKey[MENU_SLOTS]={[0 ... MENU_SLOTS-1]=0xffffffff}; // viewEpoch<<16|page in each slot
+uint32_t menuUsed[MENU_SLOTS];        // last use of each slot for LRU eviction
+uint32_t menuClock=0;
+uint16_t viewEpoch=0;                 // changes with the search, drawn pages include the title
+volatile int32_t streamJob=-1;        // catalogue position for core 1 to open as the stream, -1 idle
+uint8_t streamRing[STREAM_RING];      // unpacked stream bytes, core 1 writes at head & core 0 reads at tail
+uint8_t *streamBuf=streamRing;        // ring in use, bank1 for a snapshot launch or tape
+uint32_t streamMask=STREAM_RING-1;
+volatile uint32_t streamHead=0;
+volatile uint32_t streamTail=0;
+volatile uint32_t streamLeft=0;       // bytes of the stream still to go into the ring
+lzStream_t streamLz;
+volatile bool streamStop=false;       // core 0 wants bank1 back, core 1 drops the stream & clears this
+seqStage_t seqStages[SEQ_STAGES];     // sequence being run
+uint seqCount=0;
+volatile int32_t seqAt=-1;            // stage running, -1 no sequence
+volatile uint32_t seqRun=0;           // bumped every time a sequence starts
+volatile uint32_t seqEpoch;           // launchEpoch before the stage's ROM went in
+volatile bool seqLoaded=false;        // first stage already put in by romSelect() or at power on
+volatile bool seqSwitch=false;        // shellJob is the sequencer moving on, not remembered for fast boot
+const char * volatile seqError=NULL;  // why a sequence entry picked on the Spectrum didn't start
+volatile uint16_t lastAddress=0;      // ROM address read last, sampled by the sequencer
+
+// the buffers are nearly all of SRAM & the link only fails once there is none left at all
+_Static_assert(sizeof(bank1)+sizeof(romSelector)+sizeof(romCache)+sizeof(menuCache)+sizeof(previewCache)+sizeof(streamRing)+SRAM_SDK<=SRAM_SIZE,
+    "the ROM buffers leave the SDK too little SRAM");
 //
 void dtoBuffer(uint8_t *to,const uint8_t *from);
-uint16_t simplelz(uint8_t* fload,uint8_t* store,uint16_t filesize);
+uint32_t dtoBank(uint8_t *to,const uint8_t *from,uint32_t j);
+uint32_t romSize(const uint8_t *from);
+uint romStreams(const uint8_t *from);
+uint romSparse(const uint8_t *from);
+void romLoad(uint16_t pos);
+const uint8_t *romEntry(uint16_t pos);
+void packFind();
+bool packCheck(const pack_t *p,uint32_t space);
+void flashDetect();
+void storeScan();
+bool storeValid(const uint8_t *from,uint32_t size);
+const store_t *storeAt(uint32_t page);
+void storeMark();
+int32_t storeAlloc(uint32_t n,uint32_t spare);
+bool storeFree(uint32_t at,uint32_t n);
+bool storeCollect();
+int32_t storeOldest(int32_t sector,uint32_t upto);
+bool storeMove(uint slot);
+bool storeHold();
+void storeRelease();
+void storeFlash(uint32_t page,const uint8_t *data);
+void storeKill(uint32_t page);
+const char *storeStart(uint32_t size,uint32_t check);
+void storeByte(uint8_t b);
+const char *storeEnd();
 void resetButton(uint gpio,uint32_t events);
+void romSelect(uint16_t selection);
+const char *uploadStart(bool lz,uint32_t size,uint32_t check);
+bool uploadByte(uint8_t b);
+const char *uploadEnd();
+void uploadDrop();
+void uploadIn();
+int32_t uploadSlot();
+bool cmdByte(uint8_t b);
+void navStart(uint16_t pos);
+void navKey(uint8_t keys,uint8_t ch);
+void navFind(uint8_t ch);
+bool viewSet();
+uint16_t viewRom(uint16_t pos);
+int nameCmp(const uint8_t *from,const char *query,uint len);
+void navReply();
+void menuPage(uint16_t page);
+void menuScreen(uint16_t page,uint8_t bars,uint8_t bar);
+void menuDraw(uint8_t *to,uint8_t bars,uint8_t bar);
+void menuText(uint8_t *to,uint16_t at,const uint8_t *text);
+uint16_t menuDown(uint16_t a);
+void previewReply(uint16_t pos);
+void previewDecode(uint8_t *to,const uint8_t *from);
+uint8_t *menuSlot(uint s);
+uint8_t *previewSlot(uint s);
+bool screenBorrow();
+void screenDrop();
+uint8_t lzNext(lzStream_t *s);
+uint32_t lzSkip(const uint8_t *from,uint32_t j);
+void streamOpen(uint16_t pos);
+void streamFill();
+void tapeRewind();
+void housekeeping();
+void romSetup();
+void settingsLoad();
+void settingsSave();
+void watchdog();
+void bankRelaunch();
+void shellPoll();
+void shellRun(char *line);
+void shellList();
+void shellSelect(const char *arg);
+void shellSwitch(int32_t pos);
+void shellStats();
+void shellSeq(const char *arg);
+void romSwitch(int32_t pos);
+int32_t romFind(const char *name,uint *found);
+uint seqText(uint16_t pos,char *to,uint max);
+const char *seqParse(const char *text,seqStage_t *to,uint *count);
+int32_t seqEntry(uint16_t pos);
+void seqBegin(const seqStage_t *stages,uint count,bool loaded);
+void seqPoll();
+void shellUpload(const char *arg);
+void shellUploaded();
+void shellStore(const char *arg);
+void shellStored();
+void romServe();
 //
 void main() {
     // ---------------------------------------------------------------------
-    // build the ROM Selector ROM from picoif2_lite.h, only need to do this once
-    //   ** this is specific to the ROM Explorer ROM **
+    // ROM Selector ROM, already unpacked by mkexplorer so just needs to be
+    // in RAM for the menu & current position to be patched in
     // ---------------------------------------------------------------------
-    dtoBuffer(romSelector,roms[0]); // ROM Explorer ROM into romSelector
-    // 0x0123 maxroms (-1)
-    // 0x0160 maxpages
-    romSelector[0x012e]=MAXROMS-1;
-    romSelector[0x016b]=((MAXROMS-1)/21)+1;                
-    uint16_t bpos=0;
-    uint8_t romnum=0;          
-    // build text in bank 1
-    do {
-        if(romnum==MAXROMS-1) bank1[bpos++]=31;
-        else bank1[bpos++]=30;
-        uint i=0;
-        do {
-            if(roms[romnum][2+i]<0x20||roms[romnum][2+i]>=0x80) {
-                bank1[bpos++]=0x20;
-            } else {
-                bank1[bpos++]=roms[romnum][2+i];
-            }                
-            i++;
-        } while(roms[romnum][2+i]!=0&&i<32);
-        if(roms[romnum][0]==1) {
-            bank1[bpos++]=9;
-            bank1[bpos++]=28;
-            bank1[bpos++]=29;
-        } else if(roms[romnum][0]==3||roms[romnum][0]==8) { // 48k or 128k snapshot
-            bank1[bpos++]=9;
-            bank1[bpos++]=26;
-            bank1[bpos++]=27;
-        }
-        if(romnum==MAXROMS-1||(romnum+1)%21==0) {
-            bank1[bpos++]=0;
-        }
-        else {
-            bank1[bpos++]=10;
-        }
-    } while(++romnum!=MAXROMS);
-    uint16_t compsize=simplelz(bank1,&romSelector[0x1e00],bpos);  // compress the text and put into romSelector               
+    uint32_t bootStart=time_us_32();
+    memcpy(romSelector,romExplorer,16384);
+    romCount=MAXROMS;
+    flashDetect();
+    packFind(); // ROMs from the pack if there is one
+    storeScan(); // then any added over USB
+    for(uint i=0;i<CACHE_SLOTS;i++) cacheRom[i]=-1; // empty ROM cache
     // -------------------------------
     // set-up user, romcs & reset gpio
     // -------------------------------
@@ -106,6 +474,17 @@ void main() {
     gpio_init(PIN_USER);
     gpio_set_dir(PIN_USER,GPIO_IN);
     gpio_pull_up(PIN_USER); // button active when connected to ground
+    // last selected ROM & boot policy, user button held at power on toggles fast boot
+    settingsLoad();
+    busy_wait_us_32(100); // let the pull up settle
+    if(gpio_get(PIN_USER)==false) {
+        settings.fastBoot=!settings.fastBoot;
+        settingsSave();
+        while(gpio_get(PIN_USER)==false) tight_loop_contents();
+        busy_wait_us_32(100000); // button bounce
+    }
+    // housekeeping (USB stats) runs on core 1 so it never gets in the way of serving
+    multicore_launch_core1(housekeeping);
     gpio_set_irq_enabled_with_callback(PIN_USER,GPIO_IRQ_EDGE_FALL,true,&resetButton);  // when user button pressed, interrupt code annd run resetButton routine
     //
     gpio_init(PIN_ROMCS);
@@ -141,30 +520,85 @@ void main() {
     pio_sm_init(pio,addr_data_sm,addr_data_offset,&addr_data_config); // reset state machine and configure it
     // start PIO state machine
     pio_sm_set_enabled(pio,addr_data_sm,true); // enable state machine   
-    busy_wait_us_32(50000);       // wait 50ms before lifting RESET          
+    // fast boot, unpack the last ROM while RESET is held so the Spectrum comes up in it
+    if(settings.fastBoot&&settingsPage>=0&&settings.rompos<romCount&&romEntry(settings.rompos)[0]==settings.mode) {
+        rompos=settings.rompos;
+        if(romEntry(rompos)[0]==4) { // a sequence, started again on its first ROM
+            int32_t first=seqEntry(rompos);
+            rompos=first<0?0:first;
+        }
+    }
+    romLoad(rompos);
+    romSetup();
+    bootReady=time_us_32()-bootStart;
+    while(time_us_32()-bootStart<50000) tight_loop_contents(); // RESET held for 50ms from power on
     gpio_put(PIN_RESET,true);    // release RESET    
-    // loop forever
+    launchLift=time_us_32();
+    launchEpoch++;
+    romServe();
+}
+//
+// ---------------------------------------------------------------------------
+// romServe - core 0 loop serving the Spectrum, runs from SRAM so core 1 can
+// write to flash without stopping it. Nothing here may touch flash, the user
+// button interrupt (in flash) is held off while core 1 writes
+// ---------------------------------------------------------------------------
+void __not_in_flash_func(romServe)() {
     uint32_t address;
     uint32_t c;
+    serving=true;
     while(true) {
         address=pio_sm_get_blocking(pio,addr_data_sm);
-        pio_sm_put_blocking(pio,addr_data_sm,bank1[address+adder]); // if ROMCS off then direction of Data chip is input so they do not interfere
+        if((address&0x3f00)==streamWindow) {
+            // stream port, next byte core 1 has unpacked or 0xff if the ring has run dry
+            c=0xff;
+            if(streamTail!=streamHead) c=streamBuf[streamTail++&streamMask];
+            else if(romStream&&streamLeft!=0) romData[REPLY_WINDOW+5]=1; // ran dry before the end
+            pio_sm_put_blocking(pio,addr_data_sm,c);
+        } else {
+            pio_sm_put_blocking(pio,addr_data_sm,romData[address+adder]); // if ROMCS off then direction of Data chip is input so they do not interfere
+        }
+        // bus activity for the watchdog, still seen with ROMCS off as the Spectrum ROM is read
+        fetchCount++;
+        lastAddress=address;
+        if(address==0x0038) im1Count++;
+        // stream port command, core 1 opens the stream & answers in the reply window. Tape
+        // mode's window opens & closes at once, the next read is LD-BYTES reading the tape
+        if((romStream||romMode==5)&&(address&0x3f00)==CMD_WINDOW&&cmdByte(address)) {
+            if(cmdFrame[2]==CMD_STREAM&&romStream&&streamJob<0) {
+                romData[REPLY_WINDOW]=0;
+                streamJob=rompos+(cmdFrame[3]|(cmdFrame[4]<<8));
+            } else if(cmdFrame[2]==CMD_TAPE&&romMode==5) {
+                streamWindow=cmdFrame[3]?TAPE_WINDOW:0x4000;
+            }
+        }
         // z80 routine
-        if((roms[rompos][0]==3||roms[rompos][0]==8)) {      
+        if((romMode==3||romMode==8)) {      
             if(address==0x3fff) {
                 if(pagingOn==true) {
                     gpio_xor_mask(MASK_LED);
                     adder+=16384;
-                    if(adder==roms[rompos][0]*16384) {
+                    if(adder==romLen) { // banks left out of a sparse snapshot are not served
                         adder=0;
                         pagingOn=false;
+                    } else if(banksReady<=(adder>>14)) {
+                        // loader has caught up with core 1. There is no WAIT line so the Z80
+                        // can't be held, it copies whatever bank1 has there & the launch is
+                        // spoilt, core 1 resets & launches again once the bank is unpacked
+                        bankStalls++;
+                        bankLate=true;
                     }
                 } else {
                     gpio_put(PIN_ROMCS,false);    // ROM off
                     gpio_put(PIN_LED,false);                    
+                    if(!launchDone) {
+                        launchGame=time_us_32()-launchStart;
+                        launchDone=true;
+                        statsChanged=true;
+                    }
                 }
             }
-        } else if(roms[rompos][0]==1&&pagingOn==true) {
+        } else if(romMode==1&&pagingOn==true) {
                 // top 64 ROM locations (0x3fc0-0x3fff)
                 // 15 14 13 12 11 10  9  8  7  6  5  4  3  2  1  0
                 //  0  0  1  1  1  1  1  1  1  1  l  p  b  b  b  b
@@ -182,7 +616,7 @@ void main() {
                     }  
                     // bank 0-7 (not enough memory for all 16 banks, only 8 allowed)
                     adder=(address&bkMask)*16384;
-                    if(adder>131072) adder=0;
+                    if(adder>=romLen) adder=0; // stay inside the unpacked ROM, which may be a cache slot
                     // lock paging
                     if((address&lkMask)==lkMask) {
                         pagingOn=false;
@@ -200,18 +634,31 @@ void main() {
 // ---------------------------------------------------------------------------
 void resetButton(uint gpio,uint32_t events) {
     uint32_t address;         
-    busy_wait_us_32(100000);    // litle wait to help with button bounce
-    gpio_put(PIN_RESET,false); // put Spectrum in RESET state                      
-    // wait for button release and check held for 1second to switch ROM otherwise just reset
+    bool selected=false;
+    if(gpio!=PIN_USER||!(events&GPIO_IRQ_EDGE_FALL)) return; // the only interrupt enabled, or forced by romSwitch()
+    buttonBusy=true;
     uint64_t lastPing=time_us_64();        
-    do {
-        busy_wait_us_32(100000); // wait 100ms between each read, minimum 200ms wait on each press
-    } while((gpio_get(PIN_USER)==false)&&(time_us_64()<lastPing+1000000));
+    if(shellJob>=0) {
+        // USB shell select, core 1 forced this interrupt so there is no button to wait for
+        hw_clear_bits(&iobank0_hw->proc0_irq_ctrl.intf[PIN_USER>>3],GPIO_IRQ_EDGE_FALL<<(4*(PIN_USER&7)));
+        gpio_put(PIN_RESET,false); // put Spectrum in RESET state
+        launchStart=shellStart; // timed from the command
+        romSelect(shellJob);
+        shellJob=-1;
+        selected=true;
+    } else {
+        seqAt=-1; // the button stops a sequence
+        busy_wait_us_32(100000);    // litle wait to help with button bounce
+        gpio_put(PIN_RESET,false); // put Spectrum in RESET state                      
+        // wait for button release and check held for 1second to switch ROM otherwise just reset
+        lastPing=time_us_64();        
+        do {
+            busy_wait_us_32(100000); // wait 100ms between each read, minimum 200ms wait on each press
+        } while((gpio_get(PIN_USER)==false)&&(time_us_64()<lastPing+1000000));
+    }
     // button pressed for >=1second?
-    if(time_us_64()>=lastPing+1000000) {                                              
-        romSelector[0x0009]=rompos;   // 0x0005 current rom ** this is specific to the ROM Explorer ROM **
-        romSelector[0x000e]=rompos-((rompos/21)*21);  // 0x000a current pos ** this is specific to the ROM Explorer ROM **
-        romSelector[0x0013]=(rompos/21)+1;    // 0x000f current page ** this is specific to the ROM Explorer ROM ** 
+    if(!selected&&time_us_64()>=lastPing+1000000) {                                              
+        navStart(rompos); // menu page with the cursor on the current ROM
         // run the Selector ROM          
         gpio_put(PIN_ROMCS,true);     // turn on ROMCS  
         gpio_put(PIN_RESET,true);   // lift reset         
@@ -221,131 +668,2375 @@ void resetButton(uint gpio,uint32_t events) {
         do {
             address=pio_sm_get_blocking(pio,addr_data_sm);
             pio_sm_put_blocking(pio,addr_data_sm,romSelector[address]);             
-            if(address=0x0038) countAddress++;            
+            if(address==0x0038) countAddress++;            
             else if(time_us_64()>=lastPing+500000) {
                 gpio_put(PIN_RESET,false);   // lift reset  
                 busy_wait_us_32(100000);
                 gpio_put(PIN_RESET,true);   // lift reset  
                 lastPing=time_us_64();
                 countAddress=0;
+                wdRecoveries++;
             }
         } while(countAddress<10);
         //
         gpio_put(PIN_LED,true);          
         countAddress=0;                    
+        cmdPos=0;
+        uint16_t selection=0;
         do {
             address=pio_sm_get_blocking(pio,addr_data_sm);
             pio_sm_put_blocking(pio,addr_data_sm,romSelector[address]); 
-            if(address>=0x3f80) countAddress++;
+            if((address&0x3f00)==CMD_WINDOW&&cmdByte(address)) {
+                // select command, done as soon as one full frame has been read
+                if(cmdFrame[2]==CMD_SELECT) {
+                    selection=cmdFrame[3]|(cmdFrame[4]<<8);
+                    break;
+                }
+                // anything with a reply is done by core 1 so this loop keeps serving
+                if(cmdFrame[2]==CMD_KEY&&navJob<0) {
+                    romSelector[REPLY_WINDOW]=0;
+                    navJob=cmdFrame[3]|(cmdFrame[4]<<8);
+                } else if(cmdFrame[2]==CMD_PREVIEW&&previewJob<0) {
+                    romSelector[REPLY_WINDOW]=0;
+                    previewJob=cmdFrame[3]|(cmdFrame[4]<<8);
+                }
+            } else if(address>=0x3f80) {
+                // original protocol (any ROM selector written for v0.7 or earlier)
+                countAddress++;
+                selection=address-0x3f80;
+            }
         } while(countAddress<256);    // wait for consistent signal above 0x3f80 from ROM selector 
         // ROM selected
         gpio_put(PIN_RESET,false); // put Spectrum in RESET state
-        rompos=address-0x3f80;
-
-        if(rompos>=MAXROMS) {
-            rompos=MAXROMS-1; // error trap
-        }                        
-        dtoBuffer(bank1,roms[rompos]);  // unpack correct ROM                                                                    
+        launchStart=time_us_32();
+        romSelect(selection);
+        selected=true;
     }
-    // final set-up before restart
-    if(roms[rompos][0]==1||roms[rompos][0]==3||roms[rompos][0]==8) {
-        pagingOn=true; // if the ROM had this off make sure it is back on
+    if(!selected&&uploadSwap) {
+        // plain reset with a USB upload waiting, it goes in now
+        launchStart=time_us_32();
+        romSelect(romCount);
+        selected=true;
     }
-    if(rompos==0) {
-        gpio_put(PIN_ROMCS,false);     // turn off ROMCS  
-        gpio_put(PIN_LED,false);     
-    } else {
-        gpio_put(PIN_ROMCS,true);     // turn on ROMCS 
-        gpio_put(PIN_LED,true);       
-    }    
-    adder=0;
+    romSetup();
     busy_wait_us_32(100000);    // wait 100ms before lifting RESET       
     gpio_put(PIN_RESET,true);   // lift reset    
+    launchLift=time_us_32();
+    launchEpoch++;
+    buttonBusy=false;
+    if(selected) {
+        launchUnpack=time_us_32()-launchStart;
+        statsChanged=true;
+    }
 }
 //
 // ---------------------------------------------------------------------------
-// dtoBuffer - decompress compressed ROM directly into buffer (simple LZ)
+// romSelect - make a ROM picked in the ROM Explorer or the USB shell the one
+// being served & remember it for fast boot. The Spectrum must be held in RESET
 // input:
-//   to - the buffer
-//   from - the compressed storage
-// *simple LZ has a simple 256 backwards window and greedy parser but is very
-// fast
+//   selection - catalogue position, romCount for the USB upload
 // ---------------------------------------------------------------------------
-void dtoBuffer(uint8_t *to,const uint8_t *from) { 
-    uint i=0,j=34,k; // start j at 34 to skip header
+void romSelect(uint16_t selection) {
+    rompos=selection;
+    if(rompos==romCount&&uploadSwap) uploadIn();
+    if(rompos>romCount||(rompos==romCount&&uploadSlot()<0)) {
+        rompos=romCount-1; // error trap
+    }                        
+    uint16_t remember=rompos;
+    if(romEntry(rompos)[0]==4) {
+        int32_t first=seqEntry(rompos);
+        if(first>=0) {
+            rompos=first; // sequence, starts on its first ROM & is remembered so fast boot starts it again
+        } else {
+            remember=rompos=settings.rompos<romCount?settings.rompos:0; // data entry, only there to be streamed
+        }
+    }
+    romLoad(rompos);  // unpack correct ROM, or point straight at it if still cached
+    launchDone=false;
+    uint8_t mode=romEntry(remember)[0];
+    if(seqSwitch) {
+        seqSwitch=false; // the next stage of a sequence, the sequence stays remembered
+    } else if(remember<romCount&&(remember!=settings.rompos||mode!=settings.mode)) { // not an upload, gone at power off
+        settings.rompos=remember;
+        settings.mode=mode;
+        settingsSave(); // Spectrum is held in RESET so nothing needs serving
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// cmdByte - feed one byte read through the command window into the frame
+// input:
+//   b - low byte of the address read
+// output:
+//   true when a complete frame with a good checksum is in cmdFrame
+// ---------------------------------------------------------------------------
+bool __not_in_flash_func(cmdByte)(uint8_t b) {
+    if(cmdPos==0) {
+        if(b==0xa5) cmdFrame[cmdPos++]=b;
+    } else if(cmdPos==1) {
+        if(b==0x5a) cmdFrame[cmdPos++]=b;
+        else if(b!=0xa5) cmdPos=0;
+    } else if(cmdPos<5) {
+        cmdFrame[cmdPos++]=b;
+    } else {
+        cmdPos=0;
+        if(b==(cmdFrame[2]^cmdFrame[3]^cmdFrame[4]^0xff)) return true;
+        if(b==0xa5) cmdFrame[cmdPos++]=b;
+    }
+    return false;
+}
+//
+// ---------------------------------------------------------------------------
+// navStart - put the ROM Explorer cursor on pos ready for it to start, core 0
+// with the Spectrum held in RESET. Any search is forgotten
+// ---------------------------------------------------------------------------
+void navStart(uint16_t pos) {
+    navQueryLen=0;
+    viewSet();
+    viewEpoch++;
+    memcpy(&romSelector[MENU_TITLE],&romExplorer[MENU_TITLE],31);
+    navPos=pos<viewCount?pos:0;
+    navPage=-1;
+    navReply();
+    // ** this is specific to the ROM Explorer ROM **
+    romSelector[0x000e]=romSelector[REPLY_WINDOW+2]; // 0x000a current pos
+}
+//
+// ---------------------------------------------------------------------------
+// navKey - move the cursor the way the ROM Explorer used to itself
+// input:
+//   keys - 0x02 back a page, 0x04 forward a page, 0x08 up, 0x10 down,
+//          0x20 ch typed, 0x40 draw the page again
+//   ch - character for the search
+// ---------------------------------------------------------------------------
+void navKey(uint8_t keys,uint8_t ch) {
+    uint16_t last=viewCount-1;
+    if(keys&0x20) {
+        navFind(ch);
+    } else if(keys&0x02) {
+        if(navPos<MENU_ROWS) navPos=0;
+        else navPos-=MENU_ROWS;
+    } else if(keys&0x04) {
+        if(navPos+MENU_ROWS>last) navPos=last; // also on the last page
+        else navPos+=MENU_ROWS;
+    } else if(keys&0x08) {
+        if(navPos>0) navPos--;
+    } else if(keys&0x10) {
+        if(navPos<last) navPos++;
+    } else if(keys&0x40) {
+        navPage=-1;
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// navFind - add a character to the search or delete the last one, the menu
+// becomes the ROMs whose names start with the search in name order. A
+// character that would leave nothing to show is ignored
+// input:
+//   ch - A-Z, 0-9, space or 0x08 delete
+// ---------------------------------------------------------------------------
+void navFind(uint8_t ch) {
+    if(ch==0x08) {
+        if(navQueryLen==0) return;
+        navQueryLen--;
+        viewSet();
+    } else {
+        if(navQueryLen==MENU_QUERY||ch<0x20||ch>=0x7f) return;
+        if(ch>='a'&&ch<='z') ch-=32;
+        navQuery[navQueryLen++]=ch;
+        if(!viewSet()) {
+            navQueryLen--;
+            viewSet();
+            return;
+        }
+    }
+    navPos=0;
+    navPage=-1; // always a new page, the title shows the search
+    viewEpoch++;
+    // ** this is specific to the ROM Explorer ROM **, title is printed on every redraw
+    char *title=(char *)&romSelector[MENU_TITLE];
+    if(navQueryLen==0) {
+        memcpy(title,&romExplorer[MENU_TITLE],31);
+    } else {
+        memcpy(title,"Find: ",6);
+        memcpy(title+6,navQuery,navQueryLen);
+        title[6+navQueryLen]=0;
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// viewSet - menu lines for the search, two binary searches of the name
+// order so it costs the same whatever the size of the catalogue. The name
+// order only covers the ROMs up to storeBase, the few from the store are
+// checked one by one & listed after them in the order they were stored
+// output:
+//   false if no ROM matches, view left as it was
+// ---------------------------------------------------------------------------
+bool viewSet() {
+    if(navQueryLen==0) {
+        viewFirst=0;
+        viewCount=romCount;
+        viewStores=0;
+        return true;
+    }
+    uint32_t n=storeBase-1;
+    uint32_t lo=0,hi=n;
+    while(lo<hi) { // first name not before the search
+        uint32_t m=(lo+hi)/2;
+        if(nameCmp(romEntry(nameOrder[m]),navQuery,navQueryLen)<0) lo=m+1;
+        else hi=m;
+    }
+    uint32_t first=lo;
+    hi=n;
+    while(lo<hi) { // first name after everything starting with it
+        uint32_t m=(lo+hi)/2;
+        if(nameCmp(romEntry(nameOrder[m]),navQuery,navQueryLen)<=0) lo=m+1;
+        else hi=m;
+    }
+    uint16_t found[STORE_MAXROMS];
+    uint k=0;
+    for(uint i=0;i<storeCount;i++) {
+        if(storePage[i]>=0&&nameCmp(romEntry(storeBase+i),navQuery,navQueryLen)==0) found[k++]=storeBase+i;
+    }
+    if(lo==first&&k==0) return false;
+    viewFirst=first;
+    viewCount=lo-first+k;
+    memcpy(viewStore,found,k*sizeof(found[0]));
+    viewStores=k;
+    return true;
+}
+//
+// ---------------------------------------------------------------------------
+// viewRom - ROM shown on a menu line
+// ---------------------------------------------------------------------------
+uint16_t viewRom(uint16_t pos) {
+    if(navQueryLen==0) return pos;
+    if(pos>=viewCount-viewStores) return viewStore[pos-(viewCount-viewStores)];
+    return nameOrder[viewFirst+pos];
+}
+//
+// ---------------------------------------------------------------------------
+// nameCmp - compare the start of a ROM name with the search, ignoring case
+// the same way mkexplorer & packROM sort the names
+// input:
+//   from - ROM header
+//   query - upper case search, len characters
+// ---------------------------------------------------------------------------
+int nameCmp(const uint8_t *from,const char *query,uint len) {
+    for(uint i=0;i<len;i++) {
+        uint8_t c=i<32?from[2+i]:0;
+        if(c>='a'&&c<='z') c-=32;
+        if(c!=(uint8_t)query[i]) return c<(uint8_t)query[i]?-1:1; // also a name shorter than the search
+    }
+    return 0;
+}
+//
+// ---------------------------------------------------------------------------
+// navReply - text & screen windows & reply for the cursor position, only
+// rebuilds the page if it has changed. Ready is written last so the
+// Spectrum never sees half a reply
+// ---------------------------------------------------------------------------
+void navReply() {
+    uint16_t page=navPos/MENU_ROWS;
+    uint16_t pages=(viewCount+MENU_ROWS-1)/MENU_ROWS;
+    uint8_t bars=pages<MENU_BARS?pages:MENU_BARS;
+    uint8_t *reply=&romSelector[REPLY_WINDOW];
+    uint16_t rom=viewRom(navPos);
+    reply[1]=0;
+    reply[3]=(page*bars)/pages+1; // more pages than bars, each bar covers a few
+    if(page!=navPage) {
+        menuPage(page);
+        menuScreen(page,bars,reply[3]);
+        navPage=page;
+        reply[1]=1;
+    }
+    reply[2]=navPos%MENU_ROWS;
+    reply[4]=rom;
+    reply[5]=rom>>8;
+    __dmb();
+    reply[0]=1;
+}
+//
+// ---------------------------------------------------------------------------
+// menuPage - menu text for one page into the text window, 21 lines of
+// marker, name, ROM type icons, built from the ROM headers so it costs the
+// same whatever the size of the catalogue
+// ---------------------------------------------------------------------------
+void menuPage(uint16_t page) {
+    uint8_t *t=&romSelector[TEXT_WINDOW];
+    uint32_t first=page*MENU_ROWS;
+    for(uint32_t r=first;r<viewCount&&r<first+MENU_ROWS;r++) {
+        const uint8_t *from=romEntry(viewRom(r));
+        if(r==viewCount-1u) *t++=31;
+        else *t++=30;
+        uint i=0;
+        do {
+            if(from[2+i]<0x20||from[2+i]>=0x80) *t++=0x20;
+            else *t++=from[2+i];
+            i++;
+        } while(from[2+i]!=0&&i<32);
+        if(from[0]==1) {
+            *t++=9;
+            *t++=28;
+            *t++=29;
+        } else if(from[0]==3||from[0]==8) { // 48k or 128k snapshot
+            *t++=9;
+            *t++=26;
+            *t++=27;
+        }
+        *t++=10;
+    }
+    t[-1]=0; // end of page
+}
+//
+// ---------------------------------------------------------------------------
+// menuScreen - the page in the text window as the ROM Explorer would draw it
+// into the screen window, drawn pages are kept so going back to one (or back
+// from a preview) is just a copy
+// input:
+//   page - page in the text window
+//   bars, bar - page bar parts & the one to show as current
+// ---------------------------------------------------------------------------
+void menuScreen(uint16_t page,uint8_t bars,uint8_t bar) {
+    uint32_t key=(viewEpoch<<16)|page;
+    uint s,victim=0;
+    menuClock++;
+    for(s=0;s<MENU_SLOTS;s++) {
+        if(menuKey[s]==key) break;
+        if(menuUsed[s]<menuUsed[victim]) victim=s;
+    }
+    if(s==MENU_SLOTS) {
+        s=victim;
+        if(s>0&&!screenBorrow()) s=0; // bank1 busy, only the page of its own
+        menuDraw(menuSlot(s),bars,bar);
+        menuKey[s]=key;
+    }
+    menuUsed[s]=menuClock;
+    memcpy(&romSelector[SCREEN_WINDOW],menuSlot(s),6912);
+}
+//
+// ---------------------------------------------------------------------------
+// menuDraw - ROM Explorer screen, the same steps its own redraw takes:
+// background, title, page bar then the menu text. The cursor is left to the
+// ROM Explorer, it only changes attributes
+// input:
+//   to - 6912byte screen
+//   bars, bar - page bar parts & the one to show as current
+// ---------------------------------------------------------------------------
+void menuDraw(uint8_t *to,uint8_t bars,uint8_t bar) {
+    dtoBank(to,romSelector,EXP_BACKDROP);
+    menuText(to,0x0001,&romSelector[MENU_TITLE]);
+    const uint8_t *part=&romSelector[EXP_BARS+bars*6];
+    uint16_t a=0x005f; // right hand column, third character row
+    for(;*part!=0;part++) {
+        uint8_t v=(--bar==0)?0x42:0x7e; // current part is hollow
+        for(uint k=0;k<*part&&a<6144;k++) {
+            to[a]=v;
+            a=menuDown(a);
+        }
+    }
+    menuText(to,0x0040,&romSelector[TEXT_WINDOW]);
+}
+//
+// ---------------------------------------------------------------------------
+// menuText - print in the ROM Explorer's proportional font, characters are
+// ORed in at any pixel so the right of each one spills into the next byte
+// input:
+//   to - 6912byte screen
+//   at - screen offset of the first character cell
+//   text - 0 ended, 9 jumps to the icon column, 10 next line
+// ---------------------------------------------------------------------------
+void menuText(uint8_t *to,uint16_t at,const uint8_t *text) {
+    uint8_t x=0; // pixel in the byte at
+    uint8_t c;
+    while((c=*text++)!=0&&c<0x80) {
+        if(c==9) {
+            at=(at&0xffe0)|0x1d;
+            x=0;
+        } else if(c==10) {
+            at=(at&0xffe0)+0x20;
+            if((at&0x00ff)==0) at+=0x0700; // next third of the screen
+            x=0;
+        } else if(c<0x1a||at>=0x1800) {
+            return;
+        } else {
+            const uint8_t *g=&romSelector[EXP_FONT+c*8];
+            for(uint r=0;r<8;r++) {
+                uint16_t a=at+r*256;
+                if(x==0) {
+                    to[a]=g[r];
+                } else {
+                    to[a]|=g[r]>>x;
+                    to[a+1]=g[r]<<(8-x);
+                }
+            }
+            x+=romSelector[EXP_WIDTHS+c];
+            if(x>=8) {
+                at++;
+                x-=8;
+            }
+        }
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// menuDown - screen offset one pixel row down
+// ---------------------------------------------------------------------------
+uint16_t menuDown(uint16_t a) {
+    uint8_t h=(a>>8)+1,l=a;
+    if((h&7)==0) {
+        l+=0x20;
+        if(l>=0x20) h-=8; // same third, character row below
+    }
+    return (h<<8)|l;
+}
+//
+// ---------------------------------------------------------------------------
+// previewReply - loading screen of a snapshot into the screen window for the
+// ROM Explorer, from the preview cache or decoded from the ROM. Anything that
+// isn't a snapshot has no screen (reply bit1 clear)
+// input:
+//   pos - catalogue position of the ROM
+// ---------------------------------------------------------------------------
+void previewReply(uint16_t pos) {
+    uint8_t *reply=&romSelector[REPLY_WINDOW];
+    const uint8_t *from=romEntry(pos<romCount?pos:0);
+    reply[1]=0;
+    if(from[0]==3||from[0]==8) {
+        uint s,victim=0;
+        previewClock++;
+        for(s=0;s<PREVIEW_SLOTS;s++) {
+            if(previewRom[s]==pos) break;
+            if(previewUsed[s]<previewUsed[victim]) victim=s;
+        }
+        if(s==PREVIEW_SLOTS) {
+            s=victim;
+            if(s>0&&!screenBorrow()) s=0; // bank1 busy, only the screen of its own
+            previewDecode(previewSlot(s),from);
+            previewRom[s]=pos;
+        }
+        previewUsed[s]=previewClock;
+        memcpy(&romSelector[SCREEN_WINDOW],previewSlot(s),6912);
+        reply[1]=2;
+    }
+    __dmb();
+    reply[0]=1;
+}
+//
+// ---------------------------------------------------------------------------
+// menuSlot - drawn page s of the menu cache
+// ---------------------------------------------------------------------------
+uint8_t *menuSlot(uint s) {
+    return s==0?menuCache:&bank1[BORROW_AT+(s-1)*6912];
+}
+//
+// ---------------------------------------------------------------------------
+// previewSlot - loading screen s of the preview cache
+// ---------------------------------------------------------------------------
+uint8_t *previewSlot(uint s) {
+    return s==0?previewCache:&bank1[BORROW_AT+(MENU_SLOTS-1+s-1)*6912];
+}
+//
+// ---------------------------------------------------------------------------
+// screenBorrow - can the ROM Explorer's screens go in the top of bank1 now.
+// Nothing is served from bank1 while the ROM Explorer is, but core 1 may
+// still be streaming through it, and a big ROM kept there for going back to
+// that reaches that far is forgotten
+// output:
+//   false if bank1 is in use
+// ---------------------------------------------------------------------------
+bool screenBorrow() {
+    if(romData!=romSelector||bankJob!=NULL||streamBuf==bank1) return false;
+    if(bank1Rom>=0&&romSize(romEntry(bank1Rom))>BORROW_AT) bank1Rom=-1;
+    return true;
+}
+//
+// ---------------------------------------------------------------------------
+// screenDrop - bank1 is about to be written, forget the screens borrowed from it
+// ---------------------------------------------------------------------------
+void screenDrop() {
+    for(uint s=1;s<MENU_SLOTS;s++) menuKey[s]=0xffffffff;
+    for(uint s=1;s<PREVIEW_SLOTS;s++) previewRom[s]=-1;
+}
+//
+// ---------------------------------------------------------------------------
+// previewDecode - loading screen (first 6912 bytes of bank 5) of a Z80toROM
+// snapshot. Bank 5 is compressed a second time inside ROM 0, so the ROM is
+// unpacked a byte at a time and fed straight into a second decompress that
+// stops at the end of the screen, nothing else is unpacked
+// input:
+//   to - 6912 byte buffer
+//   from - the compressed snapshot, 48k or banked 128k (bank 5 is in the
+//          first stream either way) or a streamed launch one (bank 5 is the
+//          stream after the loader ROM and only compressed once)
+// ---------------------------------------------------------------------------
+void previewDecode(uint8_t *to,const uint8_t *from) {
+    lzStream_t s={.from=from,.j=34}; // start j at 34 to skip header
+    uint32_t i=0,k;
     uint8_t c,o;
-    do {
-        c=from[j++];
-        if(c==128) return;
+    if(from[1]&FLAG_LAUNCH) {
+        s.j=lzSkip(from,34);
+        for(i=0;i<6912;i++) to[i]=lzNext(&s);
+        return;
+    }
+    for(k=0;k<SNAP_LOADER;k++) lzNext(&s);
+    while(i<6912) {
+        c=lzNext(&s);
+        if(c==128) break; // bank 5 shorter than a screen, damaged ROM
         else if(c<128) {
-            for(k=0;k<c+1;k++) to[i++]=from[j++];
+            for(k=0;k<c+1u&&i<6912;k++) to[i++]=lzNext(&s);
         }
         else {
-            o=from[j++]; // offset
-            for(k=0;k<(c-126);k++) {
-                to[i]=to[i-(o+1)];
+            o=lzNext(&s); // offset
+            for(k=0;k<(c-126u)&&i<6912;k++) {
+                to[i]=i>o?to[i-(o+1)]:0;
                 i++;
             }
         }
-    } while(true);
+    }
+    memset(&to[i],0,6912-i);
+}
+//
+// ---------------------------------------------------------------------------
+// lzNext - next byte out of a simple LZ stream. Copies never reach back more
+// than 256 bytes so the ring holds all the output that is needed
+// ---------------------------------------------------------------------------
+uint8_t lzNext(lzStream_t *s) {
+    while(s->run==0) {
+        uint8_t c=s->from[s->j++];
+        if(c==128) {
+            if(s->more) {
+                s->more--; // next bank, copies never reach back into the last one
+                continue;
+            }
+            s->j--; // end of the stream, stay there
+            return 0;
+        } else if(c<128) {
+            s->run=c+1;
+            s->copy=false;
+        } else {
+            s->o=s->from[s->j++];
+            s->run=c-126;
+            s->copy=true;
+        }
+    }
+    s->run--;
+    uint8_t b=s->copy?s->ring[(uint8_t)(s->i-(s->o+1))]:s->from[s->j++];
+    s->ring[s->i++]=b;
+    return b;
+}
+//
+// ---------------------------------------------------------------------------
+// lzSkip - step over a simple LZ stream without unpacking it
+// input:
+//   from - the compressed storage
+//   j - where the stream starts in from
+// output:
+//   where the next stream starts
+// ---------------------------------------------------------------------------
+uint32_t lzSkip(const uint8_t *from,uint32_t j) {
+    uint8_t c;
+    while((c=from[j++])!=128) j+=c<128?c+1:1;
+    return j;
+}
+//
+// ---------------------------------------------------------------------------
+// streamOpen - start streaming a data entry (mode 4) through the stream port,
+// the ring is filled before the Spectrum is told so it never starts on an
+// empty ring. A streamed launch snapshot opening itself gets its RAM banks,
+// through bank1 as the ring as nothing else is using it. Anything else opens
+// as an empty stream. The RAM banks & a tape go into bank1 whole (as much of
+// a tape as it holds) before anything reads them, as core 1 can be held up in
+// printf or a flash write for longer than a 2kB ring lasts the loader, which
+// has no way to wait. A data file's ROM can check the ring never ran dry
+// input:
+//   pos - catalogue position of the data entry
+// ---------------------------------------------------------------------------
+void streamOpen(uint16_t pos) {
+    uint8_t *reply=&romData[REPLY_WINDOW];
+    const uint8_t *from=romEntry(pos<romCount?pos:0);
+    uint32_t len=0;
+    memset(&streamLz,0,sizeof(streamLz));
+    streamLz.from=from;
+    streamLz.j=34; // start j at 34 to skip header
+    streamBuf=streamRing;
+    streamMask=STREAM_RING-1;
+    if(pos==rompos&&(from[1]&FLAG_LAUNCH)) {
+        streamLz.j=lzSkip(from,34); // past the loader ROM
+        streamLz.more=romStreams(from)-2;
+        len=romSize(from)-16384;
+        streamBuf=bank1;
+        streamMask=sizeof(bank1)-1;
+    } else if(pos!=0&&pos<romCount&&from[0]==4) {
+        len=romSize(from);
+    }
+    streamLeft=len;
+    streamHead=streamTail; // drop anything left of the last stream, the Spectrum is waiting on the reply
+    uint32_t head;
+    do {
+        head=streamHead;
+        streamFill();
+    } while(streamHead!=head); // till the ring is full or the stream is all in it
+    if(!romStream) return; // tape mode, opened at RESET & nothing to reply to
+    reply[1]=len;
+    reply[2]=len>>8;
+    reply[3]=len>>16;
+    reply[4]=len>>24;
+    reply[5]=0; // set by core 0 if a read finds the ring empty before the end
+    __dmb();
+    reply[0]=1;
+}
+//
+// ---------------------------------------------------------------------------
+// streamFill - unpack more of the open stream into the free part of the ring,
+// at most 256 bytes at a time so core 0 sees them soon after they are ready
+// ---------------------------------------------------------------------------
+void streamFill() {
+    if(streamLeft==0&&romMode==5&&streamBuf==bank1) tapeRewind(); // tape mode, the tape loops
+    uint32_t head=streamHead;
+    uint32_t n=streamMask+1-(head-streamTail);
+    if(n>streamLeft) n=streamLeft;
+    if(n>256) n=256;
+    if(n==0) return;
+    for(uint32_t k=0;k<n;k++) streamBuf[head++&streamMask]=lzNext(&streamLz);
+    __dmb(); // bytes written before core 0 can read them
+    streamHead=head;
+    streamLeft-=n; // only now, an empty ring with some left is the ring running dry
+}
+//
+// ---------------------------------------------------------------------------
+// tapeRewind - tape mode, once the end marker is in the ring carry on from the
+// first block again so a LOAD after the end finds the tape start rather than
+// an empty port
+// ---------------------------------------------------------------------------
+void tapeRewind() {
+    const uint8_t *from=streamLz.from;
+    memset(&streamLz,0,sizeof(streamLz));
+    streamLz.from=from;
+    streamLz.j=lzSkip(from,34); // past the ROM
+    streamLeft=romSize(from)-16384;
+}
+//
+// ---------------------------------------------------------------------------
+// romEntry - compressed ROM (34byte header & data) at a catalogue position,
+// from the ROM pack if one was found otherwise from the ROMs compiled in,
+// then the flash store
+// ---------------------------------------------------------------------------
+const uint8_t *romEntry(uint16_t pos) {
+    if(pos>=romCount) return uploadHead; // USB upload, the header only
+    if(pos>=storeBase&&storeCount) {
+        int32_t page=storePage[pos-storeBase];
+        return page<0?storeGone:(const uint8_t *)(storeAt(page)+1);
+    }
+    if(pack==NULL||pos==0) return roms[pos];
+    // each ROM runs up to the next one, word aligned with 0xff, & its last stream ends there
+    uint32_t o=pack->index[pos-1];
+    uint32_t end=pos<pack->count?pack->index[pos]:pack->size;
+    const uint8_t *from=(const uint8_t *)pack+o;
+    if(o<sizeof(pack_t)+pack->count*6||end<o+35||end>pack->size) return packBad;
+    uint32_t complen=end-o-34;
+    while(complen>1&&end-(o+34+complen)<3&&from[34+complen-1]==0xff) complen--;
+    if(o+34+complen>pack->size||from[34+complen-1]!=128) return packBad; // damaged, a data entry so romSelect keeps the last ROM
+    return from;
+}
+//
+// ---------------------------------------------------------------------------
+// packFind - look for a ROM pack in each flash sector after the program and
+// use the ROMs of the newest good one, so an old pack left at another offset
+// is passed over. The header & index are checked, the ROMs are read in place
+// so the time taken doesn't depend on their size
+// ---------------------------------------------------------------------------
+void packFind() {
+    extern char __flash_binary_end;
+    uint32_t off=((uintptr_t)&__flash_binary_end-XIP_BASE+FLASH_SECTOR_SIZE-1)&~(FLASH_SECTOR_SIZE-1);
+    for(;off<storeOffset;off+=FLASH_SECTOR_SIZE) {
+        const pack_t *p=(const pack_t *)(XIP_BASE+off);
+        if(p->magic!=PACK_MAGIC||!packCheck(p,storeOffset-off)) continue;
+        if(pack!=NULL&&p->made<pack->made) continue;
+        romCount=p->count+1;
+        nameOrder=(const uint16_t *)&p->index[p->count];
+        pack=p;
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// packCheck - is the pack header sensible & its index intact, the ROMs in
+// order inside the pack & the name order only ROMs in it
+// input:
+//   p - pack, magic already checked
+//   space - flash from p to the flash store
+// ---------------------------------------------------------------------------
+bool packCheck(const pack_t *p,uint32_t space) {
+    if(p->version!=PACK_VERSION||p->count==0||p->count>PACK_MAXROMS) return false;
+    if(p->size>space||p->size<sizeof(pack_t)+p->count*6) return false;
+    const uint8_t *b=(const uint8_t *)p;
+    uint32_t check=0,i;
+    for(i=0;i<offsetof(pack_t,check);i++) check+=b[i];
+    for(i=0;i<p->count*6u;i++) check+=b[sizeof(pack_t)+i];
+    if(check!=p->check) return false;
+    const uint16_t *order=(const uint16_t *)&p->index[p->count];
+    uint32_t at=sizeof(pack_t)+p->count*6;
+    for(i=0;i<p->count;i++) {
+        if(p->index[i]<at||order[i]==0||order[i]>p->count) return false;
+        at=p->index[i]+35;
+    }
+    return at<=p->size;
 }
 //
 // ---------------------------------------------------------------------------
-// simplelz - very simple lz with 256byte backward look
-//   x=128+ then copy sequence from x-offset from next byte offset 
-//   x=0-127 then copy literal x+1 times
-//   minimum sequence size 2
-// ---------------------------------------------------------------------------
-uint16_t simplelz(uint8_t* fload,uint8_t* store,uint16_t filesize) {
-	uint16_t i;
-	uint8_t * store_p, * store_c;
-	uint8_t litsize = 1;
-	uint16_t repsize, offset, repmax, offmax;
-	store_c = store;
-	store_p = store_c + 1;
-	//
-	i = 0;
-	*store_p++ = fload[i++];
-	do {
-		// scan for sequence
-		repmax = 2;
-		if (i > 255) offset = i - 256; else offset = 0;
-		do {
-			repsize = 0;
-			while (fload[offset + repsize] == fload[i + repsize] && i + repsize < filesize && repsize < 129) {
-				repsize++;
-			}
-			if (repsize > repmax) {
-				repmax = repsize;
-				offmax = i - offset;
-			}
-			offset++;
-		} while (offset < i && repmax < 129);
-		if (repmax > 2) {
-			if (litsize > 0) {
-				*store_c = litsize - 1;
-				store_c = store_p++;
-				litsize = 0;
-			}
-			*store_p++ = offmax - 1; //1-256 -> 0-255
-			*store_c = repmax + 126;
-			store_c = store_p++;
-			i += repmax;
-		}
-		else {
-			litsize++;
-			*store_p++ = fload[i++];
-			if (litsize > 127) {
-				*store_c = litsize - 1;
-				store_c = store_p++;
-				litsize = 0;
-			}
-		}
-	} while (i < filesize);
-	if (litsize > 0) {
-		*store_c = litsize - 1;
-		store_c = store_p++;
-	}
-	*store_c = 128;	// end marker
-	return store_p - store;
+// flashDetect - flash size from the JEDEC ID (capacity is 2^n bytes) so the
+// settings & the flash store go at the real end on 4/8/16MB boards, must be
+// called before core 1 is started
+// ---------------------------------------------------------------------------
+void flashDetect() {
+    extern char __flash_binary_end;
+    uint8_t tx[4]={0x9f,0,0,0};
+    uint8_t rx[4]={0,0,0,0};
+    uint32_t ints=save_and_disable_interrupts();
+    flash_do_cmd(tx,rx,4);
+    restore_interrupts(ints);
+    if(rx[3]>=21&&rx[3]<=24) flashSize=1u<<rx[3]; // 2MB-16MB, the most the XIP window maps
+    settingsOffset=flashSize-FLASH_SECTOR_SIZE;
+    storeOffset=settingsOffset-STORE_SECTORS*FLASH_SECTOR_SIZE;
+    if((uintptr_t)&__flash_binary_end-XIP_BASE>storeOffset) storeOffset=settingsOffset; // program in the way, no store
+    storePages=(settingsOffset-storeOffset)/FLASH_PAGE_SIZE;
+}
+//
+// ---------------------------------------------------------------------------
+// romLoad - make ROM pos the ROM being served. 16kB & 32kB ROMs are kept in
+// the SRAM cache so switching back to them needs no unpacking, anything larger
+// (snapshots, big ZXC2 ROMs) is unpacked into bank1
+// input:
+//   pos - catalogue position of the ROM
+// ---------------------------------------------------------------------------
+void romLoad(uint16_t pos) {
+    const uint8_t *from=romEntry(pos);
+    uint32_t len=pos<romCount?romSize(from):uploadLen; // an upload is only in the cache
+    uint s,k,slots;
+    if(from[1]&FLAG_LAUNCH) {
+        // streamed launch or tape, only the loader is served as a ROM & cached like one. Its
+        // RAM banks or tape go through bank1 as the stream ring so bank1 no longer holds a ROM
+        len=16384;
+        while(bankJob!=NULL) tight_loop_contents();
+        bank1Rom=-1;
+        screenDrop();
+    }
+    if(streamBuf==bank1) {
+        // last ROM streamed through bank1, core 1 has to stop filling it before it is reused
+        streamStop=true;
+        while(streamStop) tight_loop_contents();
+    }
+    cacheClock++;
+    romMode=from[0];
+    romLen=len;
+    romStream=pos!=0&&(from[1]&FLAG_STREAM)!=0;
+    romLaunch=pos!=0&&(from[1]&FLAG_LAUNCH)!=0;
+    streamWindow=0x4000; // tape mode's window is opened by LD-BYTES
+    if(romStream) streamWindow=STREAM_WINDOW;
+    cmdPos=0;
+    if(pos==0) {
+        romData=romSelector; // interface is off, the ROM Explorer is already unpacked so nothing to do
+        return;
+    }
+    if(len>CACHE_MAXSIZE) {
+        if(bank1Rom!=pos) {
+            cacheMisses++;
+            while(bankJob!=NULL) tight_loop_contents(); // core 1 still busy with bank1
+            if(len>BORROW_AT) screenDrop();
+            if(from[1]&FLAG_BANKED) {
+                // unpack bank 0 now so RESET can be lifted, core 1 unpacks the rest
+                // well ahead of the loader asking for them
+                banksReady=0;
+                bankLate=false;
+                bankNext=dtoBank(bank1,from,34);
+                banksReady=1;
+                bankJob=from;
+            } else {
+                dtoBuffer(bank1,from);
+            }
+            bank1Rom=pos;
+        } else cacheHits++;
+        romData=bank1;
+        return;
+    }
+    // already cached?
+    for(s=0;s<CACHE_SLOTS;s++) {
+        if(cacheRom[s]==pos) {
+            slots=(len+16383)/16384;
+            for(k=s;k<s+slots;k++) cacheUsed[k]=cacheClock;
+            cacheHits++;
+            romData=romCache[s];
+            return;
+        }
+    }
+    // miss, find the run of slots that was least recently used. A 32kB ROM
+    // only goes in slots 0-1 or 2-3, so while it is served uploadStart()
+    // still has a free end
+    slots=(len+16383)/16384;
+    uint victim=0;
+    uint32_t best=0xffffffff;
+    for(s=0;s+slots<=CACHE_SLOTS;s+=slots) {
+        uint32_t age=0;
+        for(k=s;k<s+slots;k++) {
+            if(cacheRom[k]==UPLOAD_BUSY) break; // USB upload, the only copy there is
+            if(cacheUsed[k]>age) age=cacheUsed[k];
+        }
+        if(k==s+slots&&age<best) {
+            best=age;
+            victim=s;
+        }
+    }
+    // evict anything overlapping the run, including the other half of a 32kB ROM
+    for(k=victim;k<victim+slots;k++) {
+        if(cacheRom[k]>=0) {
+            int32_t old=cacheRom[k];
+            for(s=0;s<CACHE_SLOTS;s++) {
+                if(cacheRom[s]==old) {
+                    cacheRom[s]=-1;
+                    cacheUsed[s]=0;
+                }
+            }
+        }
+    }
+    dtoBuffer(romCache[victim],from);
+    for(k=victim;k<victim+slots;k++) {
+        cacheRom[k]=pos;
+        cacheUsed[k]=cacheClock;
+    }
+    cacheMisses++;
+    romData=romCache[victim];
+}
+//
+// ---------------------------------------------------------------------------
+// romSetup - final set-up before the Spectrum is let out of RESET
+// ---------------------------------------------------------------------------
+void romSetup() {
+    if(romMode==1||romMode==3||romMode==8) {
+        pagingOn=true; // if the ROM had this off make sure it is back on
+    }
+    if(romLaunch) {
+        pagingOn=false; // streamed launch, loader ROM only so the first 0x3fff read switches off
+    }
+    if(romMode==5&&rompos!=0) {
+        streamJob=rompos; // tape mode, rewind the tape
+        streamWindow=0x4000; // & close the window if a reset caught LD-BYTES with it open
+    }
+    if(rompos==0) {
+        gpio_put(PIN_ROMCS,false);     // turn off ROMCS  
+        gpio_put(PIN_LED,false);     
+    } else {
+        gpio_put(PIN_ROMCS,true);     // turn on ROMCS 
+        gpio_put(PIN_LED,true);       
+    }    
+    adder=0;
+}
+//
+// ---------------------------------------------------------------------------
+// settingsLoad - find the current settings record, the valid one with the
+// highest sequence number in the settings sector
+// ---------------------------------------------------------------------------
+void settingsLoad() {
+    for(int p=0;p<SETTINGS_PAGES;p++) {
+        const settings_t *rec=(const settings_t *)(XIP_BASE+settingsOffset+p*FLASH_PAGE_SIZE);
+        if(rec->magic!=SETTINGS_MAGIC) continue;
+        if(rec->check!=(rec->magic^rec->seq^rec->rompos^(rec->mode<<16)^(rec->fastBoot<<24))) continue;
+        if(settingsPage<0||rec->seq>settings.seq) {
+            settings=*rec;
+            settingsPage=p;
+        }
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// settingsSave - write the settings as a new record in the next unused page,
+// the sector is only erased once every page has been used (16 saves) to
+// spread the wear. Only called with the Spectrum in RESET
+// ---------------------------------------------------------------------------
+void settingsSave() {
+    uint8_t page[FLASH_PAGE_SIZE];
+    settings.magic=SETTINGS_MAGIC;
+    settings.seq++;
+    settings.check=settings.magic^settings.seq^settings.rompos^(settings.mode<<16)^(settings.fastBoot<<24);
+    memset(page,0xff,FLASH_PAGE_SIZE);
+    memcpy(page,&settings,sizeof(settings));
+    settingsPage++;
+    bool blank=settingsPage<SETTINGS_PAGES;
+    for(int i=0;blank&&i<FLASH_PAGE_SIZE;i++) { // half written page from a power cut?
+        if(((const uint8_t *)(XIP_BASE+settingsOffset+settingsPage*FLASH_PAGE_SIZE))[i]!=0xff) blank=false;
+    }
+    if(core1Ready) multicore_lockout_start_blocking(); // core 1 runs from flash so park it
+    uint32_t ints=save_and_disable_interrupts();
+    if(!blank||settingsPage==0) {
+        flash_range_erase(settingsOffset,FLASH_SECTOR_SIZE);
+        settingsPage=0;
+    }
+    flash_range_program(settingsOffset+settingsPage*FLASH_PAGE_SIZE,page,FLASH_PAGE_SIZE);
+    restore_interrupts(ints);
+    if(core1Ready) multicore_lockout_end_blocking();
+}
+//
+// ---------------------------------------------------------------------------
+// storeScan - find the live entries in the flash store at power on, keeping
+// the newest copy of each, and add them to the end of the catalogue in the
+// order they were stored. New entries go after the newest one written
+// ---------------------------------------------------------------------------
+void storeScan() {
+    uint n=0;
+    for(uint i=0;i<STORE_MAXROMS;i++) storePage[i]=-1;
+    storeBase=romCount;
+    for(uint32_t p=0;p<storePages;) {
+        const store_t *h=storeAt(p);
+        const uint8_t *from=(const uint8_t *)(h+1);
+        if(h->magic!=STORE_MAGIC||h->size>storePages*FLASH_PAGE_SIZE||p+STORE_ENTRY_PAGES(h->size)>storePages) {
+            p++;
+            continue;
+        }
+        uint32_t check=h->seq+h->id+h->size;
+        for(uint32_t i=0;i<h->size;i++) check+=from[i];
+        if(check!=h->check||!storeValid(from,h->size)) {
+            p++; // what is left of an entry whose sectors have been reused, or half written
+            continue;
+        }
+        if(h->seq>=storeSeq) {
+            storeSeq=h->seq;
+            storeHead=p+STORE_ENTRY_PAGES(h->size);
+        }
+        if(h->id>storeId) storeId=h->id;
+        if(h->live!=0xffffffff) {
+            p++; // deleted, its later sectors may hold newer entries
+            continue;
+        }
+        // the same id twice if a move was cut short, the newer copy wins
+        int32_t k=-1;
+        for(uint i=0;i<n;i++) {
+            if(storeAt(storePage[i])->id==h->id) k=i;
+        }
+        if(k<0&&n<STORE_MAXROMS) storePage[n++]=p;
+        else if(k>=0&&h->seq>storeAt(storePage[k])->seq) storePage[k]=p;
+        p+=STORE_ENTRY_PAGES(h->size);
+    }
+    // catalogue order is the order they were first stored
+    for(uint i=1;i<n;i++) {
+        int32_t p=storePage[i];
+        uint k=i;
+        for(;k>0&&storeAt(storePage[k-1])->id>storeAt(p)->id;k--) storePage[k]=storePage[k-1];
+        storePage[k]=p;
+    }
+    storeCount=n;
+    if(romCount+n>PACK_MAXROMS+1) storeCount=PACK_MAXROMS+1-romCount; // rompos is 16bit
+    romCount+=storeCount;
+    storeMark();
+}
+//
+// ---------------------------------------------------------------------------
+// storeValid - can the catalogue take this ROM, the header is sensible and
+// the compressed streams end exactly at the end
+// input:
+//   from - 34byte header & compressed data
+//   size - bytes of it
+// ---------------------------------------------------------------------------
+bool storeValid(const uint8_t *from,uint32_t size) {
+    if(size<35||from[0]==2||from[0]==6||from[0]==7||from[0]>8) return false;
+    if((from[1]&FLAG_SPARSE)&&from[0]!=8) return false; // only 128k snapshots leave banks out
+    uint b=romStreams(from);
+    uint32_t j=34;
+    while(b&&j<size) {
+        uint8_t c=from[j++];
+        if(c<128) j+=c+1;
+        else if(c>128) j++;
+        else b--;
+    }
+    return b==0&&j==size;
+}
+//
+// ---------------------------------------------------------------------------
+// storeAt - a page of the flash store, read in place
+// ---------------------------------------------------------------------------
+const store_t *storeAt(uint32_t page) {
+    return (const store_t *)(XIP_BASE+storeOffset+page*FLASH_PAGE_SIZE);
+}
+//
+// ---------------------------------------------------------------------------
+// storeMark - work out which sectors have live entries in them
+// ---------------------------------------------------------------------------
+void storeMark() {
+    storeUsed=0;
+    for(uint i=0;i<STORE_MAXROMS;i++) {
+        if(storePage[i]<0) continue;
+        uint32_t last=storePage[i]+STORE_ENTRY_PAGES(storeAt(storePage[i])->size)-1;
+        for(uint32_t s=storePage[i]/SECTOR_PAGES;s<=last/SECTOR_PAGES;s++) storeUsed|=1u<<s;
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// storeAlloc - room for an entry at the head, never running off the end of
+// the store, with the sectors it starts erased. Core 0 must be held off
+// (storeHold)
+// input:
+//   n - pages
+//   spare - pages that must still be free after it, collecting the oldest
+//           sectors until they are. 0 to take what is there (when collecting)
+// output:
+//   first page, -1 if there isn't room
+// ---------------------------------------------------------------------------
+int32_t storeAlloc(uint32_t n,uint32_t spare) {
+    for(uint tries=0;tries<2*STORE_SECTORS;tries++) {
+        uint32_t at=storeHead+n>storePages?0:storeHead;
+        uint32_t next=at+n+spare>storePages?0:at+n;
+        if(!storeFree(at,n)||(spare&&!storeFree(next,spare))) {
+            if(!spare||!storeCollect()) return -1;
+            continue;
+        }
+        // rest of the newest entry's sector is blank unless a power cut left half a ROM there
+        const uint8_t *b=(const uint8_t *)storeAt(at);
+        uint32_t i=0,blank=at%SECTOR_PAGES?(SECTOR_PAGES-at%SECTOR_PAGES)*FLASH_PAGE_SIZE:0;
+        while(i<blank&&b[i]==0xff) i++;
+        if(i<blank) {
+            storeHead=(at/SECTOR_PAGES+1)*SECTOR_PAGES;
+            continue;
+        }
+        for(uint32_t s=(at+SECTOR_PAGES-1)/SECTOR_PAGES;s<=(at+n-1)/SECTOR_PAGES;s++) storeFlash(s*SECTOR_PAGES,NULL);
+        storeHead=at+n;
+        return at;
+    }
+    return -1;
+}
+//
+// ---------------------------------------------------------------------------
+// storeFree - are pages at to at+n free, no live entries in their sectors
+// apart from the one at is part way through (the newest entry's)
+// ---------------------------------------------------------------------------
+bool storeFree(uint32_t at,uint32_t n) {
+    if(at+n>storePages) return false;
+    for(uint32_t s=(at+SECTOR_PAGES-1)/SECTOR_PAGES;s<=(at+n-1)/SECTOR_PAGES;s++) {
+        if(storeUsed&(1u<<s)) return false;
+    }
+    return true;
+}
+//
+// ---------------------------------------------------------------------------
+// storeCollect - free the oldest sector with live entries in it by moving
+// those entries to the head, oldest first
+// output:
+//   false if they couldn't all be moved
+// ---------------------------------------------------------------------------
+bool storeCollect() {
+    int32_t t=storeOldest(-1,storeSeq);
+    if(t<0) return false;
+    uint32_t sector=storePage[t]/SECTOR_PAGES,upto=storeSeq; // not the copies
+    for(;t>=0;t=storeOldest(sector,upto)) {
+        if(!storeMove(t)) return false;
+    }
+    return true;
+}
+//
+// ---------------------------------------------------------------------------
+// storeOldest - live entry with the lowest seq
+// input:
+//   sector - only entries starting in this sector, -1 any
+//   upto - only entries with a seq up to this
+// output:
+//   its slot in storePage, -1 none
+// ---------------------------------------------------------------------------
+int32_t storeOldest(int32_t sector,uint32_t upto) {
+    int32_t t=-1;
+    for(uint i=0;i<STORE_MAXROMS;i++) {
+        if(storePage[i]<0||(sector>=0&&storePage[i]/SECTOR_PAGES!=sector)) continue;
+        uint32_t seq=storeAt(storePage[i])->seq;
+        if(seq<=upto&&(t<0||seq<storeAt(storePage[t])->seq)) t=i;
+    }
+    return t;
+}
+//
+// ---------------------------------------------------------------------------
+// storeMove - copy an entry to the head with a new seq & delete the old one,
+// not while something is reading it from flash
+// input:
+//   slot - in storePage
+// ---------------------------------------------------------------------------
+bool storeMove(uint slot) {
+    uint8_t page[FLASH_PAGE_SIZE];
+    uint32_t from=storePage[slot];
+    const store_t *h=storeAt(from);
+    const uint8_t *rom=(const uint8_t *)(h+1);
+    uint32_t n=STORE_ENTRY_PAGES(h->size);
+    if((streamLeft&&streamLz.from==rom)||bankJob==rom||(romLaunch&&romEntry(rompos)==rom)) return false;
+    int32_t at=storeAlloc(n,0);
+    if(at<0) return false;
+    for(uint32_t k=1;k<n;k++) {
+        memcpy(page,storeAt(from+k),FLASH_PAGE_SIZE);
+        storeFlash(at+k,page);
+    }
+    memcpy(page,h,FLASH_PAGE_SIZE);
+    store_t *to=(store_t *)page;
+    to->seq=++storeSeq;
+    to->check=h->check-h->seq+to->seq;
+    storeFlash(at,page); // header last, the old copy is still good until then
+    storeKill(from);
+    storePage[slot]=at;
+    storeMark();
+    return true;
+}
+//
+// ---------------------------------------------------------------------------
+// storeHold - keep core 0 off flash so core 1 can write to it. Serving runs
+// from SRAM and the only way out of it is the user button interrupt (also
+// how the USB shell switches ROM), so that is masked
+// output:
+//   false if the button already has core 0, try again later
+// ---------------------------------------------------------------------------
+bool storeHold() {
+    if(!serving) return false;
+    hw_clear_bits(&iobank0_hw->proc0_irq_ctrl.inte[PIN_USER>>3],GPIO_IRQ_EDGE_FALL<<(4*(PIN_USER&7)));
+    busy_wait_us_32(100); // an interrupt taken just before has set buttonBusy by now
+    if(!buttonBusy) return true;
+    storeRelease();
+    return false;
+}
+//
+// ---------------------------------------------------------------------------
+// storeRelease - let the user button in again, a press while held is latched
+// and goes off now
+// ---------------------------------------------------------------------------
+void storeRelease() {
+    hw_set_bits(&iobank0_hw->proc0_irq_ctrl.inte[PIN_USER>>3],GPIO_IRQ_EDGE_FALL<<(4*(PIN_USER&7)));
+}
+//
+// ---------------------------------------------------------------------------
+// storeFlash - program a page of the flash store, or erase a sector, from
+// core 1 with core 0 held off. XIP is off meanwhile so only this core's own
+// interrupts (USB) need stopping
+// input:
+//   page - page of the store, the first of the sector for an erase
+//   data - FLASH_PAGE_SIZE bytes in RAM, NULL to erase
+// ---------------------------------------------------------------------------
+void storeFlash(uint32_t page,const uint8_t *data) {
+    uint32_t ints=save_and_disable_interrupts();
+    if(data==NULL) flash_range_erase(storeOffset+page*FLASH_PAGE_SIZE,FLASH_SECTOR_SIZE);
+    else flash_range_program(storeOffset+page*FLASH_PAGE_SIZE,data,FLASH_PAGE_SIZE);
+    restore_interrupts(ints);
+}
+//
+// ---------------------------------------------------------------------------
+// storeKill - delete an entry, its live word programmed to 0 & nothing else
+// touched. The space comes back when its sectors are reused
+// input:
+//   page - first page of the entry
+// ---------------------------------------------------------------------------
+void storeKill(uint32_t page) {
+    uint8_t data[FLASH_PAGE_SIZE];
+    memset(data,0xff,FLASH_PAGE_SIZE);
+    memset(&data[offsetof(store_t,live)],0,4);
+    storeFlash(page,data);
+}
+//
+// ---------------------------------------------------------------------------
+// storeStart - get ready to write a ROM sent over USB to the flash store.
+// Room is made & erased first so each page can be programmed as soon as its
+// bytes are in, the ROM is never held in RAM
+// input:
+//   size - bytes that will be sent, 34byte header & compressed data
+//   check - 32bit sum of them
+// output:
+//   NULL when ready for the bytes, otherwise why not
+// ---------------------------------------------------------------------------
+const char *storeStart(uint32_t size,uint32_t check) {
+    uint32_t n=STORE_ENTRY_PAGES(size),live=0,spare=n;
+    int32_t slot=-1;
+    if(storePages==0) return "no flash store, the program is in the way";
+    for(uint i=0;i<STORE_MAXROMS;i++) {
+        if(storePage[i]<0) {
+            if(i>=storeCount&&slot<0) slot=i; // deleted catalogue ROMs keep their slot till power off
+            continue;
+        }
+        uint32_t k=STORE_ENTRY_PAGES(storeAt(storePage[i])->size);
+        live+=k;
+        if(k>spare) spare=k;
+    }
+    // room to move the oldest sector's entries out in one go, as much again
+    // for the pages lost at the end of the store & in part used sectors
+    spare=2*(spare+SECTOR_PAGES);
+    if(size<35||live+n+spare+SECTOR_PAGES>storePages) return "too big for the room left";
+    if(slot<0) return "full";
+    if(!storeHold()) return "busy";
+    int32_t at=storeAlloc(n,spare);
+    storeRelease();
+    if(at<0) return "no room, the ROM being served is in the way";
+    memset(&storeNew,0,sizeof(storeNew));
+    memset(storeNew.first,0xff,FLASH_PAGE_SIZE);
+    memset(storeNew.page,0xff,FLASH_PAGE_SIZE);
+    storeNew.at=at;
+    storeNew.check=check;
+    storeNew.size=size;
+    storeNew.last=time_us_32(); // idle from the command until the first byte
+    return NULL;
+}
+//
+// ---------------------------------------------------------------------------
+// storeByte - next byte of a ROM going into the store, a page is programmed
+// as soon as it is full. The first page waits for the rest
+// input:
+//   b - the byte
+// ---------------------------------------------------------------------------
+void storeByte(uint8_t b) {
+    uint32_t k=sizeof(store_t)+storeNew.got++;
+    storeNew.sum+=b;
+    if(storeNew.bad) return;
+    if(k<FLASH_PAGE_SIZE) {
+        storeNew.first[k]=b;
+        return;
+    }
+    storeNew.page[k%FLASH_PAGE_SIZE]=b;
+    if(k%FLASH_PAGE_SIZE==FLASH_PAGE_SIZE-1||storeNew.got==storeNew.size) {
+        if(!storeHold()) {
+            storeNew.bad=true;
+            return;
+        }
+        storeFlash(storeNew.at+k/FLASH_PAGE_SIZE,storeNew.page);
+        storeRelease();
+        memset(storeNew.page,0xff,FLASH_PAGE_SIZE);
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// storeEnd - all the bytes are in, check them & write the first page, which
+// makes it an entry. It joins the catalogue at the next power on
+// output:
+//   NULL if it's good, otherwise why not
+// ---------------------------------------------------------------------------
+const char *storeEnd() {
+    store_t *h=(store_t *)storeNew.first;
+    const uint8_t *from=(const uint8_t *)(storeAt(storeNew.at)+1);
+    uint32_t size=storeNew.size,sum=0;
+    int32_t slot=-1;
+    storeNew.size=0;
+    for(uint i=storeCount;i<STORE_MAXROMS&&slot<0;i++) {
+        if(storePage[i]<0) slot=i;
+    }
+    if(storeNew.bad) return "the button took over part way through";
+    if(storeNew.sum!=storeNew.check) return "checksum wrong";
+    if(!storeHold()) return "busy";
+    h->magic=STORE_MAGIC;
+    h->live=0xffffffff;
+    h->seq=++storeSeq;
+    h->id=++storeId;
+    h->size=size;
+    h->check=storeNew.sum+h->seq+h->id+size;
+    storeFlash(storeNew.at,storeNew.first);
+    for(uint32_t i=0;i<size;i++) sum+=from[i]; // read back
+    if(sum!=storeNew.sum||!storeValid(from,size)) {
+        storeKill(storeNew.at);
+        storeRelease();
+        return sum!=storeNew.sum?"flash didn't read back the same":"not a ROM";
+    }
+    storeRelease();
+    storePage[slot]=storeNew.at;
+    storeMark();
+    return NULL;
+}
+//
+// ---------------------------------------------------------------------------
+// watchdog - called from the core 1 loop, uses the ROM reads counted by the
+// serving loop to spot a failed launch: a Spectrum that hasn't read the ROM
+// at all since RESET was lifted, so isn't running (a running Z80 reads 0x0000
+// first & its refresh cycles are reads while I is below 0x40), or a snapshot
+// loader that never finished. Either resets the Spectrum and relaunches the
+// ROM, waiting longer each time and giving up after WD_RETRIES. It doesn't
+// look for hangs: once a program is running it is left alone, as one that
+// has hung, a game that has gone on to IM2 or DI in RAM and a diagnostic ROM
+// in a long test with interrupts off all stop taking IM1 & look the same
+// from the bus. A relaunch counts as working once IM1 runs at a healthy rate
+// for a second
+// ---------------------------------------------------------------------------
+void watchdog() {
+    static uint32_t epoch=0,ownEpoch=0,launchFetches,windowStart,windowIm1,failAt;
+    static bool recovering=false;
+    static uint retries=0;
+    uint32_t now=time_us_32();
+    if(epoch!=launchEpoch) {
+        // new launch, from the button or a recovery
+        if(launchEpoch!=ownEpoch) {
+            recovering=false;
+            retries=0;
+        }
+        epoch=launchEpoch;
+        wdGaveUp=false;
+        launchFetches=fetchCount;
+        windowStart=now;
+        windowIm1=im1Count;
+        return;
+    }
+    if(!wdEnabled||rompos==0||buttonBusy||wdGaveUp) return;
+    if(now-windowStart>=1000000) {
+        uint32_t rate=im1Count-windowIm1;
+        if(recovering&&rate>=WD_IM1_MIN&&rate<=WD_IM1_MAX) {
+            recovering=false;
+            retries=0;
+            wdRecoverUs=now-failAt;
+            wdRecoverTotal+=wdRecoverUs;
+            printf("watchdog: ROM %d running again %" PRIu32 "us after the failed launch was spotted\n",rompos,wdRecoverUs);
+        }
+        windowIm1=im1Count;
+        windowStart=now;
+    }
+    const char *why=NULL;
+    if((romMode==3||romMode==8)&&!launchDone) {
+        if(now-launchLift>WD_LOAD_US) why="snapshot loader didn't finish";
+    } else if(fetchCount==launchFetches) {
+        if(now-launchLift>WD_LAUNCH_US) why="no ROM reads since launch";
+    }
+    if(why==NULL) return;
+    if(retries>=WD_RETRIES) {
+        wdGaveUp=true;
+        recovering=false;
+        printf("watchdog: ROM %d %s, giving up after %d resets\n",rompos,why,retries);
+        return;
+    }
+    if(!recovering) failAt=now;
+    recovering=true;
+    wdRecoveries++;
+    printf("watchdog: ROM %d %s, reset %d of %d\n",rompos,why,retries+1,WD_RETRIES);
+    uint32_t e=launchEpoch;
+    gpio_put(PIN_RESET,false);
+    busy_wait_us_32(100000<<retries);
+    retries++;
+    if(e!=launchEpoch||buttonBusy) return; // user button took over
+    launchDone=false;
+    romSetup();
+    gpio_put(PIN_RESET,true);
+    launchLift=time_us_32();
+    ownEpoch=++launchEpoch;
+}
+//
+// ---------------------------------------------------------------------------
+// bankRelaunch - the snapshot loader paged to a bank core 1 hadn't unpacked
+// yet & was served stale bytes, so the snapshot is broken. Called once the
+// bank job is done, every bank is in bank1 now so the second launch can't
+// be caught out the same way
+// ---------------------------------------------------------------------------
+void bankRelaunch() {
+    bankLate=false;
+    if(buttonBusy) return;
+    printf("launch: ROM %d loader got to a bank before it was unpacked, relaunching\n",rompos);
+    uint32_t e=launchEpoch;
+    gpio_put(PIN_RESET,false);
+    busy_wait_us_32(100000);
+    if(e!=launchEpoch||buttonBusy) return; // user button took over
+    launchDone=false;
+    romSetup();
+    gpio_put(PIN_RESET,true);
+    launchLift=time_us_32();
+    launchEpoch++;
+}
+//
+// ---------------------------------------------------------------------------
+// shellUpload - start a USB upload, the bytes follow the command line
+// input:
+//   arg - raw or lz, the number of bytes & the 32bit sum of them
+// ---------------------------------------------------------------------------
+void shellUpload(const char *arg) {
+    char *end,*last;
+    bool lz=strncmp(arg,"lz ",3)==0;
+    if(!lz&&strncmp(arg,"raw ",4)!=0) {
+        printf("upload: upload raw|lz <bytes> <checksum>\n");
+        return;
+    }
+    uint32_t size=strtoul(&arg[lz?3:4],&end,0);
+    uint32_t check=strtoul(end,&last,0);
+    if(last==end||*last!=0) {
+        printf("upload: upload raw|lz <bytes> <checksum>\n");
+        return;
+    }
+    if(buttonBusy||shellJob>=0||shellWait||storeNew.size) {
+        printf("upload: busy\n");
+        return;
+    }
+    const char *why=uploadStart(lz,size,check);
+    if(why!=NULL) printf("upload: %s\n",why);
+    else printf("upload: send %" PRIu32 " bytes\n",size);
+}
+//
+// ---------------------------------------------------------------------------
+// shellUploaded - last byte of an upload in, check it & report the throughput
+// ---------------------------------------------------------------------------
+void shellUploaded() {
+    uint32_t us=upload.last-upload.start;
+    if(upload.bad) {
+        printf("upload: not a 16kB or 32kB ROM\n");
+        uploadDrop();
+        return;
+    }
+    const char *why=uploadEnd();
+    if(why!=NULL) {
+        printf("upload: %s\n",why);
+        return;
+    }
+    printf("upload: %" PRIu32 " bytes in %" PRIu32 "us (%" PRIu32 "kB/s), %" PRIu32 " bytes unpacked, goes in at the next reset\n",upload.got,us,us?upload.got*1000/us:0,upload.out);
+}
+//
+// ---------------------------------------------------------------------------
+// shellStore - the flash store, how full it is, add a ROM (the bytes follow
+// the command line) or delete one
+// input:
+//   arg - nothing, lz with the number of bytes & the 32bit sum of them, or
+//         del with a catalogue position
+// ---------------------------------------------------------------------------
+void shellStore(const char *arg) {
+    char *end,*last;
+    if(*arg==0) {
+        uint32_t live=0;
+        uint n=0,sectors=0;
+        for(uint i=0;i<STORE_MAXROMS;i++) {
+            if(storePage[i]<0) continue;
+            n++;
+            live+=storeAt(storePage[i])->size;
+        }
+        for(uint s=0;s<STORE_SECTORS;s++) sectors+=storeUsed>>s&1;
+        printf("store: %d ROMs, %" PRIu32 " bytes in %d of %" PRIu32 " sectors, next entry at page %" PRIu32 " of %" PRIu32 "\n",n,live,sectors,storePages/SECTOR_PAGES,storeHead,storePages);
+        if(storeCount) printf("  ROMs %d-%d from power on\n",storeBase,storeBase+storeCount-1);
+        for(uint i=storeCount;i<STORE_MAXROMS;i++) {
+            if(storePage[i]>=0) printf("  %.32s, joins the list at the next power on\n",(const char *)(storeAt(storePage[i])+1)+2);
+        }
+        return;
+    }
+    if(strncmp(arg,"del ",4)==0) {
+        long pos=strtol(&arg[4],&end,10);
+        if(*end!=0||pos<storeBase||pos>=storeBase+storeCount||storePage[pos-storeBase]<0) {
+            printf("store: ROM %s isn't in the store\n",&arg[4]);
+            return;
+        }
+        if(pos==rompos||storeNew.size||!storeHold()) {
+            printf("store: busy\n");
+            return;
+        }
+        storeKill(storePage[pos-storeBase]);
+        storeRelease();
+        storePage[pos-storeBase]=-1;
+        storeMark();
+        for(uint i=0;i<MENU_SLOTS;i++) menuKey[i]=0xffffffff; // pages drawn with its name
+        printf("store: ROM %ld deleted\n",pos);
+        return;
+    }
+    uint32_t size=strncmp(arg,"lz ",3)==0?strtoul(&arg[3],&end,0):0;
+    uint32_t check=size?strtoul(end,&last,0):0;
+    if(size==0||last==end||*last!=0) {
+        printf("store: store, store lz <bytes> <checksum> or store del <number>\n");
+        return;
+    }
+    if(upload.size||storeNew.size||buttonBusy||shellJob>=0||shellWait) {
+        printf("store: busy\n");
+        return;
+    }
+    const char *why=storeStart(size,check);
+    if(why!=NULL) printf("store: %s\n",why);
+    else printf("store: send %" PRIu32 " bytes\n",size);
+}
+//
+// ---------------------------------------------------------------------------
+// shellStored - last byte of a ROM for the store in, check it & report
+// ---------------------------------------------------------------------------
+void shellStored() {
+    uint32_t us=storeNew.last-storeNew.start;
+    uint32_t got=storeNew.got;
+    const char *why=storeEnd();
+    if(why!=NULL) {
+        printf("store: %s\n",why);
+        return;
+    }
+    printf("store: %" PRIu32 " bytes in %" PRIu32 "us (%" PRIu32 "kB/s), joins the list at the next power on\n",got,us,us?got*1000/us:0);
+}
+//
+// ---------------------------------------------------------------------------
+// uploadStart - get ready for a ROM sent over USB (or anything else, the bytes
+// are fed in one at a time by uploadByte). It is unpacked as it arrives into a
+// run of cache slots at one end of the cache, clear of the ROM being served,
+// and waits there for the next reset. A new upload replaces one still waiting
+// input:
+//   lz - true for a 34byte header & simplelz like a ROM in the catalogue (mode
+//        0 or 1 only), false for a raw 16kB or 32kB (ZXC2) image
+//   size - bytes that will be sent
+//   check - 32bit sum of them
+// output:
+//   NULL when ready for the bytes, otherwise why not
+// ---------------------------------------------------------------------------
+const char *uploadStart(bool lz,uint32_t size,uint32_t check) {
+    uint slots=lz?CACHE_MAXSIZE/16384:size/16384;
+    uint k;
+    if(lz?size<35||size>CACHE_MAXSIZE+CACHE_MAXSIZE/64+34:size!=16384&&size!=32768) return "wrong size";
+    uploadDrop();
+    // either end so a 32kB ROM always has a run of slots left, least recently used end first
+    int32_t first=-1;
+    uint32_t best=0;
+    for(uint e=0;e<2;e++) {
+        uint s=e==0?0:CACHE_SLOTS-slots;
+        uint32_t age=0;
+        for(k=s;k<s+slots;k++) {
+            if(romCache[k]>=romData&&romCache[k]<romData+romLen) break; // being served
+            if(cacheRom[k]>=0&&cacheUsed[k]>age) age=cacheUsed[k];
+        }
+        if(k==s+slots&&(first<0||age<best)) {
+            first=s;
+            best=age;
+        }
+    }
+    if(first<0) return "no room in the cache beside the ROM being served";
+    // evict whatever is there, including the other half of a 32kB ROM
+    for(k=first;k<first+slots;k++) {
+        int32_t old=cacheRom[k];
+        if(old<0) continue;
+        for(uint s=0;s<CACHE_SLOTS;s++) {
+            if(cacheRom[s]==old) cacheRom[s]=-1;
+        }
+    }
+    for(k=first;k<first+slots;k++) cacheRom[k]=UPLOAD_BUSY;
+    memset(&upload,0,sizeof(upload));
+    upload.to=romCache[first];
+    upload.max=slots*16384;
+    upload.lz=lz;
+    upload.check=check;
+    if(!lz) {
+        upload.head[0]=size>16384; // ZXC2 if 32kB
+        memcpy(&upload.head[2],"USB upload",10);
+    }
+    upload.size=size;
+    upload.last=time_us_32(); // idle from the command until the first byte
+    return NULL;
+}
+//
+// ---------------------------------------------------------------------------
+// uploadByte - next byte of an upload, unpacked into the slots straight away
+// input:
+//   b - the byte
+// output:
+//   false if it can't be a ROM that fits, the upload is no good
+// ---------------------------------------------------------------------------
+bool uploadByte(uint8_t b) {
+    upload.sum+=b;
+    if(!upload.lz) {
+        upload.to[upload.got++]=b;
+        upload.out=upload.got;
+        return true;
+    }
+    if(upload.got<34) {
+        upload.head[upload.got++]=b;
+        return upload.got<34||(upload.head[0]<=1&&upload.head[1]==0); // plain ROM or ZXC2
+    }
+    upload.got++;
+    if(upload.end) return false; // more after the end marker
+    if(upload.run) {
+        if(upload.out>=upload.max) return false;
+        upload.to[upload.out++]=b;
+        upload.run--;
+    } else if(upload.offset) {
+        uint n=upload.c-126;
+        if(b+1u>upload.out||upload.out+n>upload.max) return false;
+        for(uint k=0;k<n;k++,upload.out++) upload.to[upload.out]=upload.to[upload.out-(b+1)];
+        upload.offset=false;
+    } else {
+        upload.c=b;
+        if(b<128) upload.run=b+1;
+        else if(b>128) upload.offset=true;
+        else upload.end=true;
+    }
+    return true;
+}
+//
+// ---------------------------------------------------------------------------
+// uploadEnd - all the bytes are in, check them. A good upload goes in at the
+// next reset, a 16kB one gives back the second slot it was given
+// output:
+//   NULL if it's good, otherwise why not
+// ---------------------------------------------------------------------------
+const char *uploadEnd() {
+    const char *why=NULL;
+    if(upload.sum!=upload.check) why="checksum wrong";
+    else if(upload.lz&&(!upload.end||upload.run||upload.offset)) why="ends part way through";
+    else if(upload.out==0) why="nothing in it";
+    if(why!=NULL) {
+        uploadDrop();
+        return why;
+    }
+    upload.size=0;
+    if(upload.max>16384&&upload.out<=16384) cacheRom[(upload.to-romCache[0])/16384+1]=-1;
+    uploadSwap=true;
+    return NULL;
+}
+//
+// ---------------------------------------------------------------------------
+// uploadDrop - give up an upload, or the one waiting for the next reset
+// ---------------------------------------------------------------------------
+void uploadDrop() {
+    for(uint k=0;k<CACHE_SLOTS;k++) {
+        if(cacheRom[k]==UPLOAD_BUSY) cacheRom[k]=-1;
+    }
+    uploadSwap=false;
+    upload.size=0;
+}
+//
+// ---------------------------------------------------------------------------
+// uploadIn - the waiting upload becomes ROM romCount, replacing the last one.
+// Called from romSelect() with the Spectrum held in RESET
+// ---------------------------------------------------------------------------
+void uploadIn() {
+    for(uint k=0;k<CACHE_SLOTS;k++) {
+        if(cacheRom[k]==(int32_t)romCount) cacheRom[k]=-1;
+        else if(cacheRom[k]==UPLOAD_BUSY) cacheRom[k]=romCount;
+    }
+    memcpy(uploadHead,upload.head,34);
+    uploadLen=upload.out;
+    uploadSwap=false;
+}
+//
+// ---------------------------------------------------------------------------
+// uploadSlot - cache slot holding the last upload to go in
+// output:
+//   the slot, -1 if there isn't one or it has been evicted since
+// ---------------------------------------------------------------------------
+int32_t uploadSlot() {
+    for(uint k=0;k<CACHE_SLOTS;k++) {
+        if(cacheRom[k]==(int32_t)romCount) return k;
+    }
+    return -1;
+}
+//
+// ---------------------------------------------------------------------------
+// shellPoll - called from the core 1 loop, the USB shell. Takes whatever has
+// arrived over USB without waiting & runs a command once its line is complete.
+// A listing goes out a ROM at a time and a select is reported once the
+// Spectrum reads the new ROM, so the rest of the loop keeps going
+// ---------------------------------------------------------------------------
+void shellPoll() {
+    static char line[SHELL_LINE];
+    static uint len=0;
+    static uint32_t fetches;
+    static bool lifted=false;
+    int c;
+    if(shellListPos>=0) shellList();
+    if(shellWait) {
+        // resetButton() does the switch, then the first ROM read is the new ROM being served
+        uint32_t now=time_us_32();
+        if(!lifted) {
+            if(launchEpoch!=shellEpoch&&!buttonBusy) {
+                lifted=true;
+                fetches=fetchCount;
+            }
+        } else if(fetchCount!=fetches) {
+            printf("shell: ROM %d serving %" PRIu32 "us after the command, RESET lifted at %" PRIu32 "us\n",rompos,now-shellStart,launchLift-shellStart);
+            lifted=shellWait=false;
+        } else if(now-launchLift>SHELL_SERVE_US) {
+            printf("shell: ROM %d not read since RESET was lifted\n",rompos);
+            lifted=shellWait=false;
+        }
+    }
+    uint n=0;
+    while(n++<256&&(c=getchar_timeout_us(0))!=PICO_ERROR_TIMEOUT) {
+        if(upload.size) {
+            // upload, bytes go straight into the cache slots
+            upload.last=time_us_32();
+            if(upload.got==0) upload.start=upload.last;
+            if(upload.bad) upload.got++;
+            else if(!uploadByte(c)) upload.bad=true;
+            if(upload.got==upload.size) shellUploaded();
+            continue;
+        }
+        if(storeNew.size) {
+            // store, programmed into flash a page at a time
+            storeNew.last=time_us_32();
+            if(storeNew.got==0) storeNew.start=storeNew.last;
+            storeByte(c);
+            if(storeNew.got==storeNew.size) shellStored();
+            continue;
+        }
+        if(c=='\r'||c=='\n') {
+            if(len==0) continue;
+            printf("\n");
+            line[len]=0;
+            len=0;
+            shellRun(line);
+        } else if((c==0x08||c==0x7f)&&len>0) {
+            len--;
+            printf("\b \b");
+        } else if(c>=0x20&&c<0x7f&&len<SHELL_LINE-1) {
+            line[len++]=c;
+            putchar(c); // echo
+        }
+    }
+    if(upload.size&&time_us_32()-upload.last>UPLOAD_IDLE_US) {
+        printf("upload: stopped, nothing more after %" PRIu32 " of %" PRIu32 " bytes\n",upload.got,upload.size);
+        uploadDrop();
+    }
+    if(storeNew.size&&time_us_32()-storeNew.last>UPLOAD_IDLE_US) {
+        printf("store: stopped, nothing more after %" PRIu32 " of %" PRIu32 " bytes\n",storeNew.got,storeNew.size);
+        storeNew.size=0; // the pages written are left for the next lap
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// shellRun - one USB shell command
+// input:
+//   line - command & its argument
+// ---------------------------------------------------------------------------
+void shellRun(char *line) {
+    char *arg=strchr(line,' ');
+    if(arg==NULL) {
+        arg=&line[strlen(line)];
+    } else {
+        *arg++=0;
+        while(*arg==' ') arg++;
+    }
+    if(strcmp(line,"list")==0) {
+        shellListPos=0;
+    } else if(strcmp(line,"select")==0) {
+        shellSelect(arg);
+    } else if(strcmp(line,"stats")==0) {
+        shellStats();
+    } else if(strcmp(line,"upload")==0) {
+        shellUpload(arg);
+    } else if(strcmp(line,"store")==0) {
+        shellStore(arg);
+    } else if(strcmp(line,"reset")==0) {
+        shellSwitch(uploadSwap?romCount:rompos);
+    } else if(strcmp(line,"seq")==0) {
+        shellSeq(arg);
+    } else if(strcmp(line,"wd")==0) {
+        if(strcmp(arg,"on")==0) wdEnabled=true;
+        else if(strcmp(arg,"off")==0) wdEnabled=false;
+        else if(arg[0]!=0) printf("shell: wd on or off\n");
+        printf("watchdog %s\n",wdEnabled?"on":"off");
+    } else if(strcmp(line,"help")==0) {
+        printf("shell: list, select <number or name>, stats, upload raw|lz <bytes> <checksum>, reset,\n");
+        printf("       store, store lz <bytes> <checksum>, store del <number>,\n");
+        printf("       seq, seq stop, seq <seconds> <number or name>, <seconds> <number or name>...,\n");
+        printf("       wd, wd on|off\n");
+    } else {
+        printf("shell: %s? try help\n",line);
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// shellList - next line of the listing, * marks the ROM being served
+// ---------------------------------------------------------------------------
+void shellList() {
+    static const char *modes[]={"ROM","ZXC2","?","48k","data","tape","?","?","128k"};
+    uint16_t pos=shellListPos;
+    const uint8_t *from=romEntry(pos);
+    if(pos==0) {
+        printf("%c %4d                interface off\n",rompos==0?'*':' ',pos);
+    } else {
+        const char *mode=from[0]<=8?modes[from[0]]:"?";
+        if(from[0]==4&&seqText(pos,NULL,0)) mode="seq";
+        printf("%c %4d %-4s %7" PRIu32 " %.32s\n",rompos==pos?'*':' ',pos,mode,romSize(from),&from[2]);
+    }
+    if(++shellListPos<romCount) return;
+    shellListPos=-1;
+    if(uploadSlot()>=0) {
+        printf("%c %4d %-4s %7" PRIu32 " %.32s (USB upload)\n",rompos==romCount?'*':' ',romCount,modes[uploadHead[0]],uploadLen,&uploadHead[2]);
+    }
+    if(uploadSwap) {
+        printf("       %-4s %7" PRIu32 " %.32s (USB upload, goes in at the next reset)\n",modes[upload.head[0]],upload.out,&upload.head[2]);
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// shellSelect - switch ROM the way the ROM Explorer does
+// input:
+//   arg - catalogue position, or a name or the start of only one (any case)
+// ---------------------------------------------------------------------------
+void shellSelect(const char *arg) {
+    char *end;
+    int32_t pos=-1;
+    uint found;
+    if(*arg==0) {
+        printf("shell: select <number or name>\n");
+        return;
+    }
+    long n=strtol(arg,&end,10);
+    if(*end==0) {
+        uint last=romCount-(uploadSlot()<0&&!uploadSwap); // an upload is ROM romCount
+        if(n<0||n>last) {
+            printf("shell: no ROM %ld, 0-%d\n",n,last);
+            return;
+        }
+        pos=n;
+    } else {
+        pos=romFind(arg,&found);
+        if(found==0) {
+            printf("shell: no ROM called %s\n",arg);
+            return;
+        }
+        if(found>1) {
+            printf("shell: %d ROMs start with %s\n",found,arg);
+            return;
+        }
+    }
+    if(romEntry(pos)[0]==4&&seqText(pos,NULL,0)==0) {
+        printf("shell: ROM %" PRId32 " is a data entry\n",pos);
+        return;
+    }
+    shellSwitch(pos);
+}
+//
+// ---------------------------------------------------------------------------
+// romFind - ROM whose name is name or the only one starting with it, any case.
+// Data entries other than sequences are left out
+// input:
+//   name - whole name or the start of one
+//   found - set to the number of ROMs matching
+// output:
+//   catalogue position, the first match when there is more than one, -1 none
+// ---------------------------------------------------------------------------
+int32_t romFind(const char *name,uint *found) {
+    char query[32];
+    int32_t pos=-1;
+    uint len=0;
+    *found=0;
+    while(name[len]&&len<32) {
+        query[len]=name[len]>='a'&&name[len]<='z'?name[len]-32:name[len];
+        len++;
+    }
+    for(uint i=1;i<romCount;i++) {
+        const uint8_t *from=romEntry(i);
+        if(nameCmp(from,query,len)!=0||(from[0]==4&&seqText(i,NULL,0)==0)) continue;
+        if(len==32||from[2+len]==0) {
+            *found=1; // whole name
+            return i;
+        }
+        if((*found)++==0) pos=i;
+    }
+    return pos;
+}
+//
+// ---------------------------------------------------------------------------
+// shellSwitch - switch ROM from the USB shell & report it once it is served,
+// stopping any sequence that is running
+// input:
+//   pos - catalogue position
+// ---------------------------------------------------------------------------
+void shellSwitch(int32_t pos) {
+    if(upload.size||storeNew.size||buttonBusy||shellJob>=0||shellWait) {
+        printf("shell: busy\n");
+        return;
+    }
+    seqAt=-1;
+    shellEpoch=launchEpoch;
+    shellWait=true;
+    romSwitch(pos);
+}
+//
+// ---------------------------------------------------------------------------
+// romSwitch - have resetButton() switch ROM with the Spectrum in RESET, set
+// off by forcing the user button's interrupt. Core 1 only
+// input:
+//   pos - catalogue position
+// ---------------------------------------------------------------------------
+void romSwitch(int32_t pos) {
+    shellStart=time_us_32();
+    shellJob=pos;
+    __dmb();
+    hw_set_bits(&iobank0_hw->proc0_irq_ctrl.intf[PIN_USER>>3],GPIO_IRQ_EDGE_FALL<<(4*(PIN_USER&7)));
+}
+//
+// ---------------------------------------------------------------------------
+// shellStats - counters since power on & timings of the last launch
+// ---------------------------------------------------------------------------
+void shellStats() {
+    const uint8_t *from=romEntry(rompos);
+    if(rompos==0) printf("ROM 0 interface off\n");
+    else printf("ROM %d %.32s (%" PRIu32 "bytes)\n",rompos,&from[2],romLen);
+    printf("  ROM reads %" PRIu32 ", IM1 %" PRIu32 ", cache hits %" PRIu32 " misses %" PRIu32 "\n",fetchCount,im1Count,cacheHits,cacheMisses);
+    printf("  last launch: RESET lifted %" PRIu32 "us after selection",launchUnpack);
+    if(launchDone) printf(", snapshot running after %" PRIu32 "us, late banks %" PRIu32,launchGame,bankStalls);
+    printf("\n  watchdog %s: %" PRIu32 " recoveries, last took %" PRIu32 "us, %" PRIu32 "us in total\n",wdEnabled?"on":"off",wdRecoveries,wdRecoverUs,wdRecoverTotal);
+}
+//
+// ---------------------------------------------------------------------------
+// shellSeq - the sequence & how far it has got, stop it, or start a new one
+// input:
+//   arg - nothing, stop, or the stages split by commas
+// ---------------------------------------------------------------------------
+void shellSeq(const char *arg) {
+    if(*arg==0) {
+        if(seqCount==0) {
+            printf("seq: no sequence, seq <seconds> <number or name>, ...\n");
+            return;
+        }
+        printf("seq: %d stages, %s\n",seqCount,seqAt<0?"not running":"running");
+        for(uint i=0;i<seqCount;i++) {
+            const seqStage_t *st=&seqStages[i];
+            printf("%c %2d %4d %-32.32s ",(int32_t)i==seqAt?'>':' ',i+1,st->rom,&romEntry(st->rom)[2]);
+            if(st->seconds) printf("%4ds",st->seconds);
+            else printf("    -");
+            if(st->end!=NULL) printf("  %s after %" PRIu32 "ms",st->end,st->ran);
+            printf("\n");
+        }
+        return;
+    }
+    if(strcmp(arg,"stop")==0) {
+        seqAt=-1; // the ROM being served carries on
+        return;
+    }
+    if(upload.size||storeNew.size||buttonBusy||shellJob>=0||shellWait) {
+        printf("shell: busy\n");
+        return;
+    }
+    seqStage_t stages[SEQ_STAGES];
+    uint count;
+    const char *why=seqParse(arg,stages,&count);
+    if(why!=NULL) {
+        printf("seq: %s\n",why);
+        return;
+    }
+    seqBegin(stages,count,false);
+}
+//
+// ---------------------------------------------------------------------------
+// seqText - text of a sequence entry, a data entry (mode 4) starting "seq"
+// input:
+//   pos - catalogue position
+//   to - where the text goes, NULL just to check the entry is a sequence
+//   max - room there, the text is cut short to fit
+// output:
+//   bytes of text, 0 if it isn't a sequence
+// ---------------------------------------------------------------------------
+uint seqText(uint16_t pos,char *to,uint max) {
+    char head[5];
+    if(to==NULL) {
+        to=head;
+        max=sizeof(head);
+    }
+    if(pos==0||pos>=romCount||max<5) return 0;
+    const uint8_t *from=romEntry(pos);
+    if(from[0]!=4) return 0;
+    lzStream_t lz;
+    memset(&lz,0,sizeof(lz));
+    lz.from=from;
+    lz.j=34; // skip the header
+    uint32_t len=romSize(from);
+    uint i=0;
+    while(i<max-1&&i<len) to[i++]=lzNext(&lz);
+    to[i]=0;
+    if(strncmp(to,"seq",3)!=0||(to[3]!=0&&to[3]!=' '&&to[3]!='\r'&&to[3]!='\n')) return 0;
+    return i;
+}
+//
+// ---------------------------------------------------------------------------
+// seqParse - stages of a sequence, one a line or split by commas, each a ROM
+// number or name with the seconds it is given in front. Without the seconds
+// it gets SEQ_SECONDS, 0 runs it until it parks or fails to launch. Blank lines & lines
+// starting # are skipped
+// input:
+//   text - the stages
+//   to - SEQ_STAGES stages
+//   count - set to the number of stages
+// output:
+//   NULL, or what is wrong with them
+// ---------------------------------------------------------------------------
+const char *seqParse(const char *text,seqStage_t *to,uint *count) {
+    static char why[64];
+    char stage[48];
+    uint n=0;
+    while(true) {
+        while(*text==' '||*text=='\t'||*text=='\r'||*text=='\n'||*text==',') text++;
+        if(*text==0) break;
+        if(*text=='#') {
+            while(*text!=0&&*text!='\n') text++;
+            continue;
+        }
+        uint len=0;
+        while(text[len]!=0&&text[len]!='\r'&&text[len]!='\n'&&text[len]!=',') len++;
+        const char *next=&text[len];
+        while(len>0&&(text[len-1]==' '||text[len-1]=='\t')) len--;
+        if(len>=sizeof(stage)) len=sizeof(stage)-1;
+        memcpy(stage,text,len);
+        stage[len]=0;
+        text=next;
+        if(n==SEQ_STAGES) {
+            snprintf(why,sizeof(why),"more than %d stages",SEQ_STAGES);
+            return why;
+        }
+        // seconds first if there is anything after them
+        char *rom=stage,*end;
+        long seconds=strtol(stage,&end,10);
+        if(end!=stage&&*end==' ') {
+            while(*end==' ') end++;
+            rom=end;
+        } else {
+            seconds=SEQ_SECONDS;
+        }
+        if(seconds<0||seconds>3600) {
+            snprintf(why,sizeof(why),"stage %d, 0-3600 seconds",n+1);
+            return why;
+        }
+        int32_t pos;
+        long r=strtol(rom,&end,10);
+        if(end!=rom&&*end==0) {
+            if(r<0||r>=romCount) {
+                snprintf(why,sizeof(why),"stage %d, no ROM %ld",n+1,r);
+                return why;
+            }
+            pos=r;
+        } else {
+            uint found;
+            pos=romFind(rom,&found);
+            if(found!=1) {
+                snprintf(why,sizeof(why),"stage %d, %s ROM called %.24s",n+1,found?"more than one":"no",rom);
+                return why;
+            }
+        }
+        if(romEntry(pos)[0]==4) {
+            snprintf(why,sizeof(why),"stage %d, ROM %" PRId32 " is a data entry",n+1,pos);
+            return why;
+        }
+        to[n].rom=pos;
+        to[n].seconds=seconds;
+        to[n].ran=0;
+        to[n].end=NULL;
+        n++;
+    }
+    if(n==0) return "no stages";
+    *count=n;
+    return NULL;
+}
+//
+// ---------------------------------------------------------------------------
+// seqEntry - start the sequence in a catalogue entry. Called by romSelect()
+// & at power on with the Spectrum in RESET, so its first ROM is put in there
+// & then rather than by the sequencer
+// input:
+//   pos - catalogue position
+// output:
+//   the first ROM, -1 if it isn't a sequence or it is a bad one
+// ---------------------------------------------------------------------------
+int32_t seqEntry(uint16_t pos) {
+    static char text[SEQ_TEXT];
+    seqStage_t stages[SEQ_STAGES];
+    uint count;
+    if(seqText(pos,text,sizeof(text))==0) return -1;
+    const char *why=seqParse(&text[3],stages,&count);
+    if(why!=NULL) {
+        seqError=why; // reported by core 1
+        return -1;
+    }
+    seqBegin(stages,count,true);
+    return stages[0].rom;
+}
+//
+// ---------------------------------------------------------------------------
+// seqBegin - make stages the sequence being run, from its first stage
+// input:
+//   stages - the stages
+//   count - how many
+//   loaded - the first stage's ROM is already being put in
+// ---------------------------------------------------------------------------
+void seqBegin(const seqStage_t *stages,uint count,bool loaded) {
+    seqAt=-1;
+    memcpy(seqStages,stages,count*sizeof(seqStage_t));
+    seqCount=count;
+    seqLoaded=loaded;
+    seqEpoch=launchEpoch;
+    seqRun++;
+    __dmb(); // stages written before core 1 sees the sequence
+    seqAt=0;
+}
+//
+// ---------------------------------------------------------------------------
+// seqPoll - called from the core 1 loop, runs the sequence. Each stage's ROM
+// is switched to the way the USB shell does it & the stage ends when its time
+// is up, when the watchdog gives up on it or when it parks: ROM reads going on
+// mostly from one or two bytes (DI HALT, JR $) & no IM1 interrupts, which is
+// how diagnostic ROMs stop once they are done. The address read is sampled
+// every SEQ_SAMPLE_US rather than watched on core 0. With I below 0x40 every
+// refresh cycle is a ROM read too, I<<8|R going round 128 addresses, so a
+// park is one range having SEQ_PARK_SHARE of a SEQ_PARK_US run of samples, not
+// all of them, & IM1 has to come at its 50 a second as refresh cycles read
+// 0x0038 thousands of times a second with I at 0. Every stage is reported over
+// USB as it ends
+// ---------------------------------------------------------------------------
+void seqPoll() {
+    static uint32_t run=0,start,lift,sampleAt,parkStart,parkIm1,im1At,im1Was,firstIm1,resets;
+    static uint32_t parkFetches,parkSamples,parkHits[SEQ_PARK_SLOTS],parkMiss[SEQ_PARK_SLOTS];
+    static uint16_t parkAt[SEQ_PARK_SLOTS],parkedAt;
+    static int32_t at=-1;               // stage being watched, -1 none
+    static bool waiting=false;          // stage's ROM asked for, RESET not lifted on it yet
+    static bool powerOn;
+    if(seqError!=NULL) {
+        printf("seq: %s\n",seqError);
+        seqError=NULL;
+    }
+    if(buttonBusy||shellJob>=0) return; // a switch is under way
+    uint32_t now=time_us_32();
+    if(at>=0&&(seqAt!=at||seqRun!=run)) {
+        printf("seq: stopped in stage %d of %d, ROM %d, %" PRIu32 "ms after RESET was lifted\n",at+1,seqCount,seqStages[at].rom,(now-lift)/1000);
+        at=-1;
+    }
+    if(seqAt<0) {
+        waiting=false;
+        return;
+    }
+    if(run!=seqRun) {
+        run=seqRun;
+        waiting=false;
+        start=now;
+        printf("seq: %d stages\n",seqCount);
+    }
+    if(at<0) {
+        // next stage, its ROM switched to unless it is the first & already in
+        if(!waiting) {
+            powerOn=seqLoaded&&seqEpoch==0; // started in main() before RESET was first lifted
+            if(seqLoaded) {
+                seqLoaded=false;
+            } else {
+                if(upload.size||storeNew.size||shellWait) return;
+                seqEpoch=launchEpoch;
+                seqSwitch=true;
+                romSwitch(seqStages[seqAt].rom);
+            }
+            waiting=true;
+            return;
+        }
+        if(launchEpoch==seqEpoch) return;
+        waiting=false;
+        at=seqAt;
+        lift=launchLift;
+        im1Was=parkIm1=im1Count;
+        firstIm1=0;
+        resets=wdRecoveries;
+        sampleAt=parkStart=im1At=now;
+        parkFetches=fetchCount;
+        parkSamples=0;
+        memset(parkHits,0,sizeof(parkHits));
+        memset(parkMiss,0,sizeof(parkMiss));
+        const seqStage_t *st=&seqStages[at];
+        printf("seq: stage %d of %d, ROM %d %.32s, ",at+1,seqCount,st->rom,&romEntry(st->rom)[2]);
+        if(powerOn) printf("from power on\n");
+        else printf("RESET lifted %" PRIu32 "us after the switch\n",launchUnpack);
+        return;
+    }
+    seqStage_t *st=&seqStages[at];
+    const char *end=NULL;
+    bool parked=false;
+    if(now-im1At>=1000000) {
+        uint32_t rate=im1Count-im1Was;
+        if(firstIm1==0&&rate>=WD_IM1_MIN&&rate<=WD_IM1_MAX) firstIm1=now-lift;
+        im1Was=im1Count;
+        im1At=now;
+    }
+    if(now-sampleAt>=SEQ_SAMPLE_US) {
+        sampleAt=now;
+        uint16_t a=lastAddress;
+        parkSamples++;
+        if(fetchCount!=parkFetches) { // not running in RAM
+            // counted against the range it is in, or replacing the least seen range
+            uint k,least=0;
+            for(k=0;k<SEQ_PARK_SLOTS;k++) {
+                if(parkHits[k]&&(uint16_t)(a-parkAt[k]+SEQ_PARK-1)<2*SEQ_PARK-1) break;
+                if(parkHits[k]<parkHits[least]) least=k;
+            }
+            if(k<SEQ_PARK_SLOTS) {
+                parkHits[k]++;
+            } else {
+                parkAt[least]=a;
+                parkMiss[least]=parkHits[least]; // counted before it was this range, it may have had them all
+                parkHits[least]++;
+            }
+        }
+        parkFetches=fetchCount;
+        if(now-parkStart>=SEQ_PARK_US) {
+            uint k,most=0;
+            for(k=1;k<SEQ_PARK_SLOTS;k++) {
+                if(parkHits[k]-parkMiss[k]>parkHits[most]-parkMiss[most]) most=k;
+            }
+            uint32_t rate=(im1Count-parkIm1)/((now-parkStart)/1000000);
+            parked=(parkHits[most]-parkMiss[most])*100>=parkSamples*SEQ_PARK_SHARE&&(rate<WD_IM1_MIN||rate>WD_IM1_MAX);
+            if(parked) {
+                end="parked";
+                parkedAt=parkAt[most];
+            }
+            parkIm1=im1Count;
+            parkStart=now;
+            parkSamples=0;
+            memset(parkHits,0,sizeof(parkHits));
+        memset(parkMiss,0,sizeof(parkMiss));
+        }
+    }
+    if(wdGaveUp) {
+        end="launch failed";
+        parked=false;
+    } else if(st->seconds&&now-lift>=st->seconds*1000000u) end="time up";
+    if(end==NULL) return;
+    st->ran=(now-lift)/1000;
+    st->end=end;
+    printf("seq: stage %d of %d, ROM %d %s after %" PRIu32 "ms",at+1,seqCount,st->rom,end,st->ran);
+    if(parked) printf(" at 0x%04x",parkedAt);
+    if(firstIm1) printf(", IM1 running by %" PRIu32 "ms",firstIm1/1000);
+    else printf(", no IM1");
+    if(launchDone) printf(", snapshot running after %" PRIu32 "us",launchGame);
+    printf(", %" PRIu32 " watchdog resets\n",wdRecoveries-resets);
+    at=-1;
+    if(seqAt+1<(int32_t)seqCount) {
+        seqAt=seqAt+1;
+        return;
+    }
+    seqAt=-1; // the last ROM carries on
+    printf("seq: done, %d stages in %" PRIu32 "ms\n",seqCount,(now-start)/1000);
+}
+//
+// ---------------------------------------------------------------------------
+// housekeeping - core 1 loop, anything slow or USB related lives here so the
+// serving loop on core 0 is never held up
+// ---------------------------------------------------------------------------
+void housekeeping() {
+    multicore_lockout_victim_init(); // core 0 parks this core while it writes to flash
+    core1Ready=true;
+    stdio_init_all(); // USB stdio, its interrupts then run on this core
+    bool bootReported=false;
+    while(true) {
+        if(!bootReported&&stdio_usb_connected()) {
+            bootReported=true;
+            printf("%s %s: ready to serve ROM %d %" PRIu32 "us after power on, fast boot %s\n",PROG_NAME,VERSION_NUM,rompos,bootReady,settings.fastBoot?"on":"off");
+            printf("  %" PRIu32 " MB flash, %d ROMs %s\n",flashSize>>20,storeBase,pack!=NULL?"from the ROM pack":"compiled in");
+            if(storePages) printf("  %d ROMs from the flash store\n",storeCount);
+        }
+        // ROM Explorer key, move the cursor & build the page if it changed
+        if(navJob>=0) {
+            navKey(navJob,navJob>>8);
+            navReply();
+            navJob=-1;
+        }
+        // ROM Explorer preview, loading screen of the snapshot under the cursor
+        if(previewJob>=0) {
+            previewReply(previewJob);
+            previewJob=-1;
+        }
+        // stream port, open a new stream then keep the ring topped up
+        if(streamStop) {
+            streamLeft=0;
+            streamBuf=streamRing;
+            streamMask=STREAM_RING-1;
+            streamStop=false;
+        }
+        if(streamJob>=0) {
+            streamOpen(streamJob);
+            streamJob=-1;
+        }
+        streamFill();
+        // rest of a banked snapshot
+        if(bankJob!=NULL) {
+            const uint8_t *from=bankJob;
+            uint32_t j=bankNext;
+            for(uint b=1,n=romStreams(from);b<n;b++) {
+                j=dtoBank(&bank1[b*16384],from,j);
+                __dmb(); // bank written before core 0 is told
+                banksReady=b+1;
+            }
+            banksReady=8;
+            bankJob=NULL;
+        }
+        if(bankLate) bankRelaunch();
+        watchdog();
+        seqPoll();
+        shellPoll();
+        if(statsChanged) {
+            statsChanged=false;
+            if(launchDone) {
+                printf("  snapshot running %" PRIu32 "us after selection, late banks %" PRIu32 "\n",launchGame,bankStalls);
+            } else {
+                printf("%s %s: ROM %d (%" PRIu32 "bytes) RESET lifted %" PRIu32 "us after selection, cache hits %" PRIu32 " misses %" PRIu32 "\n",PROG_NAME,VERSION_NUM,rompos,romLen,launchUnpack,cacheHits,cacheMisses);
+                printf("  watchdog: %" PRIu32 " recoveries, last took %" PRIu32 "us, %" PRIu32 "us in total\n",wdRecoveries,wdRecoverUs,wdRecoverTotal);
+            }
+        }
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// dtoBuffer - decompress compressed ROM directly into buffer (simple LZ)
+// input:
+//   to - the buffer
+//   from - the compressed storage
+// *simple LZ has a simple 256 backwards window and greedy parser but is very
+// fast
+// ---------------------------------------------------------------------------
+void dtoBuffer(uint8_t *to,const uint8_t *from) { 
+    uint32_t j=dtoBank(to,from,34); // start j at 34 to skip header
+    if(from[1]&FLAG_BANKED) {
+        for(uint b=1,n=romStreams(from);b<n;b++) j=dtoBank(&to[b*16384],from,j);
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// dtoBank - decompress a single compressed stream, the whole ROM or one bank
+// of a banked snapshot
+// input:
+//   to - the buffer
+//   from - the compressed storage
+//   j - where the stream starts in from
+// output:
+//   where the next stream starts
+// ---------------------------------------------------------------------------
+uint32_t dtoBank(uint8_t *to,const uint8_t *from,uint32_t j) { 
+    uint i=0,k;
+    uint8_t c,o;
+    do {
+        c=from[j++];
+        if(c==128) return j;
+        else if(c<128) {
+            for(k=0;k<c+1u;k++) to[i++]=from[j++];
+        }
+        else {
+            o=from[j++]; // offset
+            for(k=0;k<(c-126u);k++) {
+                to[i]=to[i-(o+1)];
+                i++;
+            }
+        }
+    } while(true);
+}
+//
+// ---------------------------------------------------------------------------
+// romStreams - number of compressed streams in a ROM
+// input:
+//   from - the compressed storage
+// ---------------------------------------------------------------------------
+uint romStreams(const uint8_t *from) {
+    if(from[1]&FLAG_LAUNCH) return from[0]==5?2:from[0]+1-romSparse(from); // loader ROM & tape, or & RAM banks
+    if(from[1]&FLAG_BANKED) return from[0]-romSparse(from);
+    return 1;
+}
+//
+// ---------------------------------------------------------------------------
+// romSparse - number of 128k banks left out of a FLAG_SPARSE snapshot, read
+// from the loader at the start of ROM 0 so only SNAP_SPARSE bytes are unpacked
+// input:
+//   from - the compressed storage
+// ---------------------------------------------------------------------------
+uint romSparse(const uint8_t *from) {
+    if(!(from[1]&FLAG_SPARSE)) return 0;
+    lzStream_t s={.from=from,.j=34}; // start j at 34 to skip header
+    for(uint k=0;k<SNAP_SPARSE;k++) lzNext(&s);
+    return __builtin_popcount(lzNext(&s));
+}
+//
+// ---------------------------------------------------------------------------
+// romSize - unpacked size of a compressed ROM, walks the tokens without
+// unpacking anything
+// input:
+//   from - the compressed storage
+// ---------------------------------------------------------------------------
+uint32_t romSize(const uint8_t *from) {
+    uint32_t i=0,j=34; // start j at 34 to skip header
+    uint b=romStreams(from);
+    uint8_t c;
+    do {
+        c=from[j++];
+        if(c<128) {
+            i+=c+1;
+            j+=c+1;
+        } else if(c>128) {
+            i+=c-126;
+            j++;
+        } else {
+            b--;
+        }
+    } while(b);
+    return i;
 }
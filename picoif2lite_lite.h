@@ -13,7 +13,7 @@
 #include "rominc/48.h"
 
 // and put them in the order you want them to appear in the selector here
-    const uint8_t *roms[] = {romexplorer                        //  0 - 4672bytes
+    const uint8_t *roms[] = {romexplorer                        //  0 - 4876bytes
                             ,rom_tester_rom                     //  1 - 1940bytes
                             ,lg                                 //  2 - 15558bytes
                             ,diagrom                            //  3 - 14128bytes
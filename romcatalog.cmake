@@ -0,0 +1,132 @@
+# ROM catalog build, included from CMakeLists.txt
+#
+# Builds the ROM list from a manifest instead of picoif2lite_lite.h. Each line
+# of the manifest is one ROM, in the order they appear in the ROM Explorer:
+#
+#   file | display name | converter options
+#
+# only the file is needed, paths are from the manifest's folder & lines
+# starting # are comments. The first ROM must be the ROM Explorer.
+#   .rom .bin  converted with compressROM (options e.g. -z, -p, -s)
+#   .z80 .sna  converted with Z80toROM (options e.g. -l, -s, -k)
+#   .txt       a data entry, converted with compressROM -x, e.g. a sequence of
+#              ROMs for the sequencer (a first line of seq then a stage a line)
+#   .h         a header already made by either, the name & options are ignored
+# Each ROM is converted on its own into catalog/rom_<n>.bin in the build folder
+# & linked in as a binary object with .incbin, so changing one ROM only
+# reconverts & reassembles that ROM then relinks. catalog_gen.h has the roms[]
+# table the firmware & mkexplorer would otherwise get from picoif2lite_lite.h.
+
+# the converters' sources are next to this file, which isn't where rom_catalog
+# is called from when it's used by another project (the tests)
+set(ROM_CATALOG_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+# host tool built from one of the top level .c files
+function(rom_catalog_tool name source)
+    add_custom_command(OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/${name}
+        COMMAND ${HOST_CC} -O2 -o ${CMAKE_CURRENT_BINARY_DIR}/${name} ${ROM_CATALOG_DIR}/${source}
+        DEPENDS ${ROM_CATALOG_DIR}/${source})
+endfunction()
+
+# rom_catalog(target manifest) - add the ROMs in manifest to target, the list
+# of ROM files in menu order is left in ROM_CATALOG_BINS for mkexplorer
+function(rom_catalog target manifest)
+    get_filename_component(manifest ${manifest} ABSOLUTE)
+    get_filename_component(romdir ${manifest} DIRECTORY)
+    set(catdir ${CMAKE_CURRENT_BINARY_DIR}/catalog)
+    file(MAKE_DIRECTORY ${catdir})
+    # CMake has to run again when the manifest changes
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${manifest})
+    rom_catalog_tool(compressROM compressROM.c)
+    rom_catalog_tool(Z80toROM z80torom.c)
+    rom_catalog_tool(mkcatalog mkcatalog.c)
+
+    file(STRINGS ${manifest} lines)
+    set(n 0)
+    set(bins "")
+    set(externs "")
+    set(table "")
+    foreach(line IN LISTS lines)
+        string(STRIP "${line}" line)
+        if(line STREQUAL "" OR line MATCHES "^#")
+            continue()
+        endif()
+        string(REPLACE "|" ";" fields "${line}")
+        list(LENGTH fields nfields)
+        list(GET fields 0 file)
+        string(STRIP "${file}" file)
+        get_filename_component(name ${file} NAME_WE)
+        set(opts "")
+        if(nfields GREATER 1)
+            list(GET fields 1 given)
+            string(STRIP "${given}" given)
+            if(NOT given STREQUAL "")
+                set(name "${given}")
+            endif()
+        endif()
+        if(nfields GREATER 2)
+            list(GET fields 2 opts)
+            separate_arguments(opts UNIX_COMMAND "${opts}")
+        endif()
+        get_filename_component(input ${file} ABSOLUTE BASE_DIR ${romdir})
+        if(NOT EXISTS ${input})
+            message(FATAL_ERROR "ROM catalog ${manifest}: ${file} not found")
+        endif()
+        get_filename_component(ext ${file} EXT)
+        string(TOLOWER "${ext}" ext)
+        set(bin ${catdir}/rom_${n}.bin)
+        if(ext MATCHES "\\.(rom|bin)$")
+            add_custom_command(OUTPUT ${bin}
+                COMMAND ${CMAKE_CURRENT_BINARY_DIR}/compressROM ${opts} -o ${bin} ${input} ${name}
+                DEPENDS ${input} ${CMAKE_CURRENT_BINARY_DIR}/compressROM
+                WORKING_DIRECTORY ${catdir} VERBATIM)
+        elseif(ext MATCHES "\\.(z80|sna)$")
+            add_custom_command(OUTPUT ${bin}
+                COMMAND ${CMAKE_CURRENT_BINARY_DIR}/Z80toROM ${opts} -o ${bin} ${input} ${name}
+                DEPENDS ${input} ${CMAKE_CURRENT_BINARY_DIR}/Z80toROM
+                WORKING_DIRECTORY ${catdir} VERBATIM)
+        elseif(ext STREQUAL ".txt")
+            add_custom_command(OUTPUT ${bin}
+                COMMAND ${CMAKE_CURRENT_BINARY_DIR}/compressROM -x ${opts} -o ${bin} ${input} ${name}
+                DEPENDS ${input} ${CMAKE_CURRENT_BINARY_DIR}/compressROM
+                WORKING_DIRECTORY ${catdir} VERBATIM)
+        elseif(ext STREQUAL ".h")
+            add_custom_command(OUTPUT ${bin}
+                COMMAND ${CMAKE_CURRENT_BINARY_DIR}/mkcatalog ${input} ${bin}
+                DEPENDS ${input} ${CMAKE_CURRENT_BINARY_DIR}/mkcatalog VERBATIM)
+        else()
+            message(FATAL_ERROR "ROM catalog ${manifest}: ${file} is not a .rom, .bin, .z80, .sna, .txt or .h")
+        endif()
+        # the ROM as a binary object, its own section so the linker can place it anywhere in flash
+        set(asm ${catdir}/rom_${n}.S)
+        file(GENERATE OUTPUT ${asm} CONTENT
+"/* generated by CMake from ${manifest} - do not edit */\n\
+    .section .rodata.catalog_rom_${n},\"a\"\n\
+    .global catalog_rom_${n}\n\
+    .balign 4\n\
+catalog_rom_${n}:\n\
+    .incbin \"${bin}\"\n")
+        set_source_files_properties(${asm} PROPERTIES GENERATED TRUE OBJECT_DEPENDS ${bin})
+        target_sources(${target} PRIVATE ${asm})
+        list(APPEND bins ${bin})
+        string(APPEND externs "extern const uint8_t catalog_rom_${n}[];\n")
+        if(n EQUAL 0)
+            string(APPEND table "    const uint8_t *roms[] = {catalog_rom_${n} // ${n} - ${file}\n")
+        else()
+            string(APPEND table "                            ,catalog_rom_${n} // ${n} - ${file}\n")
+        endif()
+        math(EXPR n "${n}+1")
+    endforeach()
+    if(n EQUAL 0)
+        message(FATAL_ERROR "ROM catalog ${manifest} has no ROMs, the first must be the ROM Explorer")
+    endif()
+    # only rewritten when the manifest changes, so the firmware isn't recompiled for a changed ROM
+    file(GENERATE OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/catalog_gen.h CONTENT
+"// generated by CMake from ${manifest} - do not edit\n\
+${externs}\n\
+// in the order they appear in the selector\n\
+${table}                            };\n")
+    target_compile_definitions(${target} PRIVATE ROM_CATALOG)
+    message(STATUS "ROM catalog: ${n} ROMs from ${manifest}")
+    set(ROM_CATALOG_BINS ${bins} PARENT_SCOPE)
+endfunction()
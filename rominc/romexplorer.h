@@ -1,147 +1,154 @@
-// ,romexplorer                        // xx - 4672bytes
+// ,romexplorer                        // xx - 4876bytes
     const uint8_t romexplorer[]={ 0x00,0x00,0x54,0x75,0x72,0x6e,0x20,0x5a,0x58,0x20,0x50,0x69,0x63,0x6f,0x49,0x46,0x32,0x4c,0x69,0x74,0x65,0x20,0x4f,0x66,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-                                  0x0b,0xf3,0x3e,0x80,0xed,0x47,0x31,0xf8,0x7f,0x3e,0x00,0x32,0xfe,0x82,0x04,0x20,0xfd,0x7f,0x3e,0x01,0x32,0xff,0x7f,0xaf,0x32,0xfa,0x7f,0x21,0x00,0x1e,0x11,0x00,
-                                  0x60,0xcd,0x61,0x06,0xcd,0xdd,0x01,0x3e,0x07,0xd3,0xfe,0xed,0x56,0xfb,0x18,0x0a,0x00,0x85,0x00,0x4e,0xfb,0xc9,0x21,0x7f,0x06,0xcd,0x5e,0x06,0x11,0x01,0x40,0xd9,
-                                  0x11,0xa9,0x02,0xcd,0x2c,0x02,0xd9,0x11,0x80,0x00,0x3a,0x6b,0x01,0x87,0x4f,0x87,0x81,0x83,0x5f,0x8a,0x93,0x57,0x21,0x5f,0x40,0x08,0x3a,0xff,0x7f,0x08,0x1a,0xb7,
-                                  0x28,0x44,0x13,0x47,0x08,0x0e,0x7e,0x3d,0x20,0x02,0x0e,0x42,0x08,0x71,0x24,0x7c,0xe6,0x07,0x20,0x0a,0x7d,0xc6,0x20,0x6f,0x38,0x04,0x7c,0xd6,0x08,0x67,0x10,0xed,
-                                  0x18,0xdc,0xa0,0x83,0x56,0x01,0x50,0x50,0x82,0x5d,0x02,0x35,0x36,0x35,0x81,0x64,0x00,0x28,0x81,0x00,0x02,0x00,0x00,0x20,0x82,0x00,0x0e,0x00,0x1b,0x1b,0x1a,0x1a,
-                                  0x1b,0x1b,0x11,0x40,0x40,0xd9,0xed,0x5b,0xfb,0x7f,0x82,0x6a,0x24,0x3a,0xfd,0x7f,0x4f,0xcd,0x14,0x02,0xcd,0xf3,0x01,0xe6,0x3f,0x28,0x21,0x47,0x3a,0xfa,0x7f,0xb8,
-                                  0x20,0x0f,0x76,0x3a,0xf9,0x7f,0x3d,0x20,0x0e,0x3e,0x05,0x32,0xf9,0x7f,0x78,0x18,0x17,0x78,0x81,0xc2,0x01,0x3e,0x23,0x81,0x0b,0x01,0x18,0xd8,0x83,0x06,0x84,0x2c,
-                                  0x21,0xf9,0x5f,0x06,0x3f,0x3e,0x1f,0xd3,0xfe,0x10,0xfe,0x3e,0x0f,0xd3,0xfe,0x7b,0x1f,0xda,0xc4,0x01,0x1f,0xda,0xa8,0x01,0x1f,0x38,0x60,0x1f,0x38,0x2e,0x79,0xfe,
-                                  0x14,0x20,0x18,0x81,0xc3,0x00,0x47,0x81,0xb7,0x10,0xb8,0x28,0xa1,0x3c,0x32,0xff,0x7f,0xaf,0x32,0xfd,0x7f,0x3a,0xfe,0x7f,0x3c,0x18,0x75,0x81,0x05,0x11,0xfe,0x0a,
-                                  0x28,0x8c,0x3c,0x32,0xfe,0x7f,0xcd,0x10,0x02,0x0c,0x18,0x28,0x79,0xb7,0x20,0x15,0x81,0xe0,0x03,0x3d,0xca,0xbd,0x00,0x81,0x28,0x01,0x3e,0x14,0x84,0x29,0x02,0x3d,
-                                  0x18,0x4b,0x81,0x2f,0x00,0xb7,0x81,0x14,0x00,0x3d,0x84,0x29,0x01,0x0d,0x79,0x81,0x42,0x04,0xc3,0xba,0x00,0x06,0x01,0x82,0x55,0x01,0x20,0x15,0x81,0x3c,0x81,0x50,
-                                  0x03,0x47,0x3a,0x2e,0x01,0x81,0x49,0x01,0x90,0x81,0x82,0x1c,0x01,0xb6,0x00,0x82,0x6a,0x81,0x66,0x01,0xc6,0x15,0x82,0x17,0x03,0xb8,0x30,0x07,0x5f,0x83,0x18,0x01,
-                                  0x43,0x78,0x82,0x6c,0x04,0xdd,0x01,0xc3,0x3a,0x00,0x82,0x68,0x01,0x20,0x0c,0x81,0x7b,0x81,0x8f,0x81,0x7e,0x81,0x32,0x84,0x31,0x03,0xd6,0x15,0x18,0xdb,0x81,0x9f,
-                                  0x18,0xf5,0x21,0x68,0x0d,0xb7,0x28,0x03,0x21,0xfe,0x07,0xcd,0x5e,0x06,0xf1,0xc6,0x80,0x26,0x3f,0x6f,0x7e,0x18,0xfd,0x11,0x00,0x60,0x81,0xc9,0x19,0x4f,0x0d,0x28,
-                                  0x07,0x1a,0x13,0xb7,0x20,0xfb,0x18,0xf6,0xed,0x53,0xfb,0x7f,0xc9,0x3e,0xef,0xdb,0xfe,0x2f,0xe6,0x1c,0x47,0x3e,0xbf,0x82,0x07,0x52,0x01,0xb0,0x47,0x3e,0xf7,0xdb,
-                                  0xfe,0x0f,0x0f,0x0f,0x2f,0xe6,0x02,0xb0,0xc9,0x16,0x78,0x18,0x02,0x16,0x68,0x79,0xc6,0x02,0x87,0x87,0x87,0x6f,0x26,0x00,0x29,0x29,0x7c,0xc6,0x58,0x67,0x06,0x1f,
-                                  0x72,0x2c,0x10,0xfc,0xc9,0x01,0x00,0x00,0x1a,0x21,0xde,0x05,0x85,0x6f,0x8c,0x95,0x67,0x46,0x79,0x87,0xc6,0x0e,0x67,0x1a,0x13,0x87,0xc8,0xd8,0xfe,0x12,0x20,0x09,
-                                  0xd9,0x7b,0xe6,0xe0,0xf6,0x1d,0x5f,0x18,0x11,0xfe,0x14,0x20,0x12,0x82,0x0c,0x11,0xc6,0x20,0x5f,0x30,0x04,0x7a,0xc6,0x08,0x57,0xd9,0x0e,0x00,0x18,0xc9,0xfe,0x34,
-                                  0xd8,0xd9,0x83,0x4d,0x4c,0x01,0xf8,0x01,0x09,0xd9,0x79,0xd9,0x4a,0x06,0x08,0xeb,0xb7,0x20,0x08,0x1a,0x77,0x13,0x24,0x10,0xfa,0x18,0x13,0x1a,0x13,0xd9,0x6f,0x7e,
-                                  0xd9,0xb6,0x77,0xd9,0x24,0x7e,0x25,0xd9,0x23,0x77,0x2b,0x24,0x10,0xed,0xeb,0x51,0xd9,0x78,0x81,0xfe,0x08,0x38,0x05,0xd9,0x13,0xd9,0xd6,0x08,0x4f,0x18,0x86,0x5a,
-                                  0x58,0x20,0x53,0x70,0x65,0x63,0x74,0x72,0x75,0x6d,0x20,0x52,0x4f,0x4d,0x20,0x53,0x65,0x6c,0x81,0x0d,0x1a,0x6f,0x72,0x20,0x76,0x31,0x2e,0x31,0x61,0x00,0x7f,0xc6,
-                                  0xf5,0xee,0xdd,0xc4,0x7f,0x00,0xfc,0x66,0x56,0xd6,0x56,0xce,0xfc,0x00,0x7f,0xc5,0x81,0x0f,0x00,0xc5,0x82,0x0f,0x09,0x5e,0xde,0x5e,0x66,0xfc,0x00,0x90,0x80,0x90,
-                                  0x8a,0x81,0x03,0x82,0x01,0x01,0x8a,0x80,0x81,0x00,0x00,0x00,0x86,0x00,0x00,0x40,0x81,0x00,0x05,0x00,0x40,0x00,0x00,0x48,0x48,0x84,0x12,0x02,0x24,0x7e,0x24,0x81,
-                                  0x02,0x0f,0x00,0x00,0x10,0x7c,0x50,0x7c,0x14,0x7c,0x10,0x00,0x62,0x64,0x08,0x10,0x26,0x46,0x81,0x0f,0x07,0x28,0x10,0x2a,0x44,0x3a,0x00,0x00,0x20,0x81,0x2b,0x82,
-                                  0x3c,0x00,0x20,0x82,0x38,0x00,0x20,0x81,0x3f,0x00,0x20,0x81,0x00,0x82,0x13,0x04,0x28,0x10,0x7c,0x10,0x28,0x81,0x56,0x00,0x10,0x81,0x07,0x00,0x10,0x85,0x23,0x84,
-                                  0x2c,0x00,0x7c,0x86,0x6c,0x01,0x60,0x60,0x81,0x76,0x02,0x04,0x08,0x10,0x82,0x43,0x0a,0x3c,0x46,0x4a,0x52,0x62,0x3c,0x00,0x00,0x30,0x50,0x10,0x81,0x31,0x81,0x0f,
-                                  0x04,0x42,0x02,0x3c,0x40,0x7e,0x82,0x07,0x02,0x0c,0x02,0x42,0x81,0x17,0x0a,0x08,0x18,0x28,0x48,0x7e,0x08,0x00,0x00,0x7e,0x40,0x7c,0x83,0x0f,0x03,0x3c,0x40,0x7c,
-                                  0x42,0x82,0x17,0x01,0x7e,0x02,0x81,0x40,0x81,0x5f,0x02,0x3c,0x42,0x3c,0x83,0x0f,0x81,0x05,0x01,0x3e,0x02,0x81,0x47,0x81,0xc9,0x83,0x02,0x00,0x00,0x81,0x93,0x83,
-                                  0x90,0x81,0x65,0x00,0x20,0x83,0x87,0x00,0x7c,0x84,0x80,0x81,0x0d,0x83,0x77,0x03,0x42,0x04,0x08,0x00,0x81,0x57,0x04,0x3c,0x4a,0x56,0x5e,0x40,0x84,0x3f,0x02,0x7e,
-                                  0x42,0x42,0x81,0xa4,0x00,0x42,0x81,0x5f,0x83,0x87,0x01,0x40,0x40,0x82,0x7f,0x05,0x78,0x44,0x42,0x42,0x44,0x78,0x83,0x7f,0x00,0x40,0x82,0x97,0x83,0x07,0x83,0x3f,
-                                  0x01,0x40,0x4e,0x82,0x9f,0x83,0x36,0x82,0x37,0x81,0xbe,0x82,0xbf,0x02,0x02,0x02,0x02,0x83,0x9f,0x04,0x44,0x48,0x70,0x48,0x44,0x81,0x4f,0x81,0x2c,0x83,0x37,0x02,
-                                  0x42,0x66,0x5a,0x83,0x27,0x04,0x42,0x62,0x52,0x4a,0x46,0x81,0x67,0x81,0xb5,0x83,0xc7,0x82,0x6d,0x84,0x4f,0x02,0x42,0x52,0x4a,0x85,0x0f,0x82,0x37,0x02,0x3c,0x40,
-                                  0x3c,0x83,0xff,0x01,0x7f,0x08,0x82,0x00,0x82,0x67,0x84,0x2f,0x82,0x36,0x01,0x24,0x18,0x84,0x0f,0x01,0x5a,0x24,0x81,0x7f,0x03,0x24,0x18,0x18,0x24,0x81,0xb7,0x02,
-                                  0x41,0x22,0x14,0x83,0x27,0x04,0x7e,0x04,0x08,0x10,0x20,0x81,0xa7,0x00,0x70,0x82,0x78,0x00,0x70,0x84,0xef,0x01,0x08,0x04,0x81,0x0f,0x82,0x9f,0x81,0x0f,0x02,0x10,
-                                  0x38,0x54,0x81,0xa9,0x81,0x17,0x83,0x02,0x05,0x7f,0x00,0x1c,0x22,0x78,0x20,0x82,0x2f,0x04,0x00,0x38,0x04,0x3c,0x44,0x81,0xef,0x03,0x40,0x40,0x78,0x44,0x82,0xef,
-                                  0x01,0x00,0x38,0x81,0xe6,0x03,0x38,0x00,0x00,0x04,0x81,0x16,0x82,0x17,0x04,0x00,0x38,0x44,0x78,0x40,0x81,0xef,0x02,0x30,0x40,0x60,0x83,0xff,0x00,0x00,0x82,0x16,
-                                  0x01,0x04,0x38,0x84,0x2f,0x07,0x44,0x00,0x00,0x20,0x00,0x60,0x20,0x20,0x81,0x6f,0x01,0x08,0x00,0x81,0xb0,0x08,0x48,0x30,0x00,0x40,0x50,0x60,0x60,0x50,0x48,0x85,
-                                  0xff,0x00,0x30,0x81,0x87,0x01,0x68,0x54,0x81,0x00,0x81,0x8f,0x82,0x2e,0x81,0x2f,0x81,0x4f,0x01,0x44,0x44,0x81,0x5f,0x82,0x0f,0x00,0x78,0x82,0x50,0x83,0x4f,0x00,
-                                  0x06,0x84,0x77,0x82,0x5f,0x03,0x38,0x40,0x38,0x04,0x81,0x87,0x04,0x20,0x70,0x20,0x20,0x20,0x81,0xef,0x00,0x00,0x82,0x36,0x82,0x2f,0x03,0x44,0x44,0x28,0x28,0x82,
-                                  0xbf,0x00,0x44,0x81,0x4f,0x00,0x28,0x82,0x17,0x02,0x28,0x10,0x28,0x82,0x4f,0x81,0x85,0x82,0x8f,0x01,0x00,0x7c,0x81,0xff,0x08,0x7c,0x00,0x00,0x1c,0x10,0x60,0x10,
-                                  0x10,0x1c,0x85,0x7f,0x81,0xaf,0x02,0x70,0x10,0x0c,0x83,0xff,0x01,0x28,0x50,0x83,0xfb,0x06,0x1c,0x22,0x5d,0x51,0x5d,0x22,0x1c,0x82,0xac,0x81,0xaf,0x0c,0x04,0x02,
-                                  0x05,0x07,0x06,0x07,0x07,0x03,0x03,0x03,0x06,0x06,0x03,0x81,0x01,0x82,0x0c,0x84,0x01,0x04,0x02,0x03,0x04,0x06,0x04,0x86,0x0c,0x00,0x07,0x88,0x17,0x02,0x07,0x07,
-                                  0x08,0x84,0x04,0x81,0x1e,0x06,0x06,0x08,0x07,0x06,0x06,0x05,0x06,0x81,0x08,0x03,0x06,0x04,0x05,0x05,0x81,0x05,0x03,0x06,0x06,0x07,0x05,0x82,0x10,0x83,0x01,0x1e,
-                                  0x02,0x06,0x05,0x08,0x11,0x00,0x40,0x43,0x18,0x04,0x3c,0x4f,0xed,0xb0,0x7e,0x23,0xfe,0x80,0xc8,0x38,0xf5,0xd6,0x7e,0x4e,0x23,0xe5,0x62,0x6b,0xed,0x42,0x2b,0x81,
-                                  0x13,0x1d,0xe1,0x18,0xe9,0x00,0x00,0x97,0x00,0x00,0x01,0x82,0x00,0x01,0x00,0x80,0x98,0x20,0x83,0x3a,0x9d,0x1f,0x00,0x7e,0xff,0x1f,0x9d,0x9f,0x98,0xff,0x00,0x03,
-                                  0x82,0x14,0x06,0xb0,0xff,0xff,0xf6,0xff,0x00,0x07,0x82,0x1f,0x0a,0xae,0x9c,0xff,0x00,0x18,0xff,0xff,0xd7,0xff,0x00,0x0f,0x82,0x2e,0x00,0xb1,0x81,0x0e,0x00,0x3c,
-                                  0x83,0x0e,0x00,0x1f,0x82,0x3d,0x02,0xa1,0xff,0xdf,0x81,0x28,0x06,0x3f,0x82,0x00,0x9e,0xff,0x00,0x00,0x83,0x25,0x00,0x7f,0x82,0x54,0x00,0xbf,0x83,0x3f,0x07,0xff,
-                                  0x82,0x00,0xff,0xdf,0xff,0x7f,0xff,0x9f,0x00,0x04,0xac,0xff,0x9c,0xfe,0x01,0x82,0x3f,0x2e,0xdc,0xff,0x02,0x00,0x00,0x10,0x81,0xe3,0x88,0xe4,0x05,0x80,0x00,0x80,
-                                  0x02,0x00,0x02,0x87,0xff,0x01,0x02,0x1c,0xff,0xff,0xde,0xff,0x13,0x39,0x17,0x80,0x80,0x9c,0x8b,0xc0,0x43,0xc7,0xa2,0xf0,0x08,0xf1,0xe0,0xbc,0x04,0x9c,0x72,0x1c,
-                                  0x77,0x81,0x1d,0x1b,0x0c,0x12,0xff,0xff,0xdd,0x7f,0x14,0x00,0x7d,0x14,0x40,0x87,0xa2,0xaa,0x20,0xc2,0x28,0xa2,0x88,0x0c,0x8a,0x27,0xa2,0x0c,0xa0,0x8a,0x22,0x82,
-                                  0x81,0x3c,0x01,0x78,0xaa,0x82,0x54,0x1a,0x09,0x3c,0x00,0x11,0x14,0x43,0xe8,0xa2,0xaa,0x21,0xfa,0x81,0xff,0x07,0x7e,0x8a,0x28,0xa2,0x1f,0x9c,0xf2,0x3c,0x88,0xff,
-                                  0x01,0x0a,0xec,0x82,0x73,0x06,0x14,0x18,0x00,0x11,0x17,0x81,0xc8,0x81,0x3e,0x00,0xc3,0x81,0x5d,0x07,0x0c,0xf1,0xe8,0xa2,0x0c,0x02,0x82,0x20,0x81,0x1e,0x01,0x0d,
-                                  0xa8,0x82,0x92,0x00,0x15,0x81,0x92,0x16,0xe4,0x00,0x87,0x9c,0x52,0x20,0x42,0x00,0x9c,0x80,0x08,0x80,0x27,0xa2,0x04,0x3c,0x79,0x9e,0x71,0x87,0xf4,0x01,0x0a,0x81,
-                                  0xf2,0x24,0xde,0xff,0x01,0x00,0x04,0x83,0xec,0x01,0x02,0x07,0x81,0xea,0x01,0x81,0xc0,0x8d,0xed,0x02,0x08,0x00,0x06,0x97,0x00,0x06,0x02,0x16,0x34,0x25,0x28,0x07,
-                                  0x78,0x9c,0x00,0xff,0x1f,0xff,0x9f,0x84,0xff,0x7f,0x9a,0xff,0x9a,0x00,0x03,0x06,0x01,0x03,0x03,0x80,0x00,0x00,0xdd,0x00,0x02,0xfe,0x00,0xff,0x8b,0x00,0x90,0x1f,
-                                  0x83,0x81,0x00,0x01,0x86,0x87,0x00,0x80,0x8d,0x2f,0x00,0xfc,0x84,0xa0,0x00,0x03,0x8d,0xa7,0x87,0x2f,0x85,0x1f,0x11,0x01,0x3f,0xff,0xff,0xc0,0x00,0x00,0x1f,0xff,
-                                  0xf0,0x00,0x07,0xff,0xe0,0x00,0xff,0xfc,0x80,0x85,0xd8,0x00,0xf8,0x85,0x3f,0x0d,0x3f,0xc0,0x00,0x7f,0xc0,0x1f,0xf0,0x00,0x0f,0xf8,0x07,0xff,0xf8,0x03,0x87,0x1f,
-                                  0x87,0x77,0xd8,0xff,0x00,0x00,0x8b,0xd1,0xa0,0xff,0x8c,0x2f,0xa9,0xff,0x81,0xea,0x02,0x7f,0xff,0xfe,0x98,0xff,0x0b,0x3f,0xc0,0x3f,0xe0,0x00,0x07,0xfc,0x07,0xfb,
-                                  0xf8,0x03,0xfb,0xeb,0xff,0x8a,0xd1,0xa2,0xff,0x8a,0x82,0x1e,0x12,0x2a,0x82,0x60,0x9a,0xff,0x02,0xc0,0x00,0x03,0xf3,0xff,0x88,0xd1,0x9d,0xff,0x01,0x01,0xc0,0x8d,
-                                  0x81,0x35,0x81,0x8b,0x08,0x01,0x81,0xff,0x00,0x80,0x99,0xff,0x00,0x7f,0x81,0x07,0x33,0xfe,0xf4,0xff,0x86,0xd1,0x95,0xff,0x86,0xdf,0x87,0xff,0x86,0x2f,0x86,0xdf,
-                                  0xa1,0xff,0x02,0xff,0x00,0x03,0x81,0xff,0x04,0xc0,0x07,0xff,0xf0,0x01,0x96,0xff,0x02,0x80,0x00,0x01,0xf7,0xff,0x84,0xd1,0xa8,0xff,0x84,0x2f,0x95,0xff,0x87,0xb6,
-                                  0x8a,0xff,0x01,0x80,0x07,0x81,0x3e,0x0a,0xe0,0x9f,0xff,0x03,0xf9,0xfc,0x07,0xf3,0xf3,0xff,0x82,0x81,0x5a,0x3b,0x00,0x00,0x86,0xb7,0x86,0x2f,0xab,0xff,0x04,0x0f,
-                                  0xff,0x00,0xff,0xf0,0x97,0xff,0x02,0x7f,0xc0,0xff,0xfe,0xff,0x97,0x1f,0x95,0xff,0x88,0xdf,0x85,0xe6,0x81,0xc1,0x95,0xff,0x00,0xc0,0x81,0x1b,0x04,0x1f,0xfc,0x00,
-                                  0x3f,0xf8,0x96,0xff,0x81,0x3b,0x00,0xff,0x81,0xf4,0x00,0xff,0x8c,0xff,0x85,0x1f,0x03,0x07,0x81,0xfb,0x24,0x83,0x1f,0x00,0x80,0x85,0x1f,0x00,0xc0,0x85,0x77,0x00,
-                                  0xf0,0x87,0x3f,0x02,0x7f,0xe0,0x00,0x84,0x3f,0x03,0xf8,0x7f,0x1f,0xc3,0x86,0x1f,0x00,0x03,0x85,0x1f,0x8a,0x7f,0x03,0xf8,0x1f,0xff,0x81,0xfe,0x19,0x00,0xe0,0x8b,
-                                  0xff,0x88,0xbf,0x85,0xe7,0x00,0x07,0x86,0x1f,0x86,0x8f,0x8d,0xfe,0x00,0x07,0x81,0x87,0x02,0x07,0xff,0xf8,0x81,0x79,0x81,0x09,0x2f,0x02,0x02,0xf8,0x7f,0x81,0x81,
-                                  0xa6,0x07,0xfe,0x00,0x0f,0xff,0xf0,0x00,0x1f,0xe0,0x82,0x02,0x11,0x0f,0xc0,0x00,0x01,0xfe,0x00,0x1f,0xf0,0x3f,0xc0,0x1f,0xff,0xc0,0x1f,0xe0,0x7f,0x80,0x80,0x82,
-                                  0x17,0x03,0xf8,0x00,0x3f,0xe0,0x85,0x1f,0x81,0xe7,0x81,0xfd,0x0e,0x2d,0x08,0x0f,0xf0,0x7f,0x8f,0xf0,0x7f,0x80,0x7f,0x80,0x81,0x24,0x02,0x00,0x81,0x05,0x1c,0x67,
-                                  0x00,0x1f,0x81,0xf0,0x83,0x2a,0x88,0xff,0x82,0xdf,0x81,0xff,0x03,0xf8,0xfe,0x0f,0xe3,0x91,0xff,0x02,0x3f,0xf0,0x00,0x81,0xbd,0x00,0x01,0x81,0x81,0x09,0x19,0xbf,
-                                  0x83,0x91,0xff,0x81,0x1d,0x00,0x0f,0x81,0x42,0x06,0xf0,0x07,0xf8,0x0f,0xfe,0x03,0xfc,0x85,0xe7,0x8d,0xff,0x88,0xdd,0xa9,0xff,0x81,0x13,0x04,0xf1,0x01,0xff,0x80,
-                                  0x81,0x81,0x08,0x00,0x86,0x81,0x32,0x0d,0xff,0xf8,0x90,0xff,0x00,0xdf,0x88,0xff,0x03,0xf0,0x00,0x3f,0xf0,0x88,0x82,0x10,0x1c,0xfc,0xa3,0xff,0x81,0x65,0x9a,0xff,
-                                  0x81,0x2a,0x82,0x38,0x00,0xfe,0x97,0xff,0x02,0x7f,0xc0,0x07,0x82,0x53,0xcf,0xff,0x81,0x9a,0x81,0xb2,0x02,0x0f,0x81,0x38,0x05,0xc4,0x84,0xff,0x82,0xab,0x8a,0x81,
-                                  0x47,0x17,0x8c,0xff,0x00,0x3f,0x81,0xfa,0x89,0xff,0x81,0xe9,0x82,0xff,0x00,0x07,0x9e,0xff,0x00,0xfc,0x9c,0xff,0x01,0x0f,0xfc,0xf5,0x81,0x32,0x05,0xff,0xff,0x81,
-                                  0xb8,0x89,0xff,0x81,0x8a,0x11,0xba,0x8d,0xff,0x06,0x1f,0xe0,0x3f,0xdf,0xe0,0x3f,0xc0,0x85,0xff,0x00,0xc0,0x81,0x17,0x88,0x82,0x80,0x05,0x3f,0xa2,0xff,0x00,0xf8,
-                                  0x9c,0x81,0x34,0x81,0xaa,0x03,0xc0,0x00,0x03,0x98,0x81,0xba,0x01,0xe0,0x03,0x81,0x91,0x16,0x80,0x94,0xff,0x85,0xef,0x97,0xff,0x85,0xf7,0x95,0xff,0x81,0xd8,0x89,
-                                  0xff,0x83,0x66,0x88,0xff,0x81,0xb5,0x81,0xea,0x81,0x68,0x11,0x0c,0x82,0xfc,0x85,0xff,0x81,0x95,0x06,0xc0,0x07,0xf8,0xff,0x07,0xf0,0xff,0x81,0xf9,0x99,0x81,0x4d,
-                                  0x81,0xbf,0x21,0x7f,0x1f,0xc3,0x92,0xff,0x00,0xfe,0x81,0xe1,0x07,0x00,0x07,0xfc,0x07,0xf8,0x1f,0xff,0x03,0x93,0xff,0x01,0xf0,0x00,0x81,0xff,0x03,0x00,0x07,0xf8,
-                                  0x07,0xcc,0xff,0x81,0xf2,0x81,0xa5,0x02,0x07,0x82,0x11,0x81,0xa5,0x05,0xab,0x8e,0xff,0x82,0x11,0x86,0x81,0x44,0x01,0x00,0xe0,0x81,0xaf,0x01,0xf8,0x9d,0x81,0x6e,
-                                  0x81,0x82,0x09,0x03,0x9e,0xff,0x05,0x1f,0xf0,0x00,0x7f,0xff,0xfe,0x81,0xc4,0x08,0xfc,0xcc,0xff,0x04,0xc0,0xff,0xe0,0x7f,0xc0,0x81,0x8b,0x01,0x1f,0x87,0x81,0x1c,
-                                  0x06,0x89,0xff,0x01,0x00,0xff,0x81,0xc3,0x81,0x9a,0x0e,0x8f,0x87,0xff,0x81,0xdf,0x8b,0xff,0x05,0x0f,0xff,0xf0,0x07,0xf8,0xfe,0x9d,0x81,0xb7,0x0d,0xff,0xc0,0x9c,
-                                  0xff,0x07,0x01,0xff,0x00,0x3f,0xf8,0x00,0x0f,0xf8,0x97,0x81,0xf9,0x27,0xf8,0x81,0x54,0x00,0xf0,0xb1,0xff,0x81,0x79,0x8c,0xff,0x81,0x6a,0x88,0xff,0x82,0x77,0x81,
-                                  0xda,0x00,0x1f,0x82,0xf2,0x81,0xd9,0x82,0xf4,0x03,0xfc,0x00,0xff,0xe0,0x89,0xff,0x04,0xff,0x80,0x00,0x0f,0xf0,0x81,0xba,0x01,0x00,0x83,0x81,0x79,0x0d,0x8d,0xff,
-                                  0x83,0x3f,0x00,0x1f,0x83,0xa7,0x02,0x3f,0xf0,0x03,0x82,0x1f,0x81,0xc4,0x09,0x39,0x85,0x3f,0x00,0x0c,0x86,0x1f,0x81,0xfa,0x09,0x81,0x7e,0x22,0xf0,0x01,0xff,0xf8,
-                                  0x00,0xff,0xfc,0x82,0x59,0x82,0x7f,0x02,0xff,0x03,0xff,0x82,0x67,0x81,0x8a,0x00,0x3f,0x83,0x5e,0x00,0xe0,0x85,0xb7,0x86,0xbf,0x88,0xef,0x83,0x1f,0x89,0xfa,0x82,
-                                  0x42,0x24,0x00,0x7f,0x8d,0x1f,0x8e,0x0e,0x9e,0x1f,0xbf,0x1e,0x83,0xff,0x04,0x0f,0xf8,0x03,0xfd,0xfe,0x81,0x02,0x85,0xff,0x04,0x3f,0xc0,0x00,0x0f,0xc0,0x87,0xff,
-                                  0x05,0x01,0xff,0xc0,0x7f,0xf0,0x00,0x82,0xef,0x18,0x85,0xff,0x02,0x07,0xff,0xff,0x8b,0xff,0x89,0xf7,0x8f,0xff,0x01,0xff,0xff,0xac,0xff,0x8d,0x2f,0xe2,0xff,0x02,
-                                  0x78,0x00,0x07,0x81,0x0e,0x08,0x1f,0xf0,0x89,0xff,0x02,0xff,0xff,0xe0,0x8b,0x81,0xf2,0x20,0x81,0xff,0x83,0x1c,0xa3,0xff,0x8b,0xd1,0xa1,0xff,0x8b,0x2f,0xe1,0xff,
-                                  0x01,0x07,0xf8,0x83,0xff,0x01,0xfc,0x01,0x95,0xff,0x82,0x92,0x81,0xff,0x00,0xf0,0x88,0xff,0x03,0x81,0x3c,0x07,0xfe,0xaa,0xff,0x89,0xd1,0xa3,0xff,0x89,0x81,0x41,
-                                  0x01,0x00,0xfc,0x81,0x16,0x04,0x01,0x8b,0xff,0x82,0x02,0x81,0x1a,0x03,0x7f,0xff,0xff,0xc0,0x81,0x6b,0x16,0x7f,0x86,0xff,0x81,0xa4,0x00,0xfc,0x95,0xff,0x8e,0xdf,
-                                  0x85,0xff,0x87,0xd1,0xa5,0xff,0x87,0x2f,0xe7,0xff,0x00,0xff,0x81,0x3f,0x19,0xfc,0x85,0xff,0x82,0xd7,0x89,0xff,0x81,0xc3,0x02,0x80,0x00,0x7f,0x8a,0xff,0x02,0x3f,
-                                  0xff,0xf8,0xae,0xff,0x82,0x43,0x89,0x27,0x9f,0x82,0x93,0x07,0xe6,0xff,0x03,0x03,0xfe,0x00,0x0f,0x83,0x81,0x2b,0x31,0x87,0xff,0x81,0xeb,0x00,0xc0,0x88,0xff,0x00,
-                                  0x1f,0x82,0x8b,0x82,0xff,0x81,0x16,0x84,0xff,0x01,0x0f,0xff,0x84,0x1c,0xab,0xff,0x83,0xd1,0xa9,0xff,0x83,0x2f,0xe8,0xff,0x01,0xf8,0x00,0x87,0xff,0x03,0x0f,0xfc,
-                                  0x00,0xff,0x89,0xff,0x00,0x07,0x81,0x18,0x8c,0x81,0x85,0x27,0x81,0xca,0xb1,0xff,0x81,0xd1,0xab,0xff,0x81,0x2f,0xdf,0xff,0x00,0x38,0xdd,0x00,0x02,0x17,0x10,0x17,
-                                  0x83,0x00,0x00,0x37,0x85,0x00,0x90,0x1f,0x83,0x00,0x01,0x16,0x30,0x84,0x00,0x03,0x36,0x26,0x20,0x27,0x81,0x13,0x51,0x2f,0x85,0x00,0x8d,0x1f,0x01,0x30,0x20,0x84,
-                                  0x00,0x01,0x25,0x28,0x85,0x00,0x81,0x3f,0x00,0x50,0x81,0x00,0x01,0x56,0x70,0x85,0x00,0x00,0x60,0x85,0x00,0x01,0x6c,0x68,0x81,0x00,0xa0,0x1f,0x82,0x5f,0x8a,0x3f,
-                                  0x01,0x74,0x66,0x9c,0x1f,0x9e,0x3f,0x97,0x5f,0x00,0x72,0xa4,0x1f,0x00,0x74,0x95,0x9f,0x00,0x50,0x8e,0xdf,0x82,0xde,0x92,0x1f,0x86,0xbf,0x9d,0x1f,0x00,0x65,0xa6,
-                                  0x3f,0x00,0x10,0x9d,0x7f,0x81,0x1f,0x82,0x02,0x83,0x5e,0x02,0x01,0x34,0x20,0x81,0x3d,0x01,0x2c,0x28,0x81,0x6d,0x01,0x2f,0x17,0x81,0x4b,0x01,0x37,0x83,0x81,0x7a,
-                                  0x05,0x00,0x38,0x8d,0x00,0x00,0x27,0x81,0x59,0x00,0x2f,0x82,0x0d,0x04,0xce,0x0f,0x80,0x00,0x00,0x81,0xe1,0x01,0x81,0xff,0xd7,0x00,0x13,0xce,0xff,0x00,0x3f,0xdf,
-                                  0x00,0x00,0x12,0x85,0x00,0x82,0x09,0x00,0x36,0x84,0x00,0x02,0x3f,0x36,0x24,0x81,0xe3,0x09,0x1e,0x00,0x52,0x85,0x00,0x03,0x12,0x12,0x52,0x76,0x81,0xe1,0x39,0x36,
-                                  0x64,0x86,0x00,0x00,0x24,0x87,0x1e,0x81,0x20,0x86,0x1e,0x01,0x76,0x24,0x8d,0x1f,0x81,0x3a,0x81,0x45,0x00,0x36,0x82,0x39,0x83,0x61,0x82,0x1f,0x84,0x61,0x00,0x00,
-                                  0x82,0x5e,0x01,0x12,0x00,0x82,0x06,0x00,0x76,0x83,0x1f,0x83,0xff,0x83,0x1f,0x84,0xfe,0x83,0x1f,0x82,0x85,0x81,0x75,0x82,0x79,0x81,0x0d,0x7f,0x3f,0x85,0xbd,0x85,
-                                  0x1f,0x82,0x95,0x83,0x5f,0x82,0xb3,0x83,0x5f,0x02,0x2d,0x2d,0x2d,0x88,0x1f,0x83,0x7b,0x82,0xbe,0x83,0x39,0x82,0x9f,0x00,0x6d,0x81,0x00,0x81,0x20,0x8d,0x1f,0x83,
-                                  0xd3,0x82,0x5f,0x82,0x1e,0x90,0x1f,0x83,0xb5,0x00,0x00,0x81,0x7f,0x81,0x3b,0x81,0x5f,0x00,0x00,0x84,0x7f,0x81,0x94,0x84,0x5f,0x84,0xb5,0x81,0x9f,0x82,0x5b,0x83,
-                                  0x09,0x82,0xbf,0x82,0xb4,0x83,0xfb,0x87,0xb5,0x00,0x2d,0x84,0x7b,0x84,0xbf,0x83,0xd4,0x82,0xfb,0x88,0xd5,0x8a,0x1f,0x82,0xb4,0x00,0x36,0x83,0x9a,0x93,0x1f,0x83,
-                                  0xd4,0x84,0xd8,0x93,0x3f,0x00,0x00,0x85,0x20,0x81,0xf6,0x93,0x5f,0x81,0x20,0x82,0x00,0x82,0xd6,0x00,0x00,0x83,0xdb,0x83,0x34,0x84,0xdb,0x85,0x0c,0x41,0x85,0x00,
-                                  0x83,0x09,0x88,0x13,0x86,0x1e,0xdd,0x07,0x80,0x00,0xff,0x00,0xff,0x81,0xc8,0xff,0x7f,0x01,0x01,0x02,0x02,0x03,0x03,0x04,0x04,0x05,0x05,0x06,0x06,0x07,0x07,0x08,
-                                  0x08,0x09,0x09,0x0a,0x0a,0x0b,0x0b,0x0c,0x0c,0x0d,0x0d,0x0e,0x0e,0x0f,0x0f,0x10,0x10,0x11,0x11,0x12,0x12,0x13,0x13,0x14,0x14,0x15,0x15,0x16,0x16,0x17,0x17,0x18,
-                                  0x18,0x19,0x19,0x1a,0x1a,0x1b,0x1b,0x1c,0x1c,0x1d,0x1d,0x1e,0x1e,0x1f,0x1f,0x20,0x20,0x21,0x21,0x22,0x22,0x23,0x23,0x24,0x24,0x25,0x25,0x26,0x26,0x27,0x27,0x28,
-                                  0x28,0x29,0x29,0x2a,0x2a,0x2b,0x2b,0x2c,0x2c,0x2d,0x2d,0x2e,0x2e,0x2f,0x2f,0x30,0x30,0x31,0x31,0x32,0x32,0x33,0x33,0x34,0x34,0x35,0x35,0x36,0x36,0x37,0x37,0x38,
-                                  0x38,0x39,0x39,0x3a,0x3a,0x3b,0x3b,0x3c,0x3c,0x3d,0x3d,0x3e,0x3e,0x3f,0x3f,0x40,0x40,0x7f,0x41,0x41,0x42,0x42,0x43,0x43,0x44,0x44,0x45,0x45,0x46,0x46,0x47,0x47,
-                                  0x48,0x48,0x49,0x49,0x4a,0x4a,0x4b,0x4b,0x4c,0x4c,0x4d,0x4d,0x4e,0x4e,0x4f,0x4f,0x50,0x50,0x51,0x51,0x52,0x52,0x53,0x53,0x54,0x54,0x55,0x55,0x56,0x56,0x57,0x57,
-                                  0x58,0x58,0x59,0x59,0x5a,0x5a,0x5b,0x5b,0x5c,0x5c,0x5d,0x5d,0x5e,0x5e,0x5f,0x5f,0x60,0x60,0x61,0x61,0x62,0x62,0x63,0x63,0x64,0x64,0x65,0x65,0x66,0x66,0x67,0x67,
-                                  0x68,0x68,0x69,0x69,0x6a,0x6a,0x6b,0x6b,0x6c,0x6c,0x6d,0x6d,0x6e,0x6e,0x6f,0x6f,0x70,0x70,0x71,0x71,0x72,0x72,0x73,0x73,0x74,0x74,0x75,0x75,0x76,0x76,0x77,0x77,
-                                  0x78,0x78,0x79,0x79,0x7a,0x7a,0x7b,0x7b,0x7c,0x7c,0x7d,0x7d,0x7e,0x7e,0x7f,0x7f,0x00,0x80,0xff,0x01,0xfc,0x81,0x81,0x00,0x00,0x01,0x81,0x00,0x00,0x02,0x81,0x00,
-                                  0x00,0x03,0x81,0x00,0x00,0x04,0x81,0x00,0x00,0x05,0x81,0x00,0x00,0x06,0x81,0x00,0x00,0x07,0x81,0x00,0x00,0x08,0x81,0x00,0x00,0x09,0x81,0x00,0x00,0x0a,0x81,0x00,
-                                  0x00,0x0b,0x81,0x00,0x00,0x0c,0x81,0x00,0x00,0x0d,0x81,0x00,0x00,0x0e,0x81,0x00,0x00,0x0f,0x81,0x00,0x00,0x10,0x81,0x00,0x00,0x11,0x81,0x00,0x00,0x12,0x81,0x00,
-                                  0x00,0x13,0x81,0x00,0x00,0x14,0x81,0x00,0x00,0x15,0x81,0x00,0x00,0x16,0x81,0x00,0x00,0x17,0x81,0x00,0x00,0x18,0x81,0x00,0x00,0x19,0x81,0x00,0x00,0x1a,0x81,0x00,
-                                  0x00,0x1b,0x81,0x00,0x00,0x1c,0x81,0x00,0x00,0x1d,0x81,0x00,0x00,0x1e,0x81,0x00,0x00,0x1f,0x81,0x00,0x00,0x20,0x81,0x00,0x00,0x21,0x81,0x00,0x00,0x22,0x81,0x00,
-                                  0x00,0x23,0x81,0x00,0x00,0x24,0x81,0x00,0x00,0x25,0x81,0x00,0x00,0x26,0x81,0x00,0x00,0x27,0x81,0x00,0x00,0x28,0x81,0x00,0x00,0x29,0x81,0x00,0x00,0x2a,0x81,0x00,
-                                  0x00,0x2b,0x81,0x00,0x00,0x2c,0x81,0x00,0x00,0x2d,0x81,0x00,0x00,0x2e,0x81,0x00,0x00,0x2f,0x81,0x00,0x00,0x30,0x81,0x00,0x00,0x31,0x81,0x00,0x00,0x32,0x81,0x00,
-                                  0x00,0x33,0x81,0x00,0x00,0x34,0x81,0x00,0x00,0x35,0x81,0x00,0x00,0x36,0x81,0x00,0x00,0x37,0x81,0x00,0x00,0x38,0x81,0x00,0x00,0x39,0x81,0x00,0x00,0x3a,0x81,0x00,
-                                  0x00,0x3b,0x81,0x00,0x00,0x3c,0x81,0x00,0x00,0x3d,0x81,0x00,0x00,0x3e,0x81,0x00,0x00,0x3f,0x81,0x00,0x03,0x00,0x40,0x80,0xc0,0xff,0x03,0xfa,0x83,0x85,0x00,0x00,
-                                  0x01,0x85,0x00,0x00,0x02,0x85,0x00,0x00,0x03,0x85,0x00,0x00,0x04,0x85,0x00,0x00,0x05,0x85,0x00,0x00,0x06,0x85,0x00,0x00,0x07,0x85,0x00,0x00,0x08,0x85,0x00,0x00,
-                                  0x09,0x85,0x00,0x00,0x0a,0x85,0x00,0x00,0x0b,0x85,0x00,0x00,0x0c,0x85,0x00,0x00,0x0d,0x85,0x00,0x00,0x0e,0x85,0x00,0x00,0x0f,0x85,0x00,0x00,0x10,0x85,0x00,0x00,
-                                  0x11,0x85,0x00,0x00,0x12,0x85,0x00,0x00,0x13,0x85,0x00,0x00,0x14,0x85,0x00,0x00,0x15,0x85,0x00,0x00,0x16,0x85,0x00,0x00,0x17,0x85,0x00,0x00,0x18,0x85,0x00,0x00,
-                                  0x19,0x85,0x00,0x00,0x1a,0x85,0x00,0x00,0x1b,0x85,0x00,0x00,0x1c,0x85,0x00,0x00,0x1d,0x85,0x00,0x00,0x1e,0x85,0x00,0x00,0x1f,0x85,0x00,0x07,0x00,0x20,0x40,0x60,
-                                  0x80,0xa0,0xc0,0xe0,0xff,0x07,0xf6,0x87,0x8d,0x00,0x00,0x01,0x8d,0x00,0x00,0x02,0x8d,0x00,0x00,0x03,0x8d,0x00,0x00,0x04,0x8d,0x00,0x00,0x05,0x8d,0x00,0x00,0x06,
-                                  0x8d,0x00,0x00,0x07,0x8d,0x00,0x00,0x08,0x8d,0x00,0x00,0x09,0x8d,0x00,0x00,0x0a,0x8d,0x00,0x00,0x0b,0x8d,0x00,0x00,0x0c,0x8d,0x00,0x00,0x0d,0x8d,0x00,0x00,0x0e,
-                                  0x8d,0x00,0x00,0x0f,0x8d,0x00,0x0f,0x00,0x10,0x20,0x30,0x40,0x50,0x60,0x70,0x80,0x90,0xa0,0xb0,0xc0,0xd0,0xe0,0xf0,0xff,0x0f,0xee,0x8f,0x9d,0x00,0x00,0x01,0x9d,
-                                  0x00,0x00,0x02,0x9d,0x00,0x00,0x03,0x9d,0x00,0x00,0x04,0x9d,0x00,0x00,0x05,0x9d,0x00,0x00,0x06,0x9d,0x00,0x00,0x07,0x9d,0x00,0x1f,0x00,0x08,0x10,0x18,0x20,0x28,
-                                  0x30,0x38,0x40,0x48,0x50,0x58,0x60,0x68,0x70,0x78,0x80,0x88,0x90,0x98,0xa0,0xa8,0xb0,0xb8,0xc0,0xc8,0xd0,0xd8,0xe0,0xe8,0xf0,0xf8,0xff,0x1f,0xde,0x9f,0xbd,0x00,
-                                  0x00,0x01,0xbd,0x00,0x00,0x02,0xbd,0x00,0x00,0x03,0xbd,0x00,0x3f,0x00,0x04,0x08,0x0c,0x10,0x14,0x18,0x1c,0x20,0x24,0x28,0x2c,0x30,0x34,0x38,0x3c,0x40,0x44,0x48,
-                                  0x4c,0x50,0x54,0x58,0x5c,0x60,0x64,0x68,0x6c,0x70,0x74,0x78,0x7c,0x80,0x84,0x88,0x8c,0x90,0x94,0x98,0x9c,0xa0,0xa4,0xa8,0xac,0xb0,0xb4,0xb8,0xbc,0xc0,0xc4,0xc8,
-                                  0xcc,0xd0,0xd4,0xd8,0xdc,0xe0,0xe4,0xe8,0xec,0xf0,0xf4,0xf8,0xfc,0xff,0x3f,0xbe,0xbf,0xfd,0x00,0x00,0x01,0xfd,0x00,0x7f,0x00,0x02,0x04,0x06,0x08,0x0a,0x0c,0x0e,
-                                  0x10,0x12,0x14,0x16,0x18,0x1a,0x1c,0x1e,0x20,0x22,0x24,0x26,0x28,0x2a,0x2c,0x2e,0x30,0x32,0x34,0x36,0x38,0x3a,0x3c,0x3e,0x40,0x42,0x44,0x46,0x48,0x4a,0x4c,0x4e,
-                                  0x50,0x52,0x54,0x56,0x58,0x5a,0x5c,0x5e,0x60,0x62,0x64,0x66,0x68,0x6a,0x6c,0x6e,0x70,0x72,0x74,0x76,0x78,0x7a,0x7c,0x7e,0x80,0x82,0x84,0x86,0x88,0x8a,0x8c,0x8e,
-                                  0x90,0x92,0x94,0x96,0x98,0x9a,0x9c,0x9e,0xa0,0xa2,0xa4,0xa6,0xa8,0xaa,0xac,0xae,0xb0,0xb2,0xb4,0xb6,0xb8,0xba,0xbc,0xbe,0xc0,0xc2,0xc4,0xc6,0xc8,0xca,0xcc,0xce,
-                                  0xd0,0xd2,0xd4,0xd6,0xd8,0xda,0xdc,0xde,0xe0,0xe2,0xe4,0xe6,0xe8,0xea,0xec,0xee,0xf0,0xf2,0xf4,0xf6,0xf8,0xfa,0xfc,0xfe,0xfe,0x7f,0x7f,0x38,0x1e,0x54,0x75,0x72,
-                                  0x6e,0x20,0x5a,0x58,0x20,0x50,0x69,0x63,0x6f,0x5a,0x58,0x43,0x78,0x20,0x55,0x6e,0x69,0x74,0x20,0x4f,0x66,0x66,0x0a,0x1e,0x52,0x4f,0x4d,0x20,0x54,0x65,0x73,0x74,
-                                  0x65,0x72,0x09,0x1c,0x1d,0x0a,0x1e,0x4c,0x6f,0x6f,0x6b,0x69,0x6e,0x67,0x20,0x47,0x6c,0x61,0x73,0x73,0x20,0x81,0x1c,0x81,0x21,0x0c,0x65,0x74,0x72,0x6f,0x6c,0x65,
-                                  0x75,0x6d,0x20,0x44,0x69,0x61,0x67,0x82,0x2f,0x06,0x76,0x31,0x2e,0x35,0x39,0x0a,0x1e,0x81,0x50,0x05,0x53,0x70,0x65,0x63,0x74,0x72,0x85,0x1a,0x0c,0x6e,0x6f,0x73,
-                                  0x74,0x69,0x63,0x73,0x20,0x76,0x30,0x2e,0x33,0x37,0x83,0x4d,0x8a,0x21,0x82,0x64,0x12,0x20,0x43,0x61,0x72,0x74,0x72,0x69,0x64,0x67,0x65,0x5a,0x0a,0x1e,0x31,0x32,
-                                  0x38,0x6b,0x20,0x52,0x41,0x86,0x7d,0x11,0x0a,0x1e,0x57,0x68,0x65,0x72,0x65,0x20,0x54,0x69,0x6d,0x65,0x20,0x53,0x74,0x6f,0x6f,0x64,0x81,0x05,0x04,0x69,0x6c,0x6c,
-                                  0x20,0x28,0x82,0x28,0x0e,0x29,0x09,0x1a,0x1b,0x0a,0x1e,0x41,0x75,0x74,0x6f,0x6d,0x61,0x6e,0x69,0x61,0x83,0x0d,0x09,0x43,0x68,0x61,0x73,0x65,0x20,0x48,0x2e,0x51,
-                                  0x2e,0x89,0x23,0x0a,0x1f,0x4f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x20,0x34,0x82,0x5e,0x02,0x4f,0x4d,0x00,0x80,0x00,0xff,0x00,0xff,0x81,0xa1,0xff,0x80 };
+                                  0x0b,0xf3,0x3e,0x80,0xed,0x47,0x31,0xf8,0x7f,0x3e,0x00,0x32,0xfe,0x82,0x04,0x0b,0xfd,0x7f,0x3e,0x01,0x32,0xff,0x7f,0xaf,0x32,0xfa,0x7f,0x00,0x86,0x00,0x0c,0xcd,
+                                  0xdd,0x01,0x3e,0x07,0xd3,0xfe,0xed,0x56,0xfb,0xc3,0xdf,0x0f,0x85,0x15,0x4e,0xfb,0xc9,0x21,0x7f,0x06,0xcd,0x5e,0x06,0x11,0x01,0x40,0xd9,0x11,0xa9,0x02,0xcd,0x2c,
+                                  0x02,0xd9,0x11,0x80,0x00,0x3a,0x6b,0x01,0x87,0x4f,0x87,0x81,0x83,0x5f,0x8a,0x93,0x57,0x21,0x5f,0x40,0x08,0x3a,0xff,0x7f,0x08,0x1a,0xb7,0x28,0x44,0x13,0x47,0x08,
+                                  0x0e,0x7e,0x3d,0x20,0x02,0x0e,0x42,0x08,0x71,0x24,0x7c,0xe6,0x07,0x20,0x0a,0x7d,0xc6,0x20,0x6f,0x38,0x04,0x7c,0xd6,0x08,0x67,0x10,0xed,0x18,0xdc,0xa0,0x83,0x6b,
+                                  0x01,0x50,0x50,0x82,0x72,0x02,0x35,0x36,0x35,0x81,0x79,0x00,0x28,0x81,0x00,0x02,0x00,0x00,0x20,0x82,0x00,0x0e,0x00,0x1b,0x1b,0x1a,0x1a,0x1b,0x1b,0x11,0x40,0x40,
+                                  0xd9,0xed,0x5b,0xfb,0x7f,0x82,0x6a,0x24,0x3a,0xfd,0x7f,0x4f,0xcd,0x14,0x02,0xcd,0x9b,0x0f,0xe6,0x3f,0x28,0x21,0x47,0x3a,0xfa,0x7f,0xb8,0x20,0x0f,0x76,0x3a,0xf9,
+                                  0x7f,0x3d,0x20,0x0e,0x3e,0x05,0x32,0xf9,0x7f,0x78,0x18,0x17,0x78,0x81,0xc2,0x01,0x3e,0x23,0x81,0x0b,0x01,0x18,0xd8,0x83,0x06,0x84,0x2c,0x21,0xf9,0x5f,0x06,0x3f,
+                                  0x3e,0x1f,0xd3,0xfe,0x10,0xfe,0x3e,0x0f,0xd3,0xfe,0x7b,0x1f,0xda,0xc4,0x01,0xc3,0x1c,0x0f,0x01,0x1f,0x38,0x60,0x1f,0x38,0x2e,0x79,0xfe,0x14,0x20,0x18,0x81,0xc3,
+                                  0x00,0x47,0x81,0xb7,0x10,0xb8,0x28,0xa1,0x3c,0x32,0xff,0x7f,0xaf,0x32,0xfd,0x7f,0x3a,0xfe,0x7f,0x3c,0x18,0x75,0x81,0x05,0x11,0xfe,0x0a,0x28,0x8c,0x3c,0x32,0xfe,
+                                  0x7f,0xcd,0x10,0x02,0x0c,0x18,0x28,0x79,0xb7,0x20,0x15,0x81,0xe0,0x03,0x3d,0xca,0xbd,0x00,0x81,0x28,0x01,0x3e,0x14,0x84,0x29,0x02,0x3d,0x18,0x4b,0x81,0x2f,0x00,
+                                  0xb7,0x81,0x14,0x00,0x3d,0x84,0x29,0x01,0x0d,0x79,0x81,0x42,0x04,0xc3,0xba,0x00,0x06,0x01,0x82,0x55,0x01,0x20,0x15,0x81,0x3c,0x81,0x50,0x03,0x47,0x3a,0x2e,0x01,
+                                  0x81,0x49,0x01,0x90,0x81,0x82,0x1c,0x01,0xb6,0x00,0x82,0x6a,0x81,0x66,0x01,0xc6,0x15,0x82,0x17,0x03,0xb8,0x30,0x07,0x5f,0x83,0x18,0x01,0x43,0x78,0x82,0x6c,0x04,
+                                  0xdd,0x01,0xc3,0x3a,0x00,0x82,0x68,0x01,0x20,0x0c,0x81,0x7b,0x81,0x8f,0x81,0x7e,0x81,0x32,0x84,0x31,0x2f,0xd6,0x15,0x18,0xdb,0x2a,0x04,0x3f,0x7c,0xb5,0x21,0x68,
+                                  0x0d,0x28,0x03,0x21,0xfe,0x07,0xcd,0x5e,0x06,0xed,0x5b,0x04,0x3f,0xc3,0x15,0x0f,0x00,0x00,0x21,0x00,0x1e,0x22,0xfb,0x7f,0xc9,0x0d,0x28,0x07,0x1a,0x13,0xb7,0x20,
+                                  0xfb,0x18,0xf6,0xed,0x53,0x81,0x0e,0x09,0x3e,0xef,0xdb,0xfe,0x2f,0xe6,0x1c,0x47,0x3e,0xbf,0x82,0x07,0x52,0x01,0xb0,0x47,0x3e,0xf7,0xdb,0xfe,0x0f,0x0f,0x0f,0x2f,
+                                  0xe6,0x02,0xb0,0xc9,0x16,0x78,0x18,0x02,0x16,0x68,0x79,0xc6,0x02,0x87,0x87,0x87,0x6f,0x26,0x00,0x29,0x29,0x7c,0xc6,0x58,0x67,0x06,0x1f,0x72,0x2c,0x10,0xfc,0xc9,
+                                  0x01,0x00,0x00,0x1a,0x21,0xde,0x05,0x85,0x6f,0x8c,0x95,0x67,0x46,0x79,0x87,0xc6,0x0e,0x67,0x1a,0x13,0x87,0xc8,0xd8,0xfe,0x12,0x20,0x09,0xd9,0x7b,0xe6,0xe0,0xf6,
+                                  0x1d,0x5f,0x18,0x11,0xfe,0x14,0x20,0x12,0x82,0x0c,0x11,0xc6,0x20,0x5f,0x30,0x04,0x7a,0xc6,0x08,0x57,0xd9,0x0e,0x00,0x18,0xc9,0xfe,0x34,0xd8,0xd9,0x83,0x4d,0x4c,
+                                  0x01,0xf8,0x01,0x09,0xd9,0x79,0xd9,0x4a,0x06,0x08,0xeb,0xb7,0x20,0x08,0x1a,0x77,0x13,0x24,0x10,0xfa,0x18,0x13,0x1a,0x13,0xd9,0x6f,0x7e,0xd9,0xb6,0x77,0xd9,0x24,
+                                  0x7e,0x25,0xd9,0x23,0x77,0x2b,0x24,0x10,0xed,0xeb,0x51,0xd9,0x78,0x81,0xfe,0x08,0x38,0x05,0xd9,0x13,0xd9,0xd6,0x08,0x4f,0x18,0x86,0x5a,0x58,0x20,0x53,0x70,0x65,
+                                  0x63,0x74,0x72,0x75,0x6d,0x20,0x52,0x4f,0x4d,0x20,0x53,0x65,0x6c,0x81,0x0d,0x1a,0x6f,0x72,0x20,0x76,0x31,0x2e,0x31,0x61,0x00,0x7f,0xc6,0xf5,0xee,0xdd,0xc4,0x7f,
+                                  0x00,0xfc,0x66,0x56,0xd6,0x56,0xce,0xfc,0x00,0x7f,0xc5,0x81,0x0f,0x00,0xc5,0x82,0x0f,0x09,0x5e,0xde,0x5e,0x66,0xfc,0x00,0x90,0x80,0x90,0x8a,0x81,0x03,0x82,0x01,
+                                  0x01,0x8a,0x80,0x81,0x00,0x00,0x00,0x86,0x00,0x00,0x40,0x81,0x00,0x05,0x00,0x40,0x00,0x00,0x48,0x48,0x84,0x12,0x02,0x24,0x7e,0x24,0x81,0x02,0x0f,0x00,0x00,0x10,
+                                  0x7c,0x50,0x7c,0x14,0x7c,0x10,0x00,0x62,0x64,0x08,0x10,0x26,0x46,0x81,0x0f,0x07,0x28,0x10,0x2a,0x44,0x3a,0x00,0x00,0x20,0x81,0x2b,0x82,0x3c,0x00,0x20,0x82,0x38,
+                                  0x00,0x20,0x81,0x3f,0x00,0x20,0x81,0x00,0x82,0x13,0x04,0x28,0x10,0x7c,0x10,0x28,0x81,0x56,0x00,0x10,0x81,0x07,0x00,0x10,0x85,0x23,0x84,0x2c,0x00,0x7c,0x86,0x6c,
+                                  0x01,0x60,0x60,0x81,0x76,0x02,0x04,0x08,0x10,0x82,0x43,0x0a,0x3c,0x46,0x4a,0x52,0x62,0x3c,0x00,0x00,0x30,0x50,0x10,0x81,0x31,0x81,0x0f,0x04,0x42,0x02,0x3c,0x40,
+                                  0x7e,0x82,0x07,0x02,0x0c,0x02,0x42,0x81,0x17,0x0a,0x08,0x18,0x28,0x48,0x7e,0x08,0x00,0x00,0x7e,0x40,0x7c,0x83,0x0f,0x03,0x3c,0x40,0x7c,0x42,0x82,0x17,0x01,0x7e,
+                                  0x02,0x81,0x40,0x81,0x5f,0x02,0x3c,0x42,0x3c,0x83,0x0f,0x81,0x05,0x01,0x3e,0x02,0x81,0x47,0x81,0xc9,0x83,0x02,0x00,0x00,0x81,0x93,0x83,0x90,0x81,0x65,0x00,0x20,
+                                  0x83,0x87,0x00,0x7c,0x84,0x80,0x81,0x0d,0x83,0x77,0x03,0x42,0x04,0x08,0x00,0x81,0x57,0x04,0x3c,0x4a,0x56,0x5e,0x40,0x84,0x3f,0x02,0x7e,0x42,0x42,0x81,0xa4,0x00,
+                                  0x42,0x81,0x5f,0x83,0x87,0x01,0x40,0x40,0x82,0x7f,0x05,0x78,0x44,0x42,0x42,0x44,0x78,0x83,0x7f,0x00,0x40,0x82,0x97,0x83,0x07,0x83,0x3f,0x01,0x40,0x4e,0x82,0x9f,
+                                  0x83,0x36,0x82,0x37,0x81,0xbe,0x82,0xbf,0x02,0x02,0x02,0x02,0x83,0x9f,0x04,0x44,0x48,0x70,0x48,0x44,0x81,0x4f,0x81,0x2c,0x83,0x37,0x02,0x42,0x66,0x5a,0x83,0x27,
+                                  0x04,0x42,0x62,0x52,0x4a,0x46,0x81,0x67,0x81,0xb5,0x83,0xc7,0x82,0x6d,0x84,0x4f,0x02,0x42,0x52,0x4a,0x85,0x0f,0x82,0x37,0x02,0x3c,0x40,0x3c,0x83,0xff,0x01,0x7f,
+                                  0x08,0x82,0x00,0x82,0x67,0x84,0x2f,0x82,0x36,0x01,0x24,0x18,0x84,0x0f,0x01,0x5a,0x24,0x81,0x7f,0x03,0x24,0x18,0x18,0x24,0x81,0xb7,0x02,0x41,0x22,0x14,0x83,0x27,
+                                  0x04,0x7e,0x04,0x08,0x10,0x20,0x81,0xa7,0x00,0x70,0x82,0x78,0x00,0x70,0x84,0xef,0x01,0x08,0x04,0x81,0x0f,0x82,0x9f,0x81,0x0f,0x02,0x10,0x38,0x54,0x81,0xa9,0x81,
+                                  0x17,0x83,0x02,0x05,0x7f,0x00,0x1c,0x22,0x78,0x20,0x82,0x2f,0x04,0x00,0x38,0x04,0x3c,0x44,0x81,0xef,0x03,0x40,0x40,0x78,0x44,0x82,0xef,0x01,0x00,0x38,0x81,0xe6,
+                                  0x03,0x38,0x00,0x00,0x04,0x81,0x16,0x82,0x17,0x04,0x00,0x38,0x44,0x78,0x40,0x81,0xef,0x02,0x30,0x40,0x60,0x83,0xff,0x00,0x00,0x82,0x16,0x01,0x04,0x38,0x84,0x2f,
+                                  0x07,0x44,0x00,0x00,0x20,0x00,0x60,0x20,0x20,0x81,0x6f,0x01,0x08,0x00,0x81,0xb0,0x08,0x48,0x30,0x00,0x40,0x50,0x60,0x60,0x50,0x48,0x85,0xff,0x00,0x30,0x81,0x87,
+                                  0x01,0x68,0x54,0x81,0x00,0x81,0x8f,0x82,0x2e,0x81,0x2f,0x81,0x4f,0x01,0x44,0x44,0x81,0x5f,0x82,0x0f,0x00,0x78,0x82,0x50,0x83,0x4f,0x00,0x06,0x84,0x77,0x82,0x5f,
+                                  0x03,0x38,0x40,0x38,0x04,0x81,0x87,0x04,0x20,0x70,0x20,0x20,0x20,0x81,0xef,0x00,0x00,0x82,0x36,0x82,0x2f,0x03,0x44,0x44,0x28,0x28,0x82,0xbf,0x00,0x44,0x81,0x4f,
+                                  0x00,0x28,0x82,0x17,0x02,0x28,0x10,0x28,0x82,0x4f,0x81,0x85,0x82,0x8f,0x01,0x00,0x7c,0x81,0xff,0x08,0x7c,0x00,0x00,0x1c,0x10,0x60,0x10,0x10,0x1c,0x85,0x7f,0x81,
+                                  0xaf,0x02,0x70,0x10,0x0c,0x83,0xff,0x01,0x28,0x50,0x83,0xfb,0x06,0x1c,0x22,0x5d,0x51,0x5d,0x22,0x1c,0x82,0xac,0x81,0xaf,0x0c,0x04,0x02,0x05,0x07,0x06,0x07,0x07,
+                                  0x03,0x03,0x03,0x06,0x06,0x03,0x81,0x01,0x82,0x0c,0x84,0x01,0x04,0x02,0x03,0x04,0x06,0x04,0x86,0x0c,0x00,0x07,0x88,0x17,0x02,0x07,0x07,0x08,0x84,0x04,0x81,0x1e,
+                                  0x06,0x06,0x08,0x07,0x06,0x06,0x05,0x06,0x81,0x08,0x03,0x06,0x04,0x05,0x05,0x81,0x05,0x03,0x06,0x06,0x07,0x05,0x82,0x10,0x83,0x01,0x1e,0x02,0x06,0x05,0x08,0x11,
+                                  0x00,0x40,0x43,0x18,0x04,0x3c,0x4f,0xed,0xb0,0x7e,0x23,0xfe,0x80,0xc8,0x38,0xf5,0xd6,0x7e,0x4e,0x23,0xe5,0x62,0x6b,0xed,0x42,0x2b,0x81,0x13,0x1d,0xe1,0x18,0xe9,
+                                  0x00,0x00,0x97,0x00,0x00,0x01,0x82,0x00,0x01,0x00,0x80,0x98,0x20,0x83,0x3a,0x9d,0x1f,0x00,0x7e,0xff,0x1f,0x9d,0x9f,0x98,0xff,0x00,0x03,0x82,0x14,0x06,0xb0,0xff,
+                                  0xff,0xf6,0xff,0x00,0x07,0x82,0x1f,0x0a,0xae,0x9c,0xff,0x00,0x18,0xff,0xff,0xd7,0xff,0x00,0x0f,0x82,0x2e,0x00,0xb1,0x81,0x0e,0x00,0x3c,0x83,0x0e,0x00,0x1f,0x82,
+                                  0x3d,0x02,0xa1,0xff,0xdf,0x81,0x28,0x06,0x3f,0x82,0x00,0x9e,0xff,0x00,0x00,0x83,0x25,0x00,0x7f,0x82,0x54,0x00,0xbf,0x83,0x3f,0x07,0xff,0x82,0x00,0xff,0xdf,0xff,
+                                  0x7f,0xff,0x9f,0x00,0x04,0xac,0xff,0x9c,0xfe,0x01,0x82,0x3f,0x2e,0xdc,0xff,0x02,0x00,0x00,0x10,0x81,0xe3,0x88,0xe4,0x05,0x80,0x00,0x80,0x02,0x00,0x02,0x87,0xff,
+                                  0x01,0x02,0x1c,0xff,0xff,0xde,0xff,0x13,0x39,0x17,0x80,0x80,0x9c,0x8b,0xc0,0x43,0xc7,0xa2,0xf0,0x08,0xf1,0xe0,0xbc,0x04,0x9c,0x72,0x1c,0x77,0x81,0x1d,0x1b,0x0c,
+                                  0x12,0xff,0xff,0xdd,0x7f,0x14,0x00,0x7d,0x14,0x40,0x87,0xa2,0xaa,0x20,0xc2,0x28,0xa2,0x88,0x0c,0x8a,0x27,0xa2,0x0c,0xa0,0x8a,0x22,0x82,0x81,0x3c,0x01,0x78,0xaa,
+                                  0x82,0x54,0x1a,0x09,0x3c,0x00,0x11,0x14,0x43,0xe8,0xa2,0xaa,0x21,0xfa,0x81,0xff,0x07,0x7e,0x8a,0x28,0xa2,0x1f,0x9c,0xf2,0x3c,0x88,0xff,0x01,0x0a,0xec,0x82,0x73,
+                                  0x06,0x14,0x18,0x00,0x11,0x17,0x81,0xc8,0x81,0x3e,0x00,0xc3,0x81,0x5d,0x07,0x0c,0xf1,0xe8,0xa2,0x0c,0x02,0x82,0x20,0x81,0x1e,0x01,0x0d,0xa8,0x82,0x92,0x00,0x15,
+                                  0x81,0x92,0x16,0xe4,0x00,0x87,0x9c,0x52,0x20,0x42,0x00,0x9c,0x80,0x08,0x80,0x27,0xa2,0x04,0x3c,0x79,0x9e,0x71,0x87,0xf4,0x01,0x0a,0x81,0xf2,0x24,0xde,0xff,0x01,
+                                  0x00,0x04,0x83,0xec,0x01,0x02,0x07,0x81,0xea,0x01,0x81,0xc0,0x8d,0xed,0x02,0x08,0x00,0x06,0x97,0x00,0x06,0x02,0x16,0x34,0x25,0x28,0x07,0x78,0x9c,0x00,0xff,0x1f,
+                                  0xff,0x9f,0x84,0xff,0x7f,0x9a,0xff,0x9a,0x00,0x03,0x06,0x01,0x03,0x03,0x80,0x00,0x00,0xdd,0x00,0x02,0xfe,0x00,0xff,0x8b,0x00,0x90,0x1f,0x83,0x81,0x00,0x01,0x86,
+                                  0x87,0x00,0x80,0x8d,0x2f,0x00,0xfc,0x84,0xa0,0x00,0x03,0x8d,0xa7,0x87,0x2f,0x85,0x1f,0x11,0x01,0x3f,0xff,0xff,0xc0,0x00,0x00,0x1f,0xff,0xf0,0x00,0x07,0xff,0xe0,
+                                  0x00,0xff,0xfc,0x80,0x85,0xd8,0x00,0xf8,0x85,0x3f,0x0d,0x3f,0xc0,0x00,0x7f,0xc0,0x1f,0xf0,0x00,0x0f,0xf8,0x07,0xff,0xf8,0x03,0x87,0x1f,0x87,0x77,0xd8,0xff,0x00,
+                                  0x00,0x8b,0xd1,0xa0,0xff,0x8c,0x2f,0xa9,0xff,0x81,0xea,0x02,0x7f,0xff,0xfe,0x98,0xff,0x0b,0x3f,0xc0,0x3f,0xe0,0x00,0x07,0xfc,0x07,0xfb,0xf8,0x03,0xfb,0xeb,0xff,
+                                  0x8a,0xd1,0xa2,0xff,0x8a,0x82,0x1e,0x12,0x2a,0x82,0x60,0x9a,0xff,0x02,0xc0,0x00,0x03,0xf3,0xff,0x88,0xd1,0x9d,0xff,0x01,0x01,0xc0,0x8d,0x81,0x35,0x81,0x8b,0x08,
+                                  0x01,0x81,0xff,0x00,0x80,0x99,0xff,0x00,0x7f,0x81,0x07,0x33,0xfe,0xf4,0xff,0x86,0xd1,0x95,0xff,0x86,0xdf,0x87,0xff,0x86,0x2f,0x86,0xdf,0xa1,0xff,0x02,0xff,0x00,
+                                  0x03,0x81,0xff,0x04,0xc0,0x07,0xff,0xf0,0x01,0x96,0xff,0x02,0x80,0x00,0x01,0xf7,0xff,0x84,0xd1,0xa8,0xff,0x84,0x2f,0x95,0xff,0x87,0xb6,0x8a,0xff,0x01,0x80,0x07,
+                                  0x81,0x3e,0x0a,0xe0,0x9f,0xff,0x03,0xf9,0xfc,0x07,0xf3,0xf3,0xff,0x82,0x81,0x5a,0x3b,0x00,0x00,0x86,0xb7,0x86,0x2f,0xab,0xff,0x04,0x0f,0xff,0x00,0xff,0xf0,0x97,
+                                  0xff,0x02,0x7f,0xc0,0xff,0xfe,0xff,0x97,0x1f,0x95,0xff,0x88,0xdf,0x85,0xe6,0x81,0xc1,0x95,0xff,0x00,0xc0,0x81,0x1b,0x04,0x1f,0xfc,0x00,0x3f,0xf8,0x96,0xff,0x81,
+                                  0x3b,0x00,0xff,0x81,0xf4,0x00,0xff,0x8c,0xff,0x85,0x1f,0x03,0x07,0x81,0xfb,0x24,0x83,0x1f,0x00,0x80,0x85,0x1f,0x00,0xc0,0x85,0x77,0x00,0xf0,0x87,0x3f,0x02,0x7f,
+                                  0xe0,0x00,0x84,0x3f,0x03,0xf8,0x7f,0x1f,0xc3,0x86,0x1f,0x00,0x03,0x85,0x1f,0x8a,0x7f,0x03,0xf8,0x1f,0xff,0x81,0xfe,0x19,0x00,0xe0,0x8b,0xff,0x88,0xbf,0x85,0xe7,
+                                  0x00,0x07,0x86,0x1f,0x86,0x8f,0x8d,0xfe,0x00,0x07,0x81,0x87,0x02,0x07,0xff,0xf8,0x81,0x79,0x81,0x09,0x2f,0x02,0x02,0xf8,0x7f,0x81,0x81,0xa6,0x07,0xfe,0x00,0x0f,
+                                  0xff,0xf0,0x00,0x1f,0xe0,0x82,0x02,0x11,0x0f,0xc0,0x00,0x01,0xfe,0x00,0x1f,0xf0,0x3f,0xc0,0x1f,0xff,0xc0,0x1f,0xe0,0x7f,0x80,0x80,0x82,0x17,0x03,0xf8,0x00,0x3f,
+                                  0xe0,0x85,0x1f,0x81,0xe7,0x81,0xfd,0x0e,0x2d,0x08,0x0f,0xf0,0x7f,0x8f,0xf0,0x7f,0x80,0x7f,0x80,0x81,0x24,0x02,0x00,0x81,0x05,0x1c,0x67,0x00,0x1f,0x81,0xf0,0x83,
+                                  0x2a,0x88,0xff,0x82,0xdf,0x81,0xff,0x03,0xf8,0xfe,0x0f,0xe3,0x91,0xff,0x02,0x3f,0xf0,0x00,0x81,0xbd,0x00,0x01,0x81,0x81,0x09,0x19,0xbf,0x83,0x91,0xff,0x81,0x1d,
+                                  0x00,0x0f,0x81,0x42,0x06,0xf0,0x07,0xf8,0x0f,0xfe,0x03,0xfc,0x85,0xe7,0x8d,0xff,0x88,0xdd,0xa9,0xff,0x81,0x13,0x04,0xf1,0x01,0xff,0x80,0x81,0x81,0x08,0x00,0x86,
+                                  0x81,0x32,0x0d,0xff,0xf8,0x90,0xff,0x00,0xdf,0x88,0xff,0x03,0xf0,0x00,0x3f,0xf0,0x88,0x82,0x10,0x1c,0xfc,0xa3,0xff,0x81,0x65,0x9a,0xff,0x81,0x2a,0x82,0x38,0x00,
+                                  0xfe,0x97,0xff,0x02,0x7f,0xc0,0x07,0x82,0x53,0xcf,0xff,0x81,0x9a,0x81,0xb2,0x02,0x0f,0x81,0x38,0x05,0xc4,0x84,0xff,0x82,0xab,0x8a,0x81,0x47,0x17,0x8c,0xff,0x00,
+                                  0x3f,0x81,0xfa,0x89,0xff,0x81,0xe9,0x82,0xff,0x00,0x07,0x9e,0xff,0x00,0xfc,0x9c,0xff,0x01,0x0f,0xfc,0xf5,0x81,0x32,0x05,0xff,0xff,0x81,0xb8,0x89,0xff,0x81,0x8a,
+                                  0x11,0xba,0x8d,0xff,0x06,0x1f,0xe0,0x3f,0xdf,0xe0,0x3f,0xc0,0x85,0xff,0x00,0xc0,0x81,0x17,0x88,0x82,0x80,0x05,0x3f,0xa2,0xff,0x00,0xf8,0x9c,0x81,0x34,0x81,0xaa,
+                                  0x03,0xc0,0x00,0x03,0x98,0x81,0xba,0x01,0xe0,0x03,0x81,0x91,0x16,0x80,0x94,0xff,0x85,0xef,0x97,0xff,0x85,0xf7,0x95,0xff,0x81,0xd8,0x89,0xff,0x83,0x66,0x88,0xff,
+                                  0x81,0xb5,0x81,0xea,0x81,0x68,0x11,0x0c,0x82,0xfc,0x85,0xff,0x81,0x95,0x06,0xc0,0x07,0xf8,0xff,0x07,0xf0,0xff,0x81,0xf9,0x99,0x81,0x4d,0x81,0xbf,0x21,0x7f,0x1f,
+                                  0xc3,0x92,0xff,0x00,0xfe,0x81,0xe1,0x07,0x00,0x07,0xfc,0x07,0xf8,0x1f,0xff,0x03,0x93,0xff,0x01,0xf0,0x00,0x81,0xff,0x03,0x00,0x07,0xf8,0x07,0xcc,0xff,0x81,0xf2,
+                                  0x81,0xa5,0x02,0x07,0x82,0x11,0x81,0xa5,0x05,0xab,0x8e,0xff,0x82,0x11,0x86,0x81,0x44,0x01,0x00,0xe0,0x81,0xaf,0x01,0xf8,0x9d,0x81,0x6e,0x81,0x82,0x09,0x03,0x9e,
+                                  0xff,0x05,0x1f,0xf0,0x00,0x7f,0xff,0xfe,0x81,0xc4,0x08,0xfc,0xcc,0xff,0x04,0xc0,0xff,0xe0,0x7f,0xc0,0x81,0x8b,0x01,0x1f,0x87,0x81,0x1c,0x06,0x89,0xff,0x01,0x00,
+                                  0xff,0x81,0xc3,0x81,0x9a,0x0e,0x8f,0x87,0xff,0x81,0xdf,0x8b,0xff,0x05,0x0f,0xff,0xf0,0x07,0xf8,0xfe,0x9d,0x81,0xb7,0x0d,0xff,0xc0,0x9c,0xff,0x07,0x01,0xff,0x00,
+                                  0x3f,0xf8,0x00,0x0f,0xf8,0x97,0x81,0xf9,0x27,0xf8,0x81,0x54,0x00,0xf0,0xb1,0xff,0x81,0x79,0x8c,0xff,0x81,0x6a,0x88,0xff,0x82,0x77,0x81,0xda,0x00,0x1f,0x82,0xf2,
+                                  0x81,0xd9,0x82,0xf4,0x03,0xfc,0x00,0xff,0xe0,0x89,0xff,0x04,0xff,0x80,0x00,0x0f,0xf0,0x81,0xba,0x01,0x00,0x83,0x81,0x79,0x0d,0x8d,0xff,0x83,0x3f,0x00,0x1f,0x83,
+                                  0xa7,0x02,0x3f,0xf0,0x03,0x82,0x1f,0x81,0xc4,0x09,0x39,0x85,0x3f,0x00,0x0c,0x86,0x1f,0x81,0xfa,0x09,0x81,0x7e,0x22,0xf0,0x01,0xff,0xf8,0x00,0xff,0xfc,0x82,0x59,
+                                  0x82,0x7f,0x02,0xff,0x03,0xff,0x82,0x67,0x81,0x8a,0x00,0x3f,0x83,0x5e,0x00,0xe0,0x85,0xb7,0x86,0xbf,0x88,0xef,0x83,0x1f,0x89,0xfa,0x82,0x42,0x24,0x00,0x7f,0x8d,
+                                  0x1f,0x8e,0x0e,0x9e,0x1f,0xbf,0x1e,0x83,0xff,0x04,0x0f,0xf8,0x03,0xfd,0xfe,0x81,0x02,0x85,0xff,0x04,0x3f,0xc0,0x00,0x0f,0xc0,0x87,0xff,0x05,0x01,0xff,0xc0,0x7f,
+                                  0xf0,0x00,0x82,0xef,0x18,0x85,0xff,0x02,0x07,0xff,0xff,0x8b,0xff,0x89,0xf7,0x8f,0xff,0x01,0xff,0xff,0xac,0xff,0x8d,0x2f,0xe2,0xff,0x02,0x78,0x00,0x07,0x81,0x0e,
+                                  0x08,0x1f,0xf0,0x89,0xff,0x02,0xff,0xff,0xe0,0x8b,0x81,0xf2,0x20,0x81,0xff,0x83,0x1c,0xa3,0xff,0x8b,0xd1,0xa1,0xff,0x8b,0x2f,0xe1,0xff,0x01,0x07,0xf8,0x83,0xff,
+                                  0x01,0xfc,0x01,0x95,0xff,0x82,0x92,0x81,0xff,0x00,0xf0,0x88,0xff,0x03,0x81,0x3c,0x07,0xfe,0xaa,0xff,0x89,0xd1,0xa3,0xff,0x89,0x81,0x41,0x01,0x00,0xfc,0x81,0x16,
+                                  0x04,0x01,0x8b,0xff,0x82,0x02,0x81,0x1a,0x03,0x7f,0xff,0xff,0xc0,0x81,0x6b,0x16,0x7f,0x86,0xff,0x81,0xa4,0x00,0xfc,0x95,0xff,0x8e,0xdf,0x85,0xff,0x87,0xd1,0xa5,
+                                  0xff,0x87,0x2f,0xe7,0xff,0x00,0xff,0x81,0x3f,0x19,0xfc,0x85,0xff,0x82,0xd7,0x89,0xff,0x81,0xc3,0x02,0x80,0x00,0x7f,0x8a,0xff,0x02,0x3f,0xff,0xf8,0xae,0xff,0x82,
+                                  0x43,0x89,0x27,0x9f,0x82,0x93,0x07,0xe6,0xff,0x03,0x03,0xfe,0x00,0x0f,0x83,0x81,0x2b,0x31,0x87,0xff,0x81,0xeb,0x00,0xc0,0x88,0xff,0x00,0x1f,0x82,0x8b,0x82,0xff,
+                                  0x81,0x16,0x84,0xff,0x01,0x0f,0xff,0x84,0x1c,0xab,0xff,0x83,0xd1,0xa9,0xff,0x83,0x2f,0xe8,0xff,0x01,0xf8,0x00,0x87,0xff,0x03,0x0f,0xfc,0x00,0xff,0x89,0xff,0x00,
+                                  0x07,0x81,0x18,0x8c,0x81,0x85,0x27,0x81,0xca,0xb1,0xff,0x81,0xd1,0xab,0xff,0x81,0x2f,0xdf,0xff,0x00,0x38,0xdd,0x00,0x02,0x17,0x10,0x17,0x83,0x00,0x00,0x37,0x85,
+                                  0x00,0x90,0x1f,0x83,0x00,0x01,0x16,0x30,0x84,0x00,0x03,0x36,0x26,0x20,0x27,0x81,0x13,0x51,0x2f,0x85,0x00,0x8d,0x1f,0x01,0x30,0x20,0x84,0x00,0x01,0x25,0x28,0x85,
+                                  0x00,0x81,0x3f,0x00,0x50,0x81,0x00,0x01,0x56,0x70,0x85,0x00,0x00,0x60,0x85,0x00,0x01,0x6c,0x68,0x81,0x00,0xa0,0x1f,0x82,0x5f,0x8a,0x3f,0x01,0x74,0x66,0x9c,0x1f,
+                                  0x9e,0x3f,0x97,0x5f,0x00,0x72,0xa4,0x1f,0x00,0x74,0x95,0x9f,0x00,0x50,0x8e,0xdf,0x82,0xde,0x92,0x1f,0x86,0xbf,0x9d,0x1f,0x00,0x65,0xa6,0x3f,0x00,0x10,0x9d,0x7f,
+                                  0x81,0x1f,0x82,0x02,0x83,0x5e,0x02,0x01,0x34,0x20,0x81,0x3d,0x01,0x2c,0x28,0x81,0x6d,0x01,0x2f,0x17,0x81,0x4b,0x01,0x37,0x83,0x81,0x7a,0x05,0x00,0x38,0x8d,0x00,
+                                  0x00,0x27,0x81,0x59,0x00,0x2f,0x82,0x0d,0x04,0xce,0x0f,0x80,0x00,0x00,0x81,0xe1,0x01,0x81,0xff,0xd7,0x00,0x13,0xce,0xff,0x00,0x3f,0xdf,0x00,0x00,0x12,0x85,0x00,
+                                  0x82,0x09,0x00,0x36,0x84,0x00,0x02,0x3f,0x36,0x24,0x81,0xe3,0x09,0x1e,0x00,0x52,0x85,0x00,0x03,0x12,0x12,0x52,0x76,0x81,0xe1,0x39,0x36,0x64,0x86,0x00,0x00,0x24,
+                                  0x87,0x1e,0x81,0x20,0x86,0x1e,0x01,0x76,0x24,0x8d,0x1f,0x81,0x3a,0x81,0x45,0x00,0x36,0x82,0x39,0x83,0x61,0x82,0x1f,0x84,0x61,0x00,0x00,0x82,0x5e,0x01,0x12,0x00,
+                                  0x82,0x06,0x00,0x76,0x83,0x1f,0x83,0xff,0x83,0x1f,0x84,0xfe,0x83,0x1f,0x82,0x85,0x81,0x75,0x82,0x79,0x81,0x0d,0x7f,0x3f,0x85,0xbd,0x85,0x1f,0x82,0x95,0x83,0x5f,
+                                  0x82,0xb3,0x83,0x5f,0x02,0x2d,0x2d,0x2d,0x88,0x1f,0x83,0x7b,0x82,0xbe,0x83,0x39,0x82,0x9f,0x00,0x6d,0x81,0x00,0x81,0x20,0x8d,0x1f,0x83,0xd3,0x82,0x5f,0x82,0x1e,
+                                  0x90,0x1f,0x83,0xb5,0x00,0x00,0x81,0x7f,0x81,0x3b,0x81,0x5f,0x00,0x00,0x84,0x7f,0x81,0x94,0x84,0x5f,0x84,0xb5,0x81,0x9f,0x82,0x5b,0x83,0x09,0x82,0xbf,0x82,0xb4,
+                                  0x83,0xfb,0x87,0xb5,0x00,0x2d,0x84,0x7b,0x84,0xbf,0x83,0xd4,0x82,0xfb,0x88,0xd5,0x8a,0x1f,0x82,0xb4,0x00,0x36,0x83,0x9a,0x93,0x1f,0x83,0xd4,0x84,0xd8,0x93,0x3f,
+                                  0x00,0x00,0x85,0x20,0x81,0xf6,0x93,0x5f,0x81,0x20,0x82,0x00,0x82,0xd6,0x00,0x00,0x83,0xdb,0x83,0x34,0x84,0xdb,0x85,0x0c,0x41,0x85,0x00,0x83,0x09,0x88,0x13,0x86,
+                                  0x1e,0xdd,0x07,0x80,0x00,0xc8,0x00,0x21,0x26,0x3e,0x2e,0xa5,0x7e,0x2e,0x5a,0x7e,0x68,0x7e,0x6b,0x7e,0x6a,0x7e,0x78,0xab,0xaa,0x2f,0x6f,0x7e,0xc9,0x06,0x01,0xcd,
+                                  0x00,0x0f,0x18,0xf9,0x3a,0xfe,0x7f,0x57,0x06,0x02,0x81,0x0a,0x1a,0x3a,0x00,0x3f,0xb7,0x28,0xfa,0x3a,0x02,0x3f,0x32,0xfd,0x7f,0x3a,0x01,0x3f,0x1f,0x38,0x06,0xcd,
+                                  0x10,0x02,0xc3,0xb6,0x00,0xc3,0xdf,0x0f,0x84,0x8a,0x42,0xcd,0xf3,0x01,0xb7,0xc0,0xc5,0x21,0x73,0x0f,0x01,0xfe,0xfe,0xed,0x78,0x2f,0x1e,0x05,0x1f,0x30,0x06,0x57,
+                                  0x7e,0xb7,0x20,0x0c,0x7a,0x23,0x1d,0x20,0xf3,0xcb,0x00,0x38,0xea,0xc1,0xaf,0xc9,0x32,0xfe,0x7f,0xc1,0x3e,0x20,0xb7,0xc9,0x00,0x5a,0x58,0x43,0x56,0x41,0x53,0x44,
+                                  0x46,0x47,0x51,0x57,0x45,0x52,0x54,0x31,0x32,0x33,0x34,0x00,0x08,0x39,0x81,0xd3,0x1e,0x50,0x4f,0x49,0x55,0x59,0x00,0x4c,0x4b,0x4a,0x48,0x20,0x00,0x4d,0x4e,0x42,
+                                  0x3e,0x7f,0xdb,0xfe,0xe6,0x02,0xc2,0x46,0x0f,0xc5,0xed,0x5b,0x04,0x3f,0x06,0x03,0x87,0x88,0x00,0xc1,0x81,0x83,0x0e,0xe6,0x02,0x28,0x19,0x21,0x00,0x23,0x11,0x00,
+                                  0x40,0x01,0x00,0x1b,0xed,0xb0,0x84,0x2b,0x07,0x28,0xf8,0xe1,0x1e,0x40,0xc3,0x1c,0x0f,0x86,0x0d,0x01,0xaf,0xc9,0x89,0x22,0x81,0xaf,0x93,0x00,0x7f,0x01,0x01,0x02,
+                                  0x02,0x03,0x03,0x04,0x04,0x05,0x05,0x06,0x06,0x07,0x07,0x08,0x08,0x09,0x09,0x0a,0x0a,0x0b,0x0b,0x0c,0x0c,0x0d,0x0d,0x0e,0x0e,0x0f,0x0f,0x10,0x10,0x11,0x11,0x12,
+                                  0x12,0x13,0x13,0x14,0x14,0x15,0x15,0x16,0x16,0x17,0x17,0x18,0x18,0x19,0x19,0x1a,0x1a,0x1b,0x1b,0x1c,0x1c,0x1d,0x1d,0x1e,0x1e,0x1f,0x1f,0x20,0x20,0x21,0x21,0x22,
+                                  0x22,0x23,0x23,0x24,0x24,0x25,0x25,0x26,0x26,0x27,0x27,0x28,0x28,0x29,0x29,0x2a,0x2a,0x2b,0x2b,0x2c,0x2c,0x2d,0x2d,0x2e,0x2e,0x2f,0x2f,0x30,0x30,0x31,0x31,0x32,
+                                  0x32,0x33,0x33,0x34,0x34,0x35,0x35,0x36,0x36,0x37,0x37,0x38,0x38,0x39,0x39,0x3a,0x3a,0x3b,0x3b,0x3c,0x3c,0x3d,0x3d,0x3e,0x3e,0x3f,0x3f,0x40,0x40,0x7f,0x41,0x41,
+                                  0x42,0x42,0x43,0x43,0x44,0x44,0x45,0x45,0x46,0x46,0x47,0x47,0x48,0x48,0x49,0x49,0x4a,0x4a,0x4b,0x4b,0x4c,0x4c,0x4d,0x4d,0x4e,0x4e,0x4f,0x4f,0x50,0x50,0x51,0x51,
+                                  0x52,0x52,0x53,0x53,0x54,0x54,0x55,0x55,0x56,0x56,0x57,0x57,0x58,0x58,0x59,0x59,0x5a,0x5a,0x5b,0x5b,0x5c,0x5c,0x5d,0x5d,0x5e,0x5e,0x5f,0x5f,0x60,0x60,0x61,0x61,
+                                  0x62,0x62,0x63,0x63,0x64,0x64,0x65,0x65,0x66,0x66,0x67,0x67,0x68,0x68,0x69,0x69,0x6a,0x6a,0x6b,0x6b,0x6c,0x6c,0x6d,0x6d,0x6e,0x6e,0x6f,0x6f,0x70,0x70,0x71,0x71,
+                                  0x72,0x72,0x73,0x73,0x74,0x74,0x75,0x75,0x76,0x76,0x77,0x77,0x78,0x78,0x79,0x79,0x7a,0x7a,0x7b,0x7b,0x7c,0x7c,0x7d,0x7d,0x7e,0x7e,0x7f,0x7f,0x00,0x80,0xff,0x01,
+                                  0xfc,0x81,0x81,0x00,0x00,0x01,0x81,0x00,0x00,0x02,0x81,0x00,0x00,0x03,0x81,0x00,0x00,0x04,0x81,0x00,0x00,0x05,0x81,0x00,0x00,0x06,0x81,0x00,0x00,0x07,0x81,0x00,
+                                  0x00,0x08,0x81,0x00,0x00,0x09,0x81,0x00,0x00,0x0a,0x81,0x00,0x00,0x0b,0x81,0x00,0x00,0x0c,0x81,0x00,0x00,0x0d,0x81,0x00,0x00,0x0e,0x81,0x00,0x00,0x0f,0x81,0x00,
+                                  0x00,0x10,0x81,0x00,0x00,0x11,0x81,0x00,0x00,0x12,0x81,0x00,0x00,0x13,0x81,0x00,0x00,0x14,0x81,0x00,0x00,0x15,0x81,0x00,0x00,0x16,0x81,0x00,0x00,0x17,0x81,0x00,
+                                  0x00,0x18,0x81,0x00,0x00,0x19,0x81,0x00,0x00,0x1a,0x81,0x00,0x00,0x1b,0x81,0x00,0x00,0x1c,0x81,0x00,0x00,0x1d,0x81,0x00,0x00,0x1e,0x81,0x00,0x00,0x1f,0x81,0x00,
+                                  0x00,0x20,0x81,0x00,0x00,0x21,0x81,0x00,0x00,0x22,0x81,0x00,0x00,0x23,0x81,0x00,0x00,0x24,0x81,0x00,0x00,0x25,0x81,0x00,0x00,0x26,0x81,0x00,0x00,0x27,0x81,0x00,
+                                  0x00,0x28,0x81,0x00,0x00,0x29,0x81,0x00,0x00,0x2a,0x81,0x00,0x00,0x2b,0x81,0x00,0x00,0x2c,0x81,0x00,0x00,0x2d,0x81,0x00,0x00,0x2e,0x81,0x00,0x00,0x2f,0x81,0x00,
+                                  0x00,0x30,0x81,0x00,0x00,0x31,0x81,0x00,0x00,0x32,0x81,0x00,0x00,0x33,0x81,0x00,0x00,0x34,0x81,0x00,0x00,0x35,0x81,0x00,0x00,0x36,0x81,0x00,0x00,0x37,0x81,0x00,
+                                  0x00,0x38,0x81,0x00,0x00,0x39,0x81,0x00,0x00,0x3a,0x81,0x00,0x00,0x3b,0x81,0x00,0x00,0x3c,0x81,0x00,0x00,0x3d,0x81,0x00,0x00,0x3e,0x81,0x00,0x00,0x3f,0x81,0x00,
+                                  0x03,0x00,0x40,0x80,0xc0,0xff,0x03,0xfa,0x83,0x85,0x00,0x00,0x01,0x85,0x00,0x00,0x02,0x85,0x00,0x00,0x03,0x85,0x00,0x00,0x04,0x85,0x00,0x00,0x05,0x85,0x00,0x00,
+                                  0x06,0x85,0x00,0x00,0x07,0x85,0x00,0x00,0x08,0x85,0x00,0x00,0x09,0x85,0x00,0x00,0x0a,0x85,0x00,0x00,0x0b,0x85,0x00,0x00,0x0c,0x85,0x00,0x00,0x0d,0x85,0x00,0x00,
+                                  0x0e,0x85,0x00,0x00,0x0f,0x85,0x00,0x00,0x10,0x85,0x00,0x00,0x11,0x85,0x00,0x00,0x12,0x85,0x00,0x00,0x13,0x85,0x00,0x00,0x14,0x85,0x00,0x00,0x15,0x85,0x00,0x00,
+                                  0x16,0x85,0x00,0x00,0x17,0x85,0x00,0x00,0x18,0x85,0x00,0x00,0x19,0x85,0x00,0x00,0x1a,0x85,0x00,0x00,0x1b,0x85,0x00,0x00,0x1c,0x85,0x00,0x00,0x1d,0x85,0x00,0x00,
+                                  0x1e,0x85,0x00,0x00,0x1f,0x85,0x00,0x07,0x00,0x20,0x40,0x60,0x80,0xa0,0xc0,0xe0,0xff,0x07,0xf6,0x87,0x8d,0x00,0x00,0x01,0x8d,0x00,0x00,0x02,0x8d,0x00,0x00,0x03,
+                                  0x8d,0x00,0x00,0x04,0x8d,0x00,0x00,0x05,0x8d,0x00,0x00,0x06,0x8d,0x00,0x00,0x07,0x8d,0x00,0x00,0x08,0x8d,0x00,0x00,0x09,0x8d,0x00,0x00,0x0a,0x8d,0x00,0x00,0x0b,
+                                  0x8d,0x00,0x00,0x0c,0x8d,0x00,0x00,0x0d,0x8d,0x00,0x00,0x0e,0x8d,0x00,0x00,0x0f,0x8d,0x00,0x0f,0x00,0x10,0x20,0x30,0x40,0x50,0x60,0x70,0x80,0x90,0xa0,0xb0,0xc0,
+                                  0xd0,0xe0,0xf0,0xff,0x0f,0xee,0x8f,0x9d,0x00,0x00,0x01,0x9d,0x00,0x00,0x02,0x9d,0x00,0x00,0x03,0x9d,0x00,0x00,0x04,0x9d,0x00,0x00,0x05,0x9d,0x00,0x00,0x06,0x9d,
+                                  0x00,0x00,0x07,0x9d,0x00,0x1f,0x00,0x08,0x10,0x18,0x20,0x28,0x30,0x38,0x40,0x48,0x50,0x58,0x60,0x68,0x70,0x78,0x80,0x88,0x90,0x98,0xa0,0xa8,0xb0,0xb8,0xc0,0xc8,
+                                  0xd0,0xd8,0xe0,0xe8,0xf0,0xf8,0xff,0x1f,0xde,0x9f,0xbd,0x00,0x00,0x01,0xbd,0x00,0x00,0x02,0xbd,0x00,0x00,0x03,0xbd,0x00,0x3f,0x00,0x04,0x08,0x0c,0x10,0x14,0x18,
+                                  0x1c,0x20,0x24,0x28,0x2c,0x30,0x34,0x38,0x3c,0x40,0x44,0x48,0x4c,0x50,0x54,0x58,0x5c,0x60,0x64,0x68,0x6c,0x70,0x74,0x78,0x7c,0x80,0x84,0x88,0x8c,0x90,0x94,0x98,
+                                  0x9c,0xa0,0xa4,0xa8,0xac,0xb0,0xb4,0xb8,0xbc,0xc0,0xc4,0xc8,0xcc,0xd0,0xd4,0xd8,0xdc,0xe0,0xe4,0xe8,0xec,0xf0,0xf4,0xf8,0xfc,0xff,0x3f,0xbe,0xbf,0xfd,0x00,0x00,
+                                  0x01,0xfd,0x00,0x7f,0x00,0x02,0x04,0x06,0x08,0x0a,0x0c,0x0e,0x10,0x12,0x14,0x16,0x18,0x1a,0x1c,0x1e,0x20,0x22,0x24,0x26,0x28,0x2a,0x2c,0x2e,0x30,0x32,0x34,0x36,
+                                  0x38,0x3a,0x3c,0x3e,0x40,0x42,0x44,0x46,0x48,0x4a,0x4c,0x4e,0x50,0x52,0x54,0x56,0x58,0x5a,0x5c,0x5e,0x60,0x62,0x64,0x66,0x68,0x6a,0x6c,0x6e,0x70,0x72,0x74,0x76,
+                                  0x78,0x7a,0x7c,0x7e,0x80,0x82,0x84,0x86,0x88,0x8a,0x8c,0x8e,0x90,0x92,0x94,0x96,0x98,0x9a,0x9c,0x9e,0xa0,0xa2,0xa4,0xa6,0xa8,0xaa,0xac,0xae,0xb0,0xb2,0xb4,0xb6,
+                                  0xb8,0xba,0xbc,0xbe,0xc0,0xc2,0xc4,0xc6,0xc8,0xca,0xcc,0xce,0xd0,0xd2,0xd4,0xd6,0xd8,0xda,0xdc,0xde,0xe0,0xe2,0xe4,0xe6,0xe8,0xea,0xec,0xee,0xf0,0xf2,0xf4,0xf6,
+                                  0xf8,0xfa,0xfc,0xfe,0xfe,0x7f,0x7f,0x38,0x1e,0x54,0x75,0x72,0x6e,0x20,0x5a,0x58,0x20,0x50,0x69,0x63,0x6f,0x5a,0x58,0x43,0x78,0x20,0x55,0x6e,0x69,0x74,0x20,0x4f,
+                                  0x66,0x66,0x0a,0x1e,0x52,0x4f,0x4d,0x20,0x54,0x65,0x73,0x74,0x65,0x72,0x09,0x1c,0x1d,0x0a,0x1e,0x4c,0x6f,0x6f,0x6b,0x69,0x6e,0x67,0x20,0x47,0x6c,0x61,0x73,0x73,
+                                  0x20,0x81,0x1c,0x81,0x21,0x0c,0x65,0x74,0x72,0x6f,0x6c,0x65,0x75,0x6d,0x20,0x44,0x69,0x61,0x67,0x82,0x2f,0x06,0x76,0x31,0x2e,0x35,0x39,0x0a,0x1e,0x81,0x50,0x05,
+                                  0x53,0x70,0x65,0x63,0x74,0x72,0x85,0x1a,0x0c,0x6e,0x6f,0x73,0x74,0x69,0x63,0x73,0x20,0x76,0x30,0x2e,0x33,0x37,0x83,0x4d,0x8a,0x21,0x82,0x64,0x12,0x20,0x43,0x61,
+                                  0x72,0x74,0x72,0x69,0x64,0x67,0x65,0x5a,0x0a,0x1e,0x31,0x32,0x38,0x6b,0x20,0x52,0x41,0x86,0x7d,0x11,0x0a,0x1e,0x57,0x68,0x65,0x72,0x65,0x20,0x54,0x69,0x6d,0x65,
+                                  0x20,0x53,0x74,0x6f,0x6f,0x64,0x81,0x05,0x04,0x69,0x6c,0x6c,0x20,0x28,0x82,0x28,0x0e,0x29,0x09,0x1a,0x1b,0x0a,0x1e,0x41,0x75,0x74,0x6f,0x6d,0x61,0x6e,0x69,0x61,
+                                  0x83,0x0d,0x09,0x43,0x68,0x61,0x73,0x65,0x20,0x48,0x2e,0x51,0x2e,0x89,0x23,0x0a,0x1f,0x4f,0x72,0x69,0x67,0x69,0x6e,0x61,0x6c,0x20,0x34,0x82,0x5e,0x02,0x4f,0x4d,
+                                  0x00,0x80,0x00,0xff,0x00,0xff,0x81,0xa1,0xff,0x80 };
@@ -0,0 +1,362 @@
+// TAPtoROM - TAP tape image to ROM Cartridge converter for ZX PicoIF2Lite
+//
+// TAPtoROM is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// TAPtoROM is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with TAPtoROM. If not, see <http://www.gnu.org/licenses/>.
+//
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#define VERSION_NUM "v1.1"
+#define PROGNAME "TAPtoROM"
+
+//v1.0 initial release
+//v1.1 tape window only open while LD-BYTES runs & patch moved off 0x3a00, IM2 vectors read 0xff,
+//     the 48k ROM can be a header made by compressROM such as rominc/48.h
+
+// The cartridge is a 48k ROM with LD-BYTES (0x0556) patched to read the tape
+// blocks from the interface's tape window (0x3900, any read is the next byte)
+// instead of the tape port, so LOAD "" & machine code calling LD-BYTES load at
+// LDIR speed. The window is only there between the new LD-BYTES opening it &
+// closing it again through the command window (0x3e00, command 0x05 with lo 1
+// to open & 0 to close), with interrupts off. The rest of the time 0x3900-
+// 0x39ff is the ROM's 0xff for programs using it as an IM2 vector table. The
+// interrupt routine types LOAD "" at the copyright message so the tape starts
+// on its own. The patches go in the spare space of the ROM
+// (0x386e-0x3cff) so a 48k ROM has to be supplied, a 16kB dump or a header
+// made by compressROM (rominc/48.h), it isn't included.
+// Output (mode 5, flags 0x04 streamed):
+//   stream 0 - the patched 16kB ROM
+//   stream 1 - the TAP file as it is (2byte length then flag, data & checksum
+//              for each block) followed by a 0 length to mark the end
+//
+// E00 - invalid option
+// E01 - input file not a TAP
+// E02 - cannot open TAP for read
+// E03 - cannot create output file
+// E04 - TAP damaged, block runs past the end of the file or no blocks
+// E05 - cannot open 48k ROM for read
+// E06 - not enough memory
+// E07 - not a 48k ROM, needs LD-BYTES at 0x0556 & 0x3900-0x3cff spare
+//
+uint32_t simplelz(uint8_t* fload, uint8_t* store, uint32_t filesize);
+void error(uint8_t errorcode);
+void printOut(FILE* fp, uint8_t* buffer, uint32_t filesize, char* name,char *oname);
+void romHeader(char* fname, uint8_t* rom);
+
+//main
+int main(int argc, char* argv[]) {
+	if (argc < 3) {
+		fprintf(stdout, "Usage: TAPtoROM <-b> infile.tap 48k.rom <displayname>\n");
+		fprintf(stdout, "  48k.rom is a 16kB dump or a header made by compressROM such as rominc/48.h\n");
+		fprintf(stdout, "  -b also create binary file of the patched ROM\n");
+		fprintf(stdout,"  if no displayname given infile filename will be used\n");
+		exit(0);
+	}
+	//
+	uint8_t produceBinary = 0;
+	uint8_t command=1;
+	while(command<argc&&argv[command][0]=='-') {
+		if (argv[command][1] == 'b') {
+			produceBinary = 1;
+		} else {
+			error(0);
+		}
+		command++;
+	}
+	if (command + 1 >= argc) error(0);
+	// check infile is a tape
+	char* fTAP = argv[command];
+	if (strlen(fTAP) < 4 || (strcmp(&fTAP[strlen(fTAP) - 4], ".tap") != 0 && strcmp(&fTAP[strlen(fTAP) - 4], ".TAP") != 0)) error(1);
+	// create output file name
+	char fROM[256]; // limit to 256chars
+	int i=0;
+	do {
+		fROM[i] = fTAP[i];
+		i++;
+	} while(i<254&&(fTAP[i]!='.'||i<strlen(fTAP)-4));
+	fROM[i] = '\0';
+	// LD-BYTES replacement, A flag wanted, carry set LOAD/reset VERIFY, IX start & DE length as
+	// the ROM one. Opens the tape window after DI, blocks with the wrong flag are skipped as a
+	// tape would be, then closes it & finishes through LD-RET (0x053f) for the border, BREAK & EI.
+	// The close frame's LD A,(nn) reads leave the carry flag alone
+#define tapeReg_at 0x3a01	// not 0x3a00 or 0x3aff, IM2 with I=0x39 or 0x3a reads its vector there
+#define tapeReg_key 0x3a91	// IM1 keyboard call, types LOAD "" once after power on
+	uint8_t tapeReg[] = { 0xf3,0xf5,0x3a,0xa5,0x3e,0x3a,0x5a,0x3e,0x3a,0x05,0x3e,0x3a,0x01,0x3e,0x3a,0x00,
+	                      0x3e,0x3a,0xfb,0x3e,0x21,0x00,0x39,0x4e,0x46,0x78,0xb1,0x28,0x31,0xf1,0xf5,0xbe,
+	                      0x0b,0x20,0x30,0xf1,0xf5,0x30,0x1e,0x0b,0x60,0x69,0xa7,0xed,0x52,0x38,0x1b,0xe5,
+	                      0x42,0x4b,0xdd,0xe5,0xd1,0xcd,0x62,0x3a,0xd5,0xdd,0xe1,0xc1,0x03,0xcd,0x59,0x3a,
+	                      0xf1,0x37,0xc3,0x7c,0x3a,0xcd,0x59,0x3a,0x18,0xf6,0x03,0xcd,0x59,0x3a,0xf1,0xa7,
+	                      0xc3,0x7c,0x3a,0xcd,0x59,0x3a,0x18,0xbf,0x78,0xb1,0xc8,0x3a,0x00,0x39,0x0b,0x18,
+	                      0xf7,0x78,0xb7,0x28,0x0d,0xc5,0x21,0x00,0x39,0x01,0x00,0x01,0xed,0xb0,0xc1,0x05,
+	                      0x18,0xef,0x79,0xb7,0xc8,0x21,0x00,0x39,0xed,0xb0,0xc9,0x3a,0xa5,0x3e,0x3a,0x5a,
+	                      0x3e,0x3a,0x05,0x3e,0x3a,0x00,0x3e,0x3a,0x00,0x3e,0x3a,0xfa,0x3e,0xc3,0x3f,0x05,
+	// KEYBOARD then, until all 4 keys from the list at the end are typed, the next one whenever
+	// the last has been taken & the editor is waiting (interrupted in WAIT-KEY or KEY-INPUT, a
+	// key typed while the copyright message is up is lost). Keys typed so far in 0x5cb0 (not used)
+	                      0xcd,0xbf,0x02,0x21,0xb0,0x5c,0x7e,0xfe,0x04,0xd0,0xfd,0xcb,0x01,0x6e,0xc0,0x21,
+	                      0x0a,0x00,0x39,0x5e,0x23,0x56,0x21,0x22,0xea,0x19,0x01,0xef,0xff,0x09,0x30,0x09,
+	                      0x21,0x58,0xef,0x19,0x01,0xf8,0xff,0x09,0xd8,0x21,0xb0,0x5c,0x7e,0x34,0x5f,0x16,
+	                      0x00,0x21,0xcf,0x3a,0x19,0x7e,0x32,0x08,0x5c,0xfd,0xcb,0x01,0xee,0xc9,0xef,0x22,
+	                      0x22,0x0d };
+	//
+	FILE* fp_in, * fp_out;
+	if ((fp_in = fopen(fTAP, "rb")) == NULL) error(2); // cannot open tape for read
+	fseek(fp_in, 0, SEEK_END); // jump to the end of the file to get the length
+	long filesize = ftell(fp_in); // get the file size
+	rewind(fp_in);
+	uint8_t* tap;
+	if ((tap = (uint8_t*)malloc(filesize + 2)) == NULL) error(6);
+	if (fread(tap, sizeof(uint8_t), filesize, fp_in) != filesize) error(2);
+	fclose(fp_in);
+	tap[filesize] = tap[filesize + 1] = 0x00; // end of tape
+	// ROM to patch
+	uint8_t rom[16384];
+	char* fROM48 = argv[command + 1];
+	if (strlen(fROM48) > 2 && strcmp(&fROM48[strlen(fROM48) - 2], ".h") == 0) {
+		romHeader(fROM48, rom);
+	} else {
+		if ((fp_in = fopen(fROM48, "rb")) == NULL) error(5);
+		fseek(fp_in, 0, SEEK_END);
+		if (ftell(fp_in) != 16384) error(7);
+		rewind(fp_in);
+		if (fread(rom, sizeof(uint8_t), 16384, fp_in) != 16384) error(5);
+		fclose(fp_in);
+	}
+	if (rom[0x0556] != 0x14 || rom[0x0557] != 0x08 || rom[0x0558] != 0x15 || rom[0x004a] != 0xcd) error(7);
+	for (i = 0x3900; i < 0x3d00; i++) if (rom[i] != 0xff) error(7);
+	// list the blocks
+	//              12345678901234567890123456789012345678901234567890123456789012345678901234567890
+	//						 1         2         3         4         5         6         7         8
+	fprintf(stdout,"  /----------------------------------------------------------------------------\\\n");
+	long j = 0;
+	int blocks = 0;
+	char line[128];
+	const char *types[] = { "Program", "Number array", "Character array", "Bytes" };
+	while (j < filesize) {
+		uint32_t len = tap[j] + tap[j + 1] * 256;
+		if (len < 2 || j + 2 + len > filesize) error(4);
+		uint8_t check = 0;
+		for (uint32_t k = 0; k < len; k++) check ^= tap[j + 2 + k];
+		uint8_t *b = &tap[j + 2];
+		if (b[0] == 0x00 && len == 19 && b[1] < 4) {
+			int n = sprintf(line, "%3d header %-15s \"%-10.10s\" %5d bytes", blocks, types[b[1]], &b[2], b[12] + b[13] * 256);
+			if (b[1] == 0) sprintf(&line[n], " line %5d", b[14] + b[15] * 256);
+			else if (b[1] == 3) sprintf(&line[n], " at   %5d", b[14] + b[15] * 256);
+		} else {
+			sprintf(line, "%3d data   flag $%02x                        %5d bytes", blocks, b[0], len - 2);
+		}
+		fprintf(stdout, "  |%-70s%5s |\n", line, check ? "BAD" : "");
+		blocks++;
+		j += 2 + len;
+	}
+	if (blocks == 0) error(4);
+	fprintf(stdout,"  |----------------------------------------------------------------------------|\n");
+	// patch the ROM
+	for (i = 0; i < sizeof(tapeReg); i++) rom[tapeReg_at + i] = tapeReg[i];
+	rom[0x0556] = 0xc3; // jp to the new LD-BYTES
+	rom[0x0557] = tapeReg_at & 0xff;
+	rom[0x0558] = tapeReg_at >> 8;
+	rom[0x004b] = tapeReg_key & 0xff; // IM1 calls the key typer rather than KEYBOARD
+	rom[0x004c] = tapeReg_key >> 8;
+	if (produceBinary == 1) {
+		strcat(fROM, ".rom");
+		if ((fp_out = fopen(fROM, "wb")) == NULL) error(3); // cannot open file for write
+		if (fwrite(rom, sizeof(uint8_t), 16384, fp_out) != 16384) error(3);
+		fclose(fp_out);
+		fROM[strlen(fROM) - 4] = '\0';
+	}
+	// compress the ROM & the tape on their own, the interface unpacks the ROM at selection
+	// and the tape on its second core as the ROM reads it
+	uint8_t* comp;
+	if ((comp = (uint8_t*)malloc(16384 + (16384 / 64) + filesize + 2 + ((filesize + 2) / 64) + 16)) == NULL) error(6);
+	uint32_t romsize = simplelz(rom, comp, 16384);
+	uint32_t cmsize = romsize + simplelz(tap, &comp[romsize], filesize + 2);
+	sprintf(line, "ROM %5dbytes, tape of %3d blocks %6ldbytes compressed to %6dbytes", romsize, blocks, filesize, cmsize - romsize);
+	fprintf(stdout, "  |%-76s|\n", line);
+	fprintf(stdout,"  \\----------------------------------------------------------------------------/\n");
+	free(tap);
+	// create ROM name
+	char outName[33],headerName[33];
+	i=0;
+	unsigned int k=0;
+	if((fTAP[k]>='0'&&fTAP[k]<='9')) {
+		headerName[k]='_';	// starts with a number
+		k++;
+	}
+	do {
+		outName[i]=fTAP[i];
+		if(k<32) {
+			if(fTAP[i]>='A'&&fTAP[i]<='Z') {
+				headerName[k++]=fTAP[i]+32;
+			} else if((fTAP[i]>='0'&&fTAP[i]<='9')||
+					(fTAP[i]>='a'&&fTAP[i]<='z')) {
+				headerName[k++]=fTAP[i];
+			} else {
+				headerName[k++]='_';
+			}
+		}
+		i++;
+	} while(i<32&&(fTAP[i]!='.'||i<strlen(fTAP)-4));
+	outName[i]=headerName[k]='\0';
+	strcat(fROM, ".h");
+	if ((fp_out = fopen(fROM, "wb")) == NULL) error(3); // cannot open rom for write
+	//
+	fprintf(fp_out,"// ,%s",headerName);
+	for(i=strlen(headerName);i<35;i++) fprintf(fp_out," ");
+	fprintf(fp_out,"// xx - %dbytes\n",cmsize+34);
+	if(command+2<argc) {
+		printOut(fp_out, comp, cmsize, headerName, argv[argc-1]);
+	} else {
+		printOut(fp_out, comp, cmsize, headerName, outName);
+	}
+	//
+	fclose(fp_out);
+	free(comp);
+	// all done
+	return 0;
+}
+
+//
+// ---------------------------------------------------------------------------
+// printOut - print out the binary in a standard header format
+// ---------------------------------------------------------------------------
+void printOut(FILE* fp, uint8_t* buffer, uint32_t filesize, char* name,char *oname) {
+	uint32_t i, j;
+	fprintf(fp, "    const uint8_t %s[]={ ", name);
+	//
+	fprintf(fp,"0x05,");	// tape
+	fprintf(fp,"0x04,");	// flags, ROM then its data streamed to it
+	j=0;
+	do {
+		if(j<strlen(oname)) fprintf(fp,"0x%02x,",oname[j]);
+		else fprintf(fp,"0x00,");
+	} while(++j<32);
+	fprintf(fp,"\n");
+	for(j=0;j<23+strlen(name);j++) fprintf(fp," ");
+	//
+	for (i = 0; i < filesize; i++) {
+		if ((i % 32) == 0 && i != 0) {
+			fprintf(fp, "\n");
+			for (j = 0; j < 23 + strlen(name); j++) fprintf(fp, " ");
+		}
+		fprintf(fp, "0x%02x", buffer[i]);
+		if (i < filesize - 1) {
+			fprintf(fp, ",");
+		}
+	}
+	fprintf(fp, " };\n");
+}
+
+//
+// ---------------------------------------------------------------------------
+// romHeader - the 48k ROM from a header made by compressROM, unpacked. Only
+// a plain 16kB ROM (mode 0) will do
+// ---------------------------------------------------------------------------
+void romHeader(char* fname, uint8_t* rom) {
+	static uint8_t from[34 + 16384 + 16384 / 64 + 16];
+	uint32_t len = 0, i = 0, j = 34, k;
+	unsigned int v;
+	uint8_t c, o;
+	int ch;
+	FILE* fp_in;
+	if ((fp_in = fopen(fname, "rb")) == NULL) error(5);
+	while ((ch = fgetc(fp_in)) != EOF && ch != '{') {
+		if (ch == '/') while ((ch = fgetc(fp_in)) != EOF && ch != '\n'); // comment line, the name could have a { in it
+	}
+	while ((ch = fgetc(fp_in)) != EOF && ch != '}') {
+		if (ch != 'x' && ch != 'X') continue;
+		if (len >= sizeof(from) || fscanf(fp_in, "%2x", &v) != 1) error(7);
+		from[len++] = v;
+	}
+	fclose(fp_in);
+	if (len < 35 || from[0] != 0x00) error(7);
+	while (j < len && (c = from[j++]) != 128) {
+		if (c < 128) {
+			if (i + c + 1 > 16384 || j + c + 1 > len) error(7);
+			for (k = 0; k < c + 1u; k++) rom[i++] = from[j++];
+		} else {
+			if (i + c - 126 > 16384 || j >= len) error(7);
+			o = from[j++];
+			for (k = 0; k < c - 126u; k++, i++) rom[i] = i > o ? rom[i - (o + 1)] : 0;
+		}
+	}
+	if (i != 16384) error(7);
+}
+
+//
+// ---------------------------------------------------------------------------
+// simplelz - very simple lz with 256byte backward look
+//   x=128+ then copy sequence from x-offset from next byte offset
+//   x=0-127 then copy literal x+1 times
+//   minimum sequence size 2
+// ---------------------------------------------------------------------------
+uint32_t simplelz(uint8_t* fload, uint8_t* store, uint32_t filesize) {
+	int i;
+	uint8_t* store_p, * store_c;
+
+	int litsize = 1;
+	int repsize, offset, repmax, offmax;
+	store_c = store;
+	store_p = store_c + 1;
+	//
+	i = 0;
+	*store_p++ = fload[i++];
+	do {
+		// scan for sequence
+		repmax = 2;
+		if (i > 255) offset = i - 256; else offset = 0;
+		do {
+			repsize = 0;
+			while (fload[offset + repsize] == fload[i + repsize] && i + repsize < filesize && repsize < 129) {
+				repsize++;
+			}
+			if (repsize > repmax) {
+				repmax = repsize;
+				offmax = i - offset;
+			}
+			offset++;
+		} while (offset < i && repmax < 129);
+		if (repmax > 2) {
+			if (litsize > 0) {
+				*store_c = litsize - 1;
+				store_c = store_p++;
+				litsize = 0;
+			}
+			*store_p++ = offmax - 1; //1-256 -> 0-255
+			*store_c = repmax + 126;
+			store_c = store_p++;
+			i += repmax;
+		}
+		else {
+			litsize++;
+			*store_p++ = fload[i++];
+			if (litsize > 127) {
+				*store_c = litsize - 1;
+				store_c = store_p++;
+				litsize = 0;
+			}
+		}
+	} while (i < filesize);
+	if (litsize > 0) {
+		*store_c = litsize - 1;
+		store_c = store_p++;
+	}
+	*store_c = 128;	// end marker
+	return store_p - store;
+}
+
+void error(uint8_t errorcode) {
+	fprintf(stdout, "[E%02d]\n", errorcode);
+	exit(errorcode);
+}
@@ -0,0 +1,38 @@
+# bench_launch.cmake - run by ctest, converts the sample 128k snapshot & runs
+# it with benchROM, then with -w as firmware before v0.8 would launch it
+#
+#   cmake -DZ80TOROM=<tool> -DBENCHROM=<tool> -DSNAPSHOTS=<folder>
+#         -DWORK=<scratch folder> -P bench_launch.cmake
+#
+# Unpacking bank by bank has to get it to its game sooner from being
+# selected, with RESET held for a little over the 100ms wait.
+file(REMOVE_RECURSE ${WORK})
+file(MAKE_DIRECTORY ${WORK})
+execute_process(COMMAND ${Z80TOROM} -o ${WORK}/v3_128.bin ${SNAPSHOTS}/v3_128.z80
+    RESULT_VARIABLE rc OUTPUT_QUIET)
+if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "Z80toROM v3_128.z80 failed [E${rc}]")
+endif()
+foreach(name banked whole)
+    set(opts "")
+    if(name STREQUAL "whole")
+        set(opts -w)
+    endif()
+    execute_process(COMMAND ${BENCHROM} ${opts} ${WORK}/v3_128.bin
+        RESULT_VARIABLE rc OUTPUT_VARIABLE out)
+    message("${out}")
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "benchROM ${opts}: the sample snapshot failed")
+    endif()
+    if(NOT out MATCHES "select to game ([0-9.]+)ms, RESET held ([0-9.]+)ms")
+        message(FATAL_ERROR "benchROM ${opts}: no select to game reported")
+    endif()
+    set(${name}_game ${CMAKE_MATCH_1})
+    set(${name}_held ${CMAKE_MATCH_2})
+endforeach()
+if(NOT banked_game LESS whole_game)
+    message(FATAL_ERROR "benchROM: select to game ${banked_game}ms bank by bank, ${whole_game}ms whole")
+endif()
+if(banked_held LESS 100 OR NOT banked_held LESS 105)
+    message(FATAL_ERROR "benchROM: RESET held ${banked_held}ms with only bank 0 unpacked")
+endif()
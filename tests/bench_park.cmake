@@ -0,0 +1,29 @@
+# bench_park.cmake - run by ctest, builds the park sample in tests/park & runs
+# it with benchROM -p, which models the sequencer's park check with refresh
+# cycles on the bus
+#
+#   cmake -DCOMPRESSROM=<tool> -DBENCHROM=<tool> -DSAMPLE=<folder>
+#         -DWORK=<scratch folder> -P bench_park.cmake
+#
+# It must park at the byte after its DI HALT, not in the 4 seconds of IM1
+# before it, with I at 0 so refresh cycles read 0x0038 thousands of times a
+# second.
+file(REMOVE_RECURSE ${WORK})
+file(MAKE_DIRECTORY ${WORK})
+execute_process(COMMAND ${COMPRESSROM} -o ${WORK}/park.bin ${SAMPLE}/park.rom "Park"
+    RESULT_VARIABLE rc OUTPUT_QUIET)
+if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "compressROM park.rom failed [E${rc}]")
+endif()
+execute_process(COMMAND ${BENCHROM} -p -f 600 ${WORK}/park.bin
+    RESULT_VARIABLE rc OUTPUT_VARIABLE out)
+message("${out}")
+if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "benchROM -p: the park sample never parked")
+endif()
+if(NOT out MATCHES "parked at \\$0015, seen at ([0-9]+)")
+    message(FATAL_ERROR "benchROM -p: the park sample parked somewhere else")
+endif()
+if(CMAKE_MATCH_1 LESS 4000)
+    message(FATAL_ERROR "benchROM -p: the park sample parked while it was taking IM1")
+endif()
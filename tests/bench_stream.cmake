@@ -0,0 +1,30 @@
+# bench_stream.cmake - run by ctest, builds the stream port sample in
+# tests/stream the way the catalog build would & runs it with benchROM
+#
+#   cmake -DCOMPRESSROM=<tool> -DBENCHROM=<tool> -DSAMPLE=<folder>
+#         -DWORK=<scratch folder> -P bench_stream.cmake
+#
+# The data file goes straight after the ROM as it would in the ROM list.
+# benchROM fails if the ROM opens anything else or doesn't read all of it,
+# and the stream's bytes/s has to be in what it reports.
+file(REMOVE_RECURSE ${WORK})
+file(MAKE_DIRECTORY ${WORK})
+execute_process(COMMAND ${COMPRESSROM} -s -o ${WORK}/streamdemo.bin ${SAMPLE}/streamdemo.rom "Stream demo"
+    RESULT_VARIABLE rc OUTPUT_QUIET)
+if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "compressROM -s streamdemo.rom failed [E${rc}]")
+endif()
+execute_process(COMMAND ${COMPRESSROM} -x -o ${WORK}/stripes.bin ${SAMPLE}/stripes.scr "Stripes"
+    RESULT_VARIABLE rc OUTPUT_QUIET)
+if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "compressROM -x stripes.scr failed [E${rc}]")
+endif()
+execute_process(COMMAND ${BENCHROM} ${WORK}/streamdemo.bin ${WORK}/stripes.bin
+    RESULT_VARIABLE rc OUTPUT_VARIABLE out)
+message("${out}")
+if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "benchROM: the stream sample failed")
+endif()
+if(NOT out MATCHES "stream 6912 bytes in [0-9.]+ms, [0-9]+ bytes/s")
+    message(FATAL_ERROR "benchROM: no stream reported for the stream sample")
+endif()
@@ -0,0 +1,40 @@
+# bench_tape.cmake - run by ctest, makes a cartridge of every tape in a
+# folder with TAPtoROM & runs each with benchROM
+#
+#   cmake -DTAPTOROM=<tool> -DBENCHROM=<tool> -DROM48=<48k ROM or header>
+#         -DTAPES=<folder> -DWORK=<scratch folder> -P bench_tape.cmake
+#
+# The tapes are copied to WORK first as TAPtoROM leaves each header next to
+# its tape. benchROM fails a tape that takes an interrupt with the tape
+# window open or doesn't read 0xff at 0x39ff & 0x3a00, and every tape has to
+# be read to the end.
+file(REMOVE_RECURSE ${WORK})
+file(MAKE_DIRECTORY ${WORK})
+file(GLOB tapes RELATIVE ${TAPES} ${TAPES}/*.tap)
+list(SORT tapes)
+if(NOT tapes)
+    message(FATAL_ERROR "no tapes in ${TAPES}")
+endif()
+set(headers "")
+foreach(tape IN LISTS tapes)
+    configure_file(${TAPES}/${tape} ${WORK}/${tape} COPYONLY)
+    execute_process(COMMAND ${TAPTOROM} ${tape} ${ROM48}
+        WORKING_DIRECTORY ${WORK} RESULT_VARIABLE rc OUTPUT_QUIET)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "TAPtoROM ${tape} failed [E${rc}]")
+    endif()
+    string(REGEX REPLACE "\\.tap$" ".h" header ${tape})
+    list(APPEND headers ${header})
+endforeach()
+execute_process(COMMAND ${BENCHROM} ${headers} WORKING_DIRECTORY ${WORK}
+    RESULT_VARIABLE rc OUTPUT_VARIABLE out)
+message("${out}")
+if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "benchROM: a tape failed")
+endif()
+list(LENGTH tapes count)
+string(REGEX MATCHALL "tape read at" read "${out}")
+list(LENGTH read readCount)
+if(NOT readCount EQUAL count)
+    message(FATAL_ERROR "benchROM: ${readCount} of ${count} tapes read to the end")
+endif()
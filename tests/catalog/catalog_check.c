@@ -0,0 +1,47 @@
+// catalog_check.c - the ROMs romcatalog.cmake linked in, found through the
+// roms[] table it generated, run by verify_catalog.cmake with the ROMs it
+// converted itself for every line of the manifest after the first:
+//
+//   catalog_check <rom 1> <rom 2> ...
+//
+// The first line is the ROM Explorer's header, which is compared with the
+// array in the header itself
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rominc/romexplorer.h"
+#include "catalog_gen.h"
+
+int testFailed=0;
+#define CHECK(what,cond) do { if(!(cond)) { testFailed++; printf("FAIL %s:%d %s\n",__FILE__,__LINE__,what); } else printf("ok   %s\n",what); } while(0)
+
+static uint8_t expect[8*16384+34+1];
+
+//
+// ---------------------------------------------------------------------------
+// same - ROM n in the table is the file given for it, byte for byte
+// ---------------------------------------------------------------------------
+bool same(int n,const char *fname) {
+    FILE *fp=fopen(fname,"rb");
+    if(fp==NULL) return false;
+    size_t len=fread(expect,1,sizeof(expect),fp);
+    fclose(fp);
+    return len>34&&len<sizeof(expect)&&memcmp(roms[n],expect,len)==0;
+}
+
+int main(int argc,char *argv[]) {
+    char what[600];
+    int n=sizeof(roms)/sizeof(roms[0]);
+    CHECK("catalog: a ROM in roms[] for every line of the manifest",n==argc);
+    CHECK("catalog: ROM 0 is the ROM Explorer from its header",memcmp(roms[0],romexplorer,sizeof(romexplorer))==0);
+    for(int i=1;i<n&&i<argc;i++) {
+        snprintf(what,sizeof(what),"catalog: ROM %d is %s",i,argv[i]);
+        CHECK(what,same(i,argv[i]));
+    }
+    bool aligned=true;
+    for(int i=0;i<n;i++) aligned&=((uintptr_t)roms[i]&3)==0;
+    CHECK("catalog: every ROM word aligned",aligned);
+    return testFailed!=0;
+}
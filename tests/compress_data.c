@@ -0,0 +1,92 @@
+// compress_data.c - compressROM -x on data files that don't compress, run by
+// ctest with the compressROM to test & a scratch folder:
+//
+//   compress_data <compressROM> <scratch folder>
+//
+// Random bytes come out 1 byte in 128 bigger, so a 64kB file is over 64kB
+// compressed. Each is written with -o and unpacked again here the way the
+// firmware streams it, and must come back byte for byte. A file over 64kB is
+// refused
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int testFailed=0;
+#define CHECK(what,cond) do { if(!(cond)) { testFailed++; printf("FAIL %s:%d %s\n",__FILE__,__LINE__,what); } else printf("ok   %s\n",what); } while(0)
+
+static uint8_t data[65536],packed[70000],unpacked[65536];
+const char *tool,*work;
+
+//
+// ---------------------------------------------------------------------------
+// compress - len bytes of data through compressROM -x -o
+// output:
+//   compressROM's exit code, the entry it wrote in packed & its size in size
+// ---------------------------------------------------------------------------
+int compress(uint32_t len,uint32_t *size) {
+    char in[512],out[512],cmd[1600];
+    snprintf(in,sizeof(in),"%s/data.bin",work);
+    snprintf(out,sizeof(out),"%s/entry.bin",work);
+    FILE *fp=fopen(in,"wb");
+    fwrite(data,1,len,fp);
+    fclose(fp);
+    remove(out);
+    snprintf(cmd,sizeof(cmd),"\"%s\" -x -o \"%s\" \"%s\" Data >/dev/null",tool,out,in);
+    int rc=system(cmd);
+    rc=rc>>8&0xff;
+    *size=0;
+    if((fp=fopen(out,"rb"))!=NULL) {
+        *size=fread(packed,1,sizeof(packed),fp);
+        fclose(fp);
+    }
+    return rc;
+}
+//
+// ---------------------------------------------------------------------------
+// same - the entry is a data file that unpacks to len bytes of data
+// ---------------------------------------------------------------------------
+bool same(uint32_t len,uint32_t size) {
+    uint32_t i=0,j=34;
+    if(size<35||packed[0]!=4||memcmp(&packed[2],"Data",5)!=0) return false;
+    while(j<size) {
+        uint8_t c=packed[j++];
+        if(c==128) break;
+        if(c<128) {
+            for(uint k=0;k<c+1u;k++) {
+                if(i>=sizeof(unpacked)||j>=size) return false;
+                unpacked[i++]=packed[j++];
+            }
+        } else {
+            uint8_t o=packed[j++];
+            for(uint k=0;k<c-126u;k++) {
+                if(i>=sizeof(unpacked)||i<o+1u) return false;
+                unpacked[i]=unpacked[i-(o+1)];
+                i++;
+            }
+        }
+    }
+    return j==size&&i==len&&memcmp(unpacked,data,len)==0;
+}
+
+int main(int argc,char *argv[]) {
+    if(argc<3) {
+        printf("usage: compress_data <compressROM> <scratch folder>\n");
+        return 2;
+    }
+    tool=argv[1];
+    work=argv[2];
+    uint32_t size;
+    srand(38);
+    for(uint32_t i=0;i<sizeof(data);i++) data[i]=rand()>>7;
+    CHECK("compress: 64kB of random bytes is a data file",compress(65535,&size)==0);
+    CHECK("compress: over 64kB compressed",size>65535+34);
+    CHECK("compress: it unpacks to the same bytes",same(65535,size));
+    CHECK("compress: 16kB of random bytes",compress(16384,&size)==0&&same(16384,size));
+    CHECK("compress: one byte",compress(1,&size)==0&&same(1,size));
+    memset(data,0x55,sizeof(data));
+    CHECK("compress: 64kB all one value packs small",compress(65535,&size)==0&&size<1100&&same(65535,size));
+    CHECK("compress: over 64kB is refused [E05]",compress(65536,&size)==5&&size==0);
+    return testFailed!=0;
+}
@@ -0,0 +1,33 @@
+// firmware.h - picoif2lite.c built into a host test, its main() renamed so
+// the test has its own. Everything in it can be called & every global read
+#pragma once
+#include <stdio.h>
+#include "hostsdk.h"
+#define main firmwareMain
+#include "picoif2lite.c"
+#undef main
+
+int testFailed=0;
+#define CHECK(what,cond) do { if(!(cond)) { testFailed++; printf("FAIL %s:%d %s\n",__FILE__,__LINE__,what); } else printf("ok   %s\n",what); } while(0)
+
+//
+// ---------------------------------------------------------------------------
+// hostBoot - the start of main() up to the first ROM being loaded, with the
+// globals the firmware has at power on. Used again after a power cut
+// ---------------------------------------------------------------------------
+static void hostBoot() {
+    memcpy(romSelector,romExplorer,16384);
+    romCount=MAXROMS;
+    pack=NULL;
+    storeCount=0;
+    storeSeq=storeId=storeHead=storeUsed=0;
+    memset(&storeNew,0,sizeof(storeNew));
+    flashDetect();
+    packFind();
+    storeScan();
+    for(uint i=0;i<CACHE_SLOTS;i++) cacheRom[i]=-1;
+    settings=(settings_t){SETTINGS_MAGIC,0,0,0,FAST_BOOT_DEFAULT,0};
+    settingsPage=-1;
+    settingsLoad();
+    serving=true;
+}
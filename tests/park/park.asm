@@ -0,0 +1,30 @@
+; park.asm - the sequencer's park sample, park.rom assembled by hand from
+; this (the bytes are on the left). Runs IM1 for 4 seconds in EI HALT with I
+; at 0x3f as the Spectrum's ROM has it, then stops in DI HALT with I at 0 the
+; way a diagnostic ROM stops once it is done. From then on every other read
+; the interface sees is a refresh cycle somewhere in 0x0000-0x007f, 0x0038
+; included, which is what the sequencer's park check has to see past.
+;
+;   compressROM -o park.bin park.rom "Park"
+;   benchROM -p -f 600 park.bin
+;
+; gives "parked at $0015". Everything not listed is 0xff
+
+                      org 0x0000
+0000 f3               di
+0001 318000           ld sp,0x8000
+0004 3e3f             ld a,0x3f
+0006 ed47             ld i,a          ; refresh cycles read 0x3f00-0x3f7f
+0008 ed56             im 1
+000a 06c8             ld b,200        ; 4 seconds of IM1
+000c fb               ei
+000d 76       wait:   halt
+000e 10fd             djnz wait
+0010 f3               di
+0011 af               xor a
+0012 ed47             ld i,a          ; refresh cycles read 0x0000-0x007f
+0014 76       park:   halt            ; done, reads 0x0015 from here on
+
+                      org 0x0038
+0038 fb               ei              ; IM1
+0039 c9               ret
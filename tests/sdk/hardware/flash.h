@@ -0,0 +1,6 @@
+// hardware/flash.h - host stand in, the flash model in hostsdk.c
+#pragma once
+#include "pico/stdlib.h"
+void flash_range_erase(uint32_t offset,size_t count);
+void flash_range_program(uint32_t offset,const uint8_t *data,size_t count);
+void flash_do_cmd(const uint8_t *txbuf,uint8_t *rxbuf,size_t count);
@@ -0,0 +1,16 @@
+// hardware/pio.h - host stand in, the Spectrum's bus is whatever the test
+// feeds through hostBus
+#pragma once
+#include "pico/stdlib.h"
+uint32_t pio_sm_get_blocking(PIO pio,uint sm);
+void pio_sm_put_blocking(PIO pio,uint sm,uint32_t data);
+int pio_claim_unused_sm(PIO pio,bool required);
+uint pio_add_program(PIO pio,const void *program);
+void pio_gpio_init(PIO pio,uint pin);
+void pio_sm_set_consecutive_pindirs(PIO pio,uint sm,uint pin,uint count,bool out);
+void sm_config_set_in_pins(pio_sm_config *c,uint pin);
+void sm_config_set_in_shift(pio_sm_config *c,bool right,bool autopush,uint threshold);
+void sm_config_set_out_pins(pio_sm_config *c,uint pin,uint count);
+void sm_config_set_out_shift(pio_sm_config *c,bool right,bool autopull,uint threshold);
+void pio_sm_init(PIO pio,uint sm,uint offset,const pio_sm_config *c);
+void pio_sm_set_enabled(PIO pio,uint sm,bool enabled);
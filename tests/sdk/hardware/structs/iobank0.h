@@ -0,0 +1,11 @@
+// hardware/structs/iobank0.h - host stand in, only the user button's
+// interrupt registers
+#pragma once
+#include "pico/stdlib.h"
+typedef struct {
+    struct {
+        volatile uint32_t inte[4];
+        volatile uint32_t intf[4];
+    } proc0_irq_ctrl;
+} iobank0_hw_t;
+extern iobank0_hw_t *iobank0_hw;
@@ -0,0 +1,3 @@
+// hardware/sync.h - host stand in, see pico/stdlib.h
+#pragma once
+#include "pico/stdlib.h"
@@ -0,0 +1,145 @@
+// hostsdk.c - the Pico SDK calls picoif2lite.c makes, for running it on the
+// host in the tests. Time only moves when the firmware waits, flash is a
+// model mapped at XIP_BASE so the firmware reads it in place as on the Pico,
+// and the Spectrum's bus is whatever the test feeds through hostBus. The
+// power can be cut part way through a flash write
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/pio.h"
+#include "hardware/flash.h"
+#include "hardware/structs/iobank0.h"
+#include "hostsdk.h"
+#pragma GCC diagnostic ignored "-Wunused-parameter" // most of the SDK does nothing here
+
+uint64_t hostNow=0;                 // time_us_64()
+bool hostButton=false;              // user button held down
+uint32_t (*hostBus)(void)=NULL;     // next address the Spectrum reads, for pio_sm_get_blocking
+uint32_t hostData;                  // last byte served
+uint8_t *hostFlash;                 // flash model, PICO_FLASH_SIZE_BYTES at XIP_BASE
+const uint8_t *hostIn=NULL;         // bytes arriving over USB, for getchar_timeout_us
+uint32_t hostInLen=0,hostInPos=0;
+uint32_t hostFlashWrites=0;         // erases & programs so far
+int32_t hostCutAfter=-1;            // writes to let through before the power is cut, -1 never
+jmp_buf hostCut;                    // where the test picks up after the cut
+static iobank0_hw_t iobank0;
+iobank0_hw_t *iobank0_hw=&iobank0;
+const int picoif2_program=0;
+
+//
+// ---------------------------------------------------------------------------
+// hostFlashMap - put the flash model where XIP maps flash, before main()
+// ---------------------------------------------------------------------------
+__attribute__((constructor)) static void hostFlashMap() {
+    void *at=mmap((void *)XIP_BASE,PICO_FLASH_SIZE_BYTES,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS|MAP_FIXED_NOREPLACE,-1,0);
+    if(at!=(void *)XIP_BASE) {
+        fprintf(stderr,"hostsdk: cannot map the flash model at 0x%08lx\n",XIP_BASE);
+        exit(2);
+    }
+    hostFlash=at;
+    memset(hostFlash,0xff,PICO_FLASH_SIZE_BYTES);
+}
+// time
+uint32_t time_us_32(void) { return (uint32_t)hostNow; }
+uint64_t time_us_64(void) { return hostNow; }
+void busy_wait_us_32(uint32_t us) { hostNow+=us; }
+void sleep_ms(uint32_t ms) { hostNow+=ms*1000ull; }
+void tight_loop_contents(void) { hostNow++; }
+// gpio, only the user button is read
+void gpio_init(uint gpio) {}
+void gpio_set_dir(uint gpio,bool out) {}
+void gpio_put(uint gpio,bool value) {}
+bool gpio_get(uint gpio) { return !hostButton; }
+void gpio_pull_up(uint gpio) {}
+void gpio_xor_mask(uint32_t mask) {}
+void gpio_set_irq_enabled_with_callback(uint gpio,uint32_t events,bool enabled,void (*callback)(uint,uint32_t)) {}
+void hw_set_bits(volatile uint32_t *addr,uint32_t mask) { *addr|=mask; }
+void hw_clear_bits(volatile uint32_t *addr,uint32_t mask) { *addr&=~mask; }
+uint32_t save_and_disable_interrupts(void) { return 0; }
+void restore_interrupts(uint32_t status) {}
+void __dmb(void) {}
+// USB
+int getchar_timeout_us(uint32_t timeout) {
+    if(hostInPos<hostInLen) {
+        hostNow+=10; // about 100kB/s
+        return hostIn[hostInPos++];
+    }
+    hostNow+=timeout;
+    return PICO_ERROR_TIMEOUT;
+}
+bool stdio_init_all(void) { return true; }
+bool stdio_usb_connected(void) { return false; }
+// cores
+void multicore_launch_core1(void (*entry)(void)) {}
+void multicore_lockout_victim_init(void) {}
+void multicore_lockout_start_blocking(void) {}
+void multicore_lockout_end_blocking(void) {}
+// PIO, the Spectrum's reads
+uint32_t pio_sm_get_blocking(PIO pio,uint sm) {
+    if(hostBus==NULL) {
+        fprintf(stderr,"hostsdk: the firmware read the bus with no bus to read\n");
+        exit(2);
+    }
+    hostNow++; // a read every us or so
+    return hostBus();
+}
+void pio_sm_put_blocking(PIO pio,uint sm,uint32_t data) { hostData=data; }
+int pio_claim_unused_sm(PIO pio,bool required) { return 0; }
+uint pio_add_program(PIO pio,const void *program) { return 0; }
+void pio_gpio_init(PIO pio,uint pin) {}
+void pio_sm_set_consecutive_pindirs(PIO pio,uint sm,uint pin,uint count,bool out) {}
+void sm_config_set_in_pins(pio_sm_config *c,uint pin) {}
+void sm_config_set_in_shift(pio_sm_config *c,bool right,bool autopush,uint threshold) {}
+void sm_config_set_out_pins(pio_sm_config *c,uint pin,uint count) {}
+void sm_config_set_out_shift(pio_sm_config *c,bool right,bool autopull,uint threshold) {}
+void pio_sm_init(PIO pio,uint sm,uint offset,const pio_sm_config *c) {}
+void pio_sm_set_enabled(PIO pio,uint sm,bool enabled) {}
+pio_sm_config picoif2_program_get_default_config(uint offset) {
+    pio_sm_config c={0,0,0,0};
+    return c;
+}
+//
+// ---------------------------------------------------------------------------
+// flash - NOR, an erase sets a whole sector to 0xff & programming can only
+// clear bits, so a page programmed twice holds the AND of both. A power cut
+// leaves the write half done, the first half of the sector erased or of the
+// page programmed, then goes back to the test through hostCut
+// ---------------------------------------------------------------------------
+static bool hostPowerCut() {
+    hostFlashWrites++;
+    return hostCutAfter>=0&&hostCutAfter--==0; // -1 again once cut
+}
+void flash_range_erase(uint32_t offset,size_t count) {
+    if(offset%FLASH_SECTOR_SIZE||count%FLASH_SECTOR_SIZE||offset+count>PICO_FLASH_SIZE_BYTES) {
+        fprintf(stderr,"hostsdk: flash erase of %zu bytes at 0x%x isn't whole sectors\n",count,offset);
+        exit(2);
+    }
+    if(hostPowerCut()) {
+        memset(&hostFlash[offset],0xff,count/2);
+        longjmp(hostCut,1);
+    }
+    memset(&hostFlash[offset],0xff,count);
+}
+void flash_range_program(uint32_t offset,const uint8_t *data,size_t count) {
+    if(offset%FLASH_PAGE_SIZE||count%FLASH_PAGE_SIZE||offset+count>PICO_FLASH_SIZE_BYTES) {
+        fprintf(stderr,"hostsdk: flash program of %zu bytes at 0x%x isn't whole pages\n",count,offset);
+        exit(2);
+    }
+    if(hostPowerCut()) {
+        for(size_t i=0;i<count/2;i++) hostFlash[offset+i]&=data[i];
+        longjmp(hostCut,1);
+    }
+    for(size_t i=0;i<count;i++) hostFlash[offset+i]&=data[i];
+}
+void flash_do_cmd(const uint8_t *txbuf,uint8_t *rxbuf,size_t count) {
+    memset(rxbuf,0,count);
+    if(txbuf[0]==0x9f&&count>=4) { // JEDEC ID, capacity as 2^n bytes
+        rxbuf[1]=0xef;
+        rxbuf[2]=0x40;
+        rxbuf[3]=21;
+    }
+}
@@ -0,0 +1,14 @@
+// hostsdk.h - what the tests can see of hostsdk.c
+#pragma once
+#include <setjmp.h>
+#include "pico/stdlib.h"
+extern uint64_t hostNow;            // time_us_64(), only moves when the firmware waits
+extern bool hostButton;             // user button held down
+extern uint32_t (*hostBus)(void);   // next address the Spectrum reads
+extern uint32_t hostData;           // last byte served to it
+extern uint8_t *hostFlash;          // flash model at XIP_BASE
+extern const uint8_t *hostIn;       // bytes arriving over USB, hostInPos of hostInLen read so far
+extern uint32_t hostInLen,hostInPos;
+extern uint32_t hostFlashWrites;    // flash erases & programs so far
+extern int32_t hostCutAfter;        // writes let through before the power is cut part way through one, -1 never
+extern jmp_buf hostCut;             // setjmp() here, longjmp()ed to at the cut
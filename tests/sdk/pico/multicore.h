@@ -0,0 +1,7 @@
+// pico/multicore.h - host stand in, there is only one core in the tests
+#pragma once
+#include "pico/stdlib.h"
+void multicore_launch_core1(void (*entry)(void));
+void multicore_lockout_victim_init(void);
+void multicore_lockout_start_blocking(void);
+void multicore_lockout_end_blocking(void);
@@ -0,0 +1,40 @@
+// pico/stdlib.h - just enough of the Pico SDK to build picoif2lite.c on the
+// host for the tests, implemented in hostsdk.c
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+typedef unsigned int uint;
+typedef struct pio_hw *PIO;
+typedef struct { uint32_t clkdiv,execctrl,shiftctrl,pinctrl; } pio_sm_config;
+#define pio0 ((PIO)0)
+#define PICO_FLASH_SIZE_BYTES (2*1024*1024)
+#define FLASH_SECTOR_SIZE 4096
+#define FLASH_PAGE_SIZE 256
+#define XIP_BASE 0x10000000ul // hostsdk.c maps the flash model here, as on the Pico, pointer sized
+#define PICO_ERROR_TIMEOUT -1
+#define GPIO_OUT 1
+#define GPIO_IN 0
+#define GPIO_IRQ_EDGE_FALL 4
+#define __not_in_flash_func(x) x
+#define __no_inline_not_in_flash_func(x) x
+uint32_t time_us_32(void);
+uint64_t time_us_64(void);
+void busy_wait_us_32(uint32_t us);
+void sleep_ms(uint32_t ms);
+void tight_loop_contents(void);
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio,bool out);
+void gpio_put(uint gpio,bool value);
+bool gpio_get(uint gpio);
+void gpio_pull_up(uint gpio);
+void gpio_xor_mask(uint32_t mask);
+void gpio_set_irq_enabled_with_callback(uint gpio,uint32_t events,bool enabled,void (*callback)(uint,uint32_t));
+int getchar_timeout_us(uint32_t timeout);
+bool stdio_init_all(void);
+bool stdio_usb_connected(void);
+void __dmb(void);
+void hw_set_bits(volatile uint32_t *addr,uint32_t mask);
+void hw_clear_bits(volatile uint32_t *addr,uint32_t mask);
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
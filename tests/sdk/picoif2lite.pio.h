@@ -0,0 +1,6 @@
+// picoif2lite.pio.h - host stand in for the header pico_generate_pio_header
+// makes from picoif2lite.pio
+#pragma once
+#include "hardware/pio.h"
+extern const int picoif2_program;
+pio_sm_config picoif2_program_get_default_config(uint offset);
@@ -0,0 +1,164 @@
+// snapshots_bad.c - Z80toROM on broken snapshots, run by ctest with the
+// Z80toROM to test, the sample snapshots & a scratch folder:
+//
+//   snapshots_bad <Z80toROM> <snapshots folder> <scratch folder>
+//
+// Each sample is cut short or has its header or block lengths spoilt, and
+// must be refused with [E07] (or [E04] for hardware it doesn't do) rather
+// than crash or convert. Then -t is given good & broken snapshots mixed &
+// must time every good one, show each broken one with its error & end [E12]
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int testFailed=0;
+#define CHECK(what,cond) do { if(!(cond)) { testFailed++; printf("FAIL %s:%d %s\n",__FILE__,__LINE__,what); } else printf("ok   %s\n",what); } while(0)
+
+static uint8_t snap[140000];
+static char out[8192];
+const char *tool,*samples,*work;
+
+//
+// ---------------------------------------------------------------------------
+// sample - read one of the sample snapshots into snap
+// output:
+//   its length
+// ---------------------------------------------------------------------------
+uint32_t sample(const char *name) {
+    char in[512];
+    snprintf(in,sizeof(in),"%s/%s",samples,name);
+    FILE *fp=fopen(in,"rb");
+    if(fp==NULL) return 0;
+    uint32_t len=fread(snap,1,sizeof(snap),fp);
+    fclose(fp);
+    return len;
+}
+//
+// ---------------------------------------------------------------------------
+// save - len bytes of snap written to the scratch folder as name
+// ---------------------------------------------------------------------------
+void save(const char *name,uint32_t len) {
+    char path[512];
+    snprintf(path,sizeof(path),"%s/%s",work,name);
+    FILE *fp=fopen(path,"wb");
+    fwrite(snap,1,len,fp);
+    fclose(fp);
+}
+//
+// ---------------------------------------------------------------------------
+// convert - Z80toROM -o on name in the scratch folder
+// output:
+//   Z80toROM's exit code
+// ---------------------------------------------------------------------------
+int convert(const char *name) {
+    char cmd[1600];
+    snprintf(cmd,sizeof(cmd),"cd \"%s\" && \"%s\" -o rom.bin \"%s\" >/dev/null",work,tool,name);
+    int rc=system(cmd);
+    return rc>>8&0xff;
+}
+//
+// ---------------------------------------------------------------------------
+// bench - Z80toROM -t on the names given, what it prints left in out
+// output:
+//   Z80toROM's exit code
+// ---------------------------------------------------------------------------
+int bench(const char *names) {
+    char cmd[1600];
+    snprintf(cmd,sizeof(cmd),"cd \"%s\" && \"%s\" -t %s",work,tool,names);
+    FILE *fp=popen(cmd,"r");
+    if(fp==NULL) return -1;
+    size_t n=fread(out,1,sizeof(out)-1,fp);
+    out[n]=0;
+    int rc=pclose(fp);
+    return rc>>8&0xff;
+}
+//
+// ---------------------------------------------------------------------------
+// row - the line -t printed for name, NULL if there isn't one
+// ---------------------------------------------------------------------------
+const char *row(const char *name) {
+    const char *p=out;
+    size_t n=strlen(name);
+    while((p=strstr(p,name))!=NULL) {
+        if(p>=out+2&&p[-1]==' '&&p[-2]==' '&&p[n]==' ') return p;
+        p+=n;
+    }
+    return NULL;
+}
+//
+// ---------------------------------------------------------------------------
+// refused - the row for name ends with error e
+// ---------------------------------------------------------------------------
+bool refused(const char *name,const char *e) {
+    const char *p=row(name);
+    if(p==NULL) return false;
+    const char *end=strchr(p,'\n');
+    const char *at=strstr(p,e);
+    return at!=NULL&&(end==NULL||at<end);
+}
+
+int main(int argc,char *argv[]) {
+    if(argc<4) {
+        printf("usage: snapshots_bad <Z80toROM> <snapshots folder> <scratch folder>\n");
+        return 2;
+    }
+    tool=argv[1];
+    samples=argv[2];
+    work=argv[3];
+    char cmd[600];
+    snprintf(cmd,sizeof(cmd),"mkdir -p \"%s\"",work);
+    if(system(cmd)!=0) return 2;
+    uint32_t len;
+    // the samples as they are
+    len=sample("v3_48.z80");
+    save("good48.z80",len);
+    CHECK("bad: the v3 48k sample converts",len>0&&convert("good48.z80")==0);
+    // v2/v3 page blocks, the first one starts after the 32 byte header & the additional header
+    uint32_t first=32+snap[30]+snap[31]*256;
+    save("cut.z80",first+100);
+    CHECK("bad: cut off in a page block [E07]",convert("cut.z80")==7);
+    save("short.z80",29);
+    CHECK("bad: shorter than any header [E07]",convert("short.z80")==7);
+    save("pages.z80",first);
+    CHECK("bad: header & no pages [E07]",convert("pages.z80")==7);
+    save("missing.z80",first+3+snap[first]+snap[first+1]*256);
+    CHECK("bad: only the first page [E07]",convert("missing.z80")==7);
+    uint8_t lo=snap[first],hi=snap[first+1];
+    snap[first]=0xf0;
+    snap[first+1]=0xff;
+    save("long.z80",len);
+    CHECK("bad: a block longer than the file [E07]",convert("long.z80")==7);
+    snap[first]=3;
+    snap[first+1]=0;
+    save("overrun.z80",len);
+    CHECK("bad: a block that unpacks past its length [E07]",convert("overrun.z80")==7);
+    snap[first]=lo;
+    snap[first+1]=hi;
+    snap[34]=2;
+    save("samram.z80",len);
+    CHECK("bad: SamRAM hardware [E04]",convert("samram.z80")==4);
+    // SNA
+    len=sample("s48.sna");
+    save("good48.sna",len);
+    CHECK("bad: the 48k SNA sample converts",len>0&&convert("good48.sna")==0);
+    save("cut.sna",len-1);
+    CHECK("bad: SNA a byte short [E07]",convert("cut.sna")==7);
+    memcpy(snap,"MV - ",5);
+    save("mv.sna",len);
+    CHECK("bad: an SNA that is a CPC snapshot [E07]",convert("mv.sna")==7);
+    save("notes.txt",len);
+    CHECK("bad: not a snapshot [E01]",convert("notes.txt")==1);
+    // -t carries on past the broken ones
+    int rc=bench("good48.z80 cut.z80 short.z80 good48.sna missing.z80 samram.z80 notes.txt");
+    CHECK("bench: ends with [E12]",rc==12);
+    CHECK("bench: times the good snapshots",row("good48.z80")!=NULL&&!refused("good48.z80","[E")&&
+        row("good48.sna")!=NULL&&!refused("good48.sna","[E"));
+    CHECK("bench: broken snapshots shown with their error",refused("cut.z80","[E07]")&&
+        refused("short.z80","[E07]")&&refused("missing.z80","[E07]")&&refused("samram.z80","[E04]")&&
+        refused("notes.txt","[E01]"));
+    CHECK("bench: the summary counts them",strstr(out,"2 snapshots")!=NULL&&strstr(out,"5 failed")!=NULL);
+    CHECK("bench: all good is exit code 0",bench("good48.z80 good48.sna")==0&&strstr(out,"0 failed")!=NULL);
+    return testFailed!=0;
+}
@@ -0,0 +1,175 @@
+// snapshots_batch.c - Z80toROM -a on a folder & an @list of the sample
+// snapshots, run by ctest with the Z80toROM to test, the sample snapshots &
+// a scratch folder:
+//
+//   snapshots_batch <Z80toROM> <snapshots folder> <scratch folder>
+//
+// The batch has a broken snapshot in it, which must be reported & end it
+// [E12] with the rest converted. Run again with the same -c cache every ROM
+// comes from the cache as the same header, a changed snapshot is the only
+// one converted again & other options miss the cache. The -r JSON summary
+// must have an entry per snapshot saying which came from the cache
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+
+int testFailed=0;
+#define CHECK(what,cond) do { if(!(cond)) { testFailed++; printf("FAIL %s:%d %s\n",__FILE__,__LINE__,what); } else printf("ok   %s\n",what); } while(0)
+
+static uint8_t snap[140000];
+static char out[16384],json[16384],header[2][200000];
+const char *tool,*samples,*work;
+
+//
+// ---------------------------------------------------------------------------
+// load - a file in the scratch folder into buf, zero terminated
+// output:
+//   its length, 0 if it isn't there
+// ---------------------------------------------------------------------------
+uint32_t load(const char *name,void *buf,uint32_t size) {
+    char path[512];
+    snprintf(path,sizeof(path),"%s/%s",work,name);
+    FILE *fp=fopen(path,"rb");
+    if(fp==NULL) return 0;
+    uint32_t len=fread(buf,1,size-1,fp);
+    fclose(fp);
+    ((char*)buf)[len]=0;
+    return len;
+}
+//
+// ---------------------------------------------------------------------------
+// copy - a sample snapshot into the scratch folder as name, broken by cutting
+// it to len bytes if len isn't 0
+// ---------------------------------------------------------------------------
+void copy(const char *sample,const char *name,uint32_t len) {
+    char path[512];
+    snprintf(path,sizeof(path),"%s/%s",samples,sample);
+    FILE *fp=fopen(path,"rb");
+    uint32_t n=fp!=NULL?fread(snap,1,sizeof(snap),fp):0;
+    if(fp!=NULL) fclose(fp);
+    snprintf(path,sizeof(path),"%s/%s",work,name);
+    fp=fopen(path,"wb");
+    fwrite(snap,1,len&&len<n?len:n,fp);
+    fclose(fp);
+}
+//
+// ---------------------------------------------------------------------------
+// batch - Z80toROM -a on the games folder & list.txt with the options given,
+// what it prints left in out & the JSON summary in json
+// output:
+//   Z80toROM's exit code
+// ---------------------------------------------------------------------------
+int batch(const char *opts) {
+    char cmd[1600];
+    snprintf(cmd,sizeof(cmd),"cd \"%s\" && rm -f summary.json && \"%s\" -a %s -c cache -r summary.json games @list.txt",work,tool,opts);
+    FILE *fp=popen(cmd,"r");
+    if(fp==NULL) return -1;
+    size_t n=fread(out,1,sizeof(out)-1,fp);
+    out[n]=0;
+    int rc=pclose(fp);
+    if(load("summary.json",json,sizeof(json))==0) json[0]=0;
+    return rc>>8&0xff;
+}
+//
+// ---------------------------------------------------------------------------
+// line - the line of text holding name & what, NULL if there isn't one
+// ---------------------------------------------------------------------------
+bool line(const char *text,const char *name,const char *what) {
+    const char *p=text;
+    while((p=strstr(p,name))!=NULL) {
+        const char *start=p,*end=strchr(p,'\n');
+        while(start>text&&start[-1]!='\n') start--;
+        const char *at=strstr(start,what);
+        if(at!=NULL&&(end==NULL||at<end)) return true;
+        p+=strlen(name);
+    }
+    return false;
+}
+//
+// ---------------------------------------------------------------------------
+// count - how many times what is in text
+// ---------------------------------------------------------------------------
+int count(const char *text,const char *what) {
+    int n=0;
+    for(const char *p=text;(p=strstr(p,what))!=NULL;p+=strlen(what)) n++;
+    return n;
+}
+//
+// ---------------------------------------------------------------------------
+// cached - ROMs in the cache folder
+// ---------------------------------------------------------------------------
+int cached(void) {
+    char path[512];
+    snprintf(path,sizeof(path),"%s/cache",work);
+    DIR *dir=opendir(path);
+    if(dir==NULL) return 0;
+    int n=0;
+    struct dirent *ent;
+    while((ent=readdir(dir))!=NULL) n+=strstr(ent->d_name,".rom")!=NULL;
+    closedir(dir);
+    return n;
+}
+
+int main(int argc,char *argv[]) {
+    if(argc<4) {
+        printf("usage: snapshots_batch <Z80toROM> <snapshots folder> <scratch folder>\n");
+        return 2;
+    }
+    tool=argv[1];
+    samples=argv[2];
+    work=argv[3];
+    char cmd[1600];
+    snprintf(cmd,sizeof(cmd),"rm -rf \"%s\" && mkdir -p \"%s/games/more\" \"%s/extra\" \"%s/cache\"",work,work,work,work);
+    if(system(cmd)!=0) return 2;
+    // four in the folder (one below it & one broken), one more from the list
+    copy("v1.z80","games/v1.z80",0);
+    copy("v3_128.z80","games/v3_128.z80",0);
+    copy("s48.sna","games/more/s48.sna",0);
+    copy("v3_48.z80","games/bad.z80",1000);
+    copy("v2_48.z80","extra/v2_48.z80",0);
+    copy("v1.z80","games/notes.txt",0);
+    snprintf(cmd,sizeof(cmd),"%s/list.txt",work);
+    FILE *fp=fopen(cmd,"w");
+    fprintf(fp,"# more snapshots\n\nextra/v2_48.z80\n");
+    fclose(fp);
+    // first run, everything converted
+    CHECK("batch: a broken snapshot ends it [E12]",batch("")==12);
+    CHECK("batch: every snapshot in the folder, below it & in the list",
+        strstr(out,"5 snapshots, 4 converted, 0 from the cache, 1 failed")!=NULL);
+    CHECK("batch: the broken one is reported [E07]",line(out,"games/bad.z80","[E07]"));
+    CHECK("batch: a header next to each good snapshot",load("games/v1.h",header[0],sizeof(header[0]))&&
+        load("games/more/s48.h",header[1],sizeof(header[1]))&&load("extra/v2_48.h",header[1],sizeof(header[1]))&&
+        load("games/v3_128.h",header[0],sizeof(header[0])));
+    CHECK("batch: each good ROM in the cache",cached()==4);
+    CHECK("json: an entry per snapshot",count(json,"\"file\": ")==5);
+    CHECK("json: the broken one has its error",line(json,"\"games/bad.z80\"","\"error\": 7"));
+    CHECK("json: none from the cache",count(json,"\"cached\": false")==4&&count(json,"\"cached\": true")==0);
+    CHECK("json: 128k with its sizes",line(json,"\"games/v3_128.z80\"","\"model\": \"128k\"")&&
+        line(json,"\"games/v3_128.z80\"","\"snapshotBytes\": 34589")&&line(json,"\"games/v3_128.z80\"","\"filledBanks\": ["));
+    CHECK("json: 48k SNA",line(json,"\"games/more/s48.sna\"","\"model\": \"48k\""));
+    // again, everything from the cache & the same
+    CHECK("cache: a second run still ends [E12]",batch("")==12);
+    CHECK("cache: every good ROM from the cache",strstr(out,"5 snapshots, 0 converted, 4 from the cache, 1 failed")!=NULL);
+    CHECK("cache: shown on its line",line(out,"games/v3_128.z80"," cached")&&line(out,"extra/v2_48.z80"," cached"));
+    CHECK("cache: the same header as converting it",load("games/v3_128.h",header[1],sizeof(header[1]))&&
+        strcmp(header[0],header[1])==0);
+    CHECK("json: all from the cache",count(json,"\"cached\": true")==4);
+    // a changed snapshot is converted again, the rest still come from the cache
+    copy("v1.z80","games/v1.z80",0);
+    snap[0]^=0xff;
+    snprintf(cmd,sizeof(cmd),"%s/games/v1.z80",work);
+    fp=fopen(cmd,"r+b");
+    fwrite(snap,1,1,fp);
+    fclose(fp);
+    batch("-j 1");
+    CHECK("cache: only the changed snapshot converted",strstr(out,"5 snapshots, 1 converted, 3 from the cache, 1 failed, 1 jobs")!=NULL&&
+        line(json,"\"games/v1.z80\"","\"cached\": false"));
+    CHECK("cache: kept as well",cached()==5);
+    // other options are other ROMs
+    batch("-l");
+    CHECK("cache: other options miss it",strstr(out,"5 snapshots, 4 converted, 0 from the cache, 1 failed")!=NULL&&cached()==9);
+    return testFailed!=0;
+}
@@ -0,0 +1,53 @@
+; streamdemo.asm - the stream port sample, streamdemo.rom assembled by hand
+; from this (the bytes are on the left). Opens the first data file after it,
+; stripes.scr made with compressROM -x, copies it to the screen 256 bytes at
+; a time as in the README, then waits on IM1 interrupts. Build it with
+;
+;   compressROM -s -o streamdemo.bin streamdemo.rom "Stream demo"
+;   compressROM -x -o stripes.bin stripes.scr "Stripes"
+;   benchROM streamdemo.bin stripes.bin
+;
+; benchROM gives the data file's place after the ROM from the order they are
+; given & reports the stream's bytes/s. Everything not listed is 0xff
+
+                      org 0x0000
+0000 f3               di
+0001 318000           ld sp,0x8000
+0004 c30001           jp start
+
+                      org 0x0038
+0038 fb               ei              ; IM1, nothing to do
+0039 c9               ret
+
+                      org 0x0100
+0100 3aa53e   start:  ld a,(0x3ea5)   ; frame start
+0103 3a5a3e           ld a,(0x3e5a)
+0106 3a043e           ld a,(0x3e04)   ; stream
+0109 3a013e           ld a,(0x3e01)   ; next entry
+010c 3a003e           ld a,(0x3e00)
+010f 3afa3e           ld a,(0x3efa)   ; 0x04^0x01^0x00^0xff
+0112 3a003f   wait:   ld a,(0x3f00)
+0115 b7               or a
+0116 28fa             jr z,wait
+0118 ed4b013f         ld bc,(0x3f01)  ; length, 6912
+011c 110040           ld de,0x4000    ; the screen
+011f 78       page:   ld a,b
+0120 b7               or a
+0121 280d             jr z,last
+0123 c5               push bc
+0124 21003d           ld hl,0x3d00    ; 256 bytes at a time so hl stays in the window
+0127 010001           ld bc,256
+012a edb0             ldir
+012c c1               pop bc
+012d 05               dec b
+012e 18ef             jr page
+0130 79       last:   ld a,c
+0131 b7               or a
+0132 2807             jr z,done
+0134 21003d           ld hl,0x3d00
+0137 0600             ld b,0
+0139 edb0             ldir
+013b ed56     done:   im 1
+013d fb               ei
+013e 76       idle:   halt
+013f 18fd             jr idle
@@ -0,0 +1,76 @@
+// test_cache.c - the SRAM cache of unpacked ROMs behind romLoad(): a ROM
+// switched back to is served from its slot without unpacking it again, the
+// least recently used ROM is the one evicted, a 32kB ROM takes two slots &
+// goes as a whole, and anything bigger is unpacked into bank1 instead
+#include "firmware.h"
+
+static uint8_t expect[49152];
+
+//
+// ---------------------------------------------------------------------------
+// load - romLoad() as romSelect() calls it
+// output:
+//   true if it came from the cache, no unpacking
+// ---------------------------------------------------------------------------
+bool load(uint16_t pos) {
+    uint32_t hits=cacheHits;
+    romLoad(pos);
+    return cacheHits!=hits;
+}
+//
+// ---------------------------------------------------------------------------
+// good - the ROM being served is pos unpacked
+// ---------------------------------------------------------------------------
+bool good(uint16_t pos) {
+    const uint8_t *from=romEntry(pos);
+    uint32_t len=romSize(from);
+    dtoBuffer(expect,from);
+    return romLen==len&&memcmp(romData,expect,len)==0;
+}
+//
+// ---------------------------------------------------------------------------
+// slots - cache slots holding pos
+// ---------------------------------------------------------------------------
+uint slots(uint16_t pos) {
+    uint n=0;
+    for(uint k=0;k<CACHE_SLOTS;k++) n+=cacheRom[k]==pos;
+    return n;
+}
+
+int main() {
+    hostBoot();
+    // a miss unpacks into a slot, going back to it is a hit
+    CHECK("cache: first load of ROM 1 is a miss",!load(1)&&good(1));
+    CHECK("cache: ROM 1 is served from its slot",slots(1)==1&&romData==romCache[0]);
+    CHECK("cache: ROM 2 is a miss",!load(2)&&good(2));
+    CHECK("cache: back to ROM 1 is a hit with nothing unpacked",load(1)&&good(1));
+    // full, the least recently used ROM goes
+    load(3);
+    load(4);
+    load(1);
+    CHECK("cache: ROMs 1-4 fill the cache",slots(1)==1&&slots(2)==1&&slots(3)==1&&slots(4)==1);
+    CHECK("cache: ROM 5 is a miss",!load(5)&&good(5));
+    CHECK("cache: it evicts ROM 2, used longest ago",slots(2)==0&&slots(1)==1&&slots(3)==1&&slots(4)==1);
+    CHECK("cache: ROM 1 is still a hit",load(1)&&good(1));
+    // a 32kB ROM takes two slots next to each other & goes as a whole
+    CHECK("cache: 32kB ROM 7 is a miss",!load(7)&&good(7));
+    uint s=0;
+    while(cacheRom[s]!=7) s++;
+    CHECK("cache: it is in two slots side by side",slots(7)==2&&cacheRom[s+1]==7&&romData==romCache[s]);
+    CHECK("cache: back to ROM 7 is a hit",load(1)&&load(7)&&good(7));
+    load(9);
+    CHECK("cache: a second 32kB ROM evicts the LRU run",slots(7)==2&&slots(9)==2&&slots(1)==0&&good(9));
+    load(7);
+    load(2);
+    load(3);
+    CHECK("cache: a 16kB ROM over half a 32kB one evicts all of it",slots(9)==0&&slots(7)==2);
+    // bigger than two slots, unpacked into bank1 & the cache left alone
+    int32_t was[CACHE_SLOTS];
+    memcpy(was,cacheRom,sizeof(was));
+    CHECK("cache: 48kB ROM 8 goes in bank1",!load(8)&&romData==bank1&&bank1Rom==8&&good(8));
+    CHECK("cache: it leaves the cache as it was",memcmp(was,cacheRom,sizeof(was))==0);
+    CHECK("cache: back to ROM 8 is a hit while bank1 still has it",load(8)&&good(8));
+    // the ROM Explorer is always unpacked
+    CHECK("cache: ROM 0 is the ROM Explorer in place",!load(0)&&romData==romSelector);
+    return testFailed!=0;
+}
@@ -0,0 +1,174 @@
+// test_nav.c - the ROM Explorer's menu served by the Pico: the cursor moved a
+// line & a page at a time & kept on the menu, the page text built from the
+// ROM headers, and the name search narrowing the menu to the ROMs whose names
+// start with it, in name order, checked against every ROM in the catalogue.
+// ROMs from the flash store, which the name order doesn't cover, are found
+// too & listed after the others
+#include "firmware.h"
+
+//
+// ---------------------------------------------------------------------------
+// upper - the start of a ROM name as a search, len characters at most
+// output:
+//   characters in to
+// ---------------------------------------------------------------------------
+uint upper(char *to,const uint8_t *from,uint len) {
+    uint i=0;
+    for(;i<len&&i<32&&from[2+i]!=0;i++) {
+        uint8_t c=from[2+i];
+        to[i]=(c>='a'&&c<='z')?c-32:c;
+    }
+    return i;
+}
+//
+// ---------------------------------------------------------------------------
+// matches - ROMs 1 onwards whose names start with query, one by one
+// ---------------------------------------------------------------------------
+uint matches(const char *query,uint len) {
+    uint n=0;
+    for(uint16_t r=1;r<romCount;r++) n+=nameCmp(romEntry(r),query,len)==0;
+    return n;
+}
+//
+// ---------------------------------------------------------------------------
+// viewGood - the menu is every ROM starting with query in name order, then
+// those from the store in the order they were stored
+// ---------------------------------------------------------------------------
+bool viewGood(const char *query,uint len) {
+    if(viewCount!=matches(query,len)) return false;
+    char was[32];
+    for(uint16_t k=0;k<viewCount;k++) {
+        uint16_t r=viewRom(k);
+        const uint8_t *from=romEntry(r);
+        if(nameCmp(from,query,len)!=0) return false;
+        if(k==0) continue;
+        if(r>=storeBase) {
+            if(r<=viewRom(k-1)&&viewRom(k-1)>=storeBase) return false;
+        } else if(viewRom(k-1)>=storeBase||nameCmp(from,was,upper(was,romEntry(viewRom(k-1)),32))<0) return false;
+    }
+    return true;
+}
+//
+// ---------------------------------------------------------------------------
+// store - a catalogue ROM into the flash store, under another name if given
+// output:
+//   NULL if it went in, otherwise why not
+// ---------------------------------------------------------------------------
+const char *store(uint16_t pos,const char *name) {
+    static uint8_t rom[32768];
+    uint32_t len=lzSkip(romEntry(pos),34),check=0;
+    memcpy(rom,romEntry(pos),len);
+    if(name!=NULL) strncpy((char *)&rom[2],name,32);
+    for(uint32_t i=0;i<len;i++) check+=rom[i];
+    const char *why=storeStart(len,check);
+    if(why!=NULL) return why;
+    for(uint32_t i=0;i<len;i++) storeByte(rom[i]);
+    return storeEnd();
+}
+//
+// ---------------------------------------------------------------------------
+// typed - type a search into the ROM Explorer the way a key press arrives
+// ---------------------------------------------------------------------------
+void typed(const char *query,uint len) {
+    for(uint i=0;i<len;i++) navKey(0x20,query[i]);
+}
+
+int main() {
+    hostBoot();
+    uint8_t *reply=&romSelector[REPLY_WINDOW];
+    uint16_t last=romCount-1;
+    // cursor a line & a page at a time
+    navStart(3);
+    CHECK("nav: start on ROM 3 with the whole catalogue",navPos==3&&viewCount==romCount&&navQueryLen==0);
+    CHECK("nav: reply has the ROM under the cursor",reply[0]==1&&reply[2]==3&&(reply[4]|reply[5]<<8)==3);
+    navKey(0x10,0);
+    navReply();
+    CHECK("nav: down a line",navPos==4&&reply[1]==0&&(reply[4]|reply[5]<<8)==4);
+    navKey(0x08,0);
+    navKey(0x08,0);
+    CHECK("nav: up two lines",navPos==2);
+    navKey(0x02,0);
+    navKey(0x08,0);
+    CHECK("nav: back a page & up stay on the first ROM",navPos==0);
+    navKey(0x04,0);
+    CHECK("nav: forward a page",navPos==(MENU_ROWS>last?last:MENU_ROWS));
+    navKey(0x04,0);
+    navKey(0x10,0);
+    CHECK("nav: forward a page & down stay on the last ROM",navPos==last);
+    navStart(romCount);
+    CHECK("nav: a start past the end is the first ROM",navPos==0);
+    // page text, one line per ROM from its header
+    const uint8_t *t=&romSelector[TEXT_WINDOW];
+    const uint8_t *from=romEntry(0);
+    uint lines=0;
+    bool named=t[0]==30&&memcmp(&t[1],&from[2],strnlen((const char *)&from[2],32))==0;
+    for(const uint8_t *p=t;*p!=0;p++) lines+=*p==30||*p==31;
+    CHECK("nav: the page starts with the first ROM's name",named);
+    CHECK("nav: a line for each ROM on the page",lines==(romCount<MENU_ROWS?romCount:MENU_ROWS));
+    // the search against every ROM, each name typed a character at a time
+    bool good=true,deleted=true,titled=true;
+    for(uint16_t r=1;r<romCount;r++) {
+        char query[MENU_QUERY];
+        uint len=upper(query,romEntry(r),MENU_QUERY);
+        for(uint i=1;i<=len;i++) {
+            typed(&query[i-1],1);
+            good&=navQueryLen==i&&navPos==0&&viewGood(query,i)&&viewCount>0;
+            titled&=memcmp(&romSelector[MENU_TITLE],"Find: ",6)==0&&memcmp(&romSelector[MENU_TITLE+6],query,i)==0;
+        }
+        for(uint i=len;i>0;i--) {
+            navKey(0x20,0x08);
+            deleted&=navQueryLen==i-1&&(i>1?viewGood(query,i-1):viewCount==romCount);
+        }
+    }
+    CHECK("nav: typing each name narrows the menu to the ROMs starting with it",good);
+    CHECK("nav: the title shows the search",titled);
+    CHECK("nav: deleting widens it again, all gone is the whole catalogue",deleted);
+    CHECK("nav: the title is back with no search",memcmp(&romSelector[MENU_TITLE],&romExplorer[MENU_TITLE],31)==0);
+    // lower case is the same search, a character matching nothing is ignored
+    char query[2]={0,0};
+    upper(query,romEntry(1),1);
+    navKey(0x20,query[0]>='A'&&query[0]<='Z'?query[0]+32:query[0]);
+    CHECK("nav: lower case finds the same ROMs",navQueryLen==1&&navQuery[0]==query[0]&&viewGood(query,1));
+    uint16_t count=viewCount;
+    uint8_t none=0;
+    for(uint8_t c='0';c<='Z'&&none==0;c++) {
+        query[1]=c;
+        if(matches(query,2)==0) none=c;
+    }
+    navKey(0x10,0);
+    navKey(0x20,none);
+    CHECK("nav: a character leaving nothing to show is ignored",none!=0&&navQueryLen==1&&viewCount==count);
+    navKey(0x20,0x08);
+    navKey(0x20,0x08);
+    CHECK("nav: delete with no search does nothing",navQueryLen==0&&viewCount==romCount);
+    // starting again forgets the search
+    typed(query,1);
+    navStart(2);
+    CHECK("nav: start forgets the search",navQueryLen==0&&viewCount==romCount&&navPos==2&&viewRom(2)==2);
+    // ROMs from the store, a copy of ROM 2 & one with a name nothing else has
+    CHECK("nav: two ROMs stored",store(2,NULL)==NULL&&store(3,"Quux Stored")==NULL);
+    hostBoot();
+    CHECK("nav: they join the catalogue after the rest",storeCount==2&&romCount==storeBase+2);
+    char find[MENU_QUERY];
+    uint len=upper(find,romEntry(2),MENU_QUERY);
+    navStart(0);
+    typed(find,len);
+    CHECK("nav: the stored copy is found after the ROM it copies",navQueryLen==len&&viewGood(find,len)&&viewRom(viewCount-1)==storeBase);
+    navStart(0);
+    typed("QUUX",4);
+    CHECK("nav: a name only the store has is found",navQueryLen==4&&viewCount==1&&viewRom(0)==storeBase+1);
+    navReply();
+    CHECK("nav: and is on the page",t[0]==31&&memcmp(&t[1],"Quux Stored",11)==0&&reply[4]==(uint8_t)(storeBase+1));
+    good=true;
+    for(uint16_t r=1;r<romCount;r++) {
+        char query[MENU_QUERY];
+        uint len=upper(query,romEntry(r),MENU_QUERY);
+        navStart(0);
+        for(uint i=1;i<=len;i++) {
+            typed(&query[i-1],1);
+            good&=navQueryLen==i&&viewGood(query,i);
+        }
+    }
+    CHECK("nav: typing each name with the store there",good);
+    return testFailed!=0;
+}
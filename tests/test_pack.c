@@ -0,0 +1,107 @@
+// test_pack.c - ROM packs in flash at power on: a good pack's ROMs replace the
+// ones compiled in, one with its index or name order damaged is passed over,
+// a ROM cut short (a pack flashed part way over an old one) shows as damaged
+// while the others still work, & with two packs in flash the newest is used
+// wherever it is
+#include "firmware.h"
+
+#define PACK_AT  0x100000
+#define PACK_LOW 0x80000
+
+void packSeal(pack_t *h);
+
+static const uint16_t some[]={1,2,3,7};
+#define SOME (sizeof(some)/sizeof(some[0]))
+
+//
+// ---------------------------------------------------------------------------
+// packMake - a pack of ROMs compiled in, laid out as packROM lays it out
+// input:
+//   off - flash offset
+//   made - its time stamp
+// output:
+//   bytes in the pack
+// ---------------------------------------------------------------------------
+uint32_t packMake(uint32_t off,uint32_t made) {
+    uint8_t *p=&hostFlash[off];
+    pack_t *h=(pack_t *)p;
+    uint32_t size=(sizeof(pack_t)+SOME*6+3)&~3u,i;
+    uint16_t *order=(uint16_t *)&h->index[SOME];
+    for(i=0;i<SOME;i++) {
+        uint32_t len=lzSkip(roms[some[i]],34);
+        memcpy(&p[size],roms[some[i]],len);
+        h->index[i]=size;
+        order[i]=SOME-i; // any order will do here
+        size=(size+len+3)&~3u;
+    }
+    *h=(pack_t){PACK_MAGIC,PACK_VERSION,SOME,size,made,0};
+    packSeal(h);
+    return size;
+}
+//
+// ---------------------------------------------------------------------------
+// packSeal - the check after the pack has been changed
+// ---------------------------------------------------------------------------
+void packSeal(pack_t *h) {
+    const uint8_t *b=(const uint8_t *)h;
+    uint32_t check=0,i;
+    for(i=0;i<offsetof(pack_t,check);i++) check+=b[i];
+    for(i=0;i<h->count*6u;i++) check+=b[sizeof(pack_t)+i];
+    h->check=check;
+}
+//
+// ---------------------------------------------------------------------------
+// same - catalogue position pos is ROM rom compiled in, header & data
+// ---------------------------------------------------------------------------
+bool same(uint16_t pos,uint16_t rom) {
+    return romEntry(pos)!=packBad&&memcmp(romEntry(pos),roms[rom],lzSkip(roms[rom],34))==0;
+}
+void wipe() {
+    memset(&hostFlash[PACK_LOW],0xff,0x100000);
+}
+
+int main() {
+    hostBoot();
+    CHECK("pack: none in blank flash, the ROMs compiled in",pack==NULL&&romCount==MAXROMS);
+    // a good pack
+    uint32_t size=packMake(PACK_AT,1);
+    hostBoot();
+    CHECK("pack: found & used",pack==(const pack_t *)(XIP_BASE+PACK_AT)&&romCount==SOME+1);
+    CHECK("pack: its ROMs in order",same(1,1)&&same(2,2)&&same(3,3)&&same(4,7));
+    romLoad(4);
+    CHECK("pack: a ROM from it loads",romLen==32768&&cacheMisses>0);
+    // index & name order damaged, checked by the check
+    pack_t *h=(pack_t *)&hostFlash[PACK_AT];
+    h->index[1]+=4;
+    hostBoot();
+    CHECK("pack: a damaged index is passed over",pack==NULL&&romCount==MAXROMS);
+    h->index[1]-=4;
+    ((uint16_t *)&h->index[SOME])[0]=SOME+1;
+    packSeal(h);
+    hostBoot();
+    CHECK("pack: a name order with ROMs not in it is passed over",pack==NULL);
+    wipe();
+    // the last ROM cut short, its end never written
+    size=packMake(PACK_AT,1);
+    memset(&hostFlash[PACK_AT+size-64],0xff,64);
+    hostBoot();
+    CHECK("pack: a ROM cut short at the end is damaged",pack!=NULL&&romEntry(4)==packBad);
+    CHECK("pack: the others still work",same(1,1)&&same(2,2)&&same(3,3));
+    romSelect(4);
+    CHECK("pack: selecting the damaged ROM keeps the last one",rompos!=4);
+    // a ROM in the middle overwritten
+    packMake(PACK_AT,1);
+    memset(&hostFlash[PACK_AT+h->index[2]],0xff,h->index[3]-h->index[2]);
+    hostBoot();
+    CHECK("pack: a ROM in the middle wiped is damaged",romEntry(3)==packBad&&same(2,2)&&same(4,7));
+    wipe();
+    // two packs, the newest wins wherever it is
+    packMake(PACK_AT,1);
+    packMake(PACK_LOW,2);
+    hostBoot();
+    CHECK("pack: the newer pack lower down is used",pack==(const pack_t *)(XIP_BASE+PACK_LOW));
+    packMake(PACK_AT,3);
+    hostBoot();
+    CHECK("pack: the newer pack higher up is used",pack==(const pack_t *)(XIP_BASE+PACK_AT));
+    return testFailed!=0;
+}
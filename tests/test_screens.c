@@ -0,0 +1,226 @@
+// test_screens.c - the screens the Pico makes for the ROM Explorer, from a
+// ROM pack of made up snapshots: a loading screen or menu page shown again is
+// copied from its slot without being made again, two of each are kept with
+// the least recently used one going, the ones borrowed from bank1 are
+// forgotten when a big ROM goes in there, and a big ROM kept in bank1 is
+// forgotten when they are put there
+#include <strings.h>
+#include "firmware.h"
+
+#define PACK_AT 0x100000
+
+void packSeal(pack_t *h);
+
+// made up snapshots, a loading screen of one shade each & the right size
+static const struct {
+    const char *name;
+    uint8_t mode,shade;
+    uint32_t len;
+} snaps[]={
+    {"SNAP A",3,0x11,49152},
+    {"SNAP B",3,0x22,49152},
+    {"SNAP C",3,0x33,49152},
+    {"SNAP D",8,0x44,131072},
+};
+#define SNAPS (sizeof(snaps)/sizeof(snaps[0]))
+#define PLAIN (SNAPS+1) // ROM 1 compiled in, not a snapshot
+#define COUNT (SNAPS+MENU_ROWS+4) // two pages, filled with ROM 1
+
+//
+// ---------------------------------------------------------------------------
+// literal - bytes as simple LZ literal runs
+// output:
+//   end of the output
+// ---------------------------------------------------------------------------
+uint8_t *literal(uint8_t *to,const uint8_t *from,uint32_t len) {
+    while(len>0) {
+        uint32_t n=len<128?len:128;
+        *to++=n-1;
+        memcpy(to,from,n);
+        to+=n;
+        from+=n;
+        len-=n;
+    }
+    return to;
+}
+//
+// ---------------------------------------------------------------------------
+// snapMake - a snapshot as Z80toROM would store it: the loader, then bank 5
+// (the screen) compressed again, then copies up to its size
+// output:
+//   bytes written
+// ---------------------------------------------------------------------------
+uint32_t snapMake(uint8_t *to,uint s) {
+    static uint8_t inner[6912/128*129],zero[SNAP_LOADER];
+    uint8_t screen[6912];
+    uint8_t *t=to+34;
+    memset(to,0,34);
+    to[0]=snaps[s].mode;
+    strcpy((char *)&to[2],snaps[s].name);
+    memset(screen,snaps[s].shade,6912);
+    literal(inner,screen,6912);
+    t=literal(t,zero,SNAP_LOADER);
+    t=literal(t,inner,sizeof(inner));
+    for(uint32_t left=snaps[s].len-SNAP_LOADER-sizeof(inner);left>0;) {
+        uint32_t n=left<129?left:129;
+        if(left-n>0&&left-n<3) n-=3;
+        *t++=n+126;
+        *t++=0;
+        left-=n;
+    }
+    *t++=128;
+    return t-to;
+}
+//
+// ---------------------------------------------------------------------------
+// packMake - the snapshots then ROM 1 over & over as a pack, laid out as
+// packROM lays it out
+// ---------------------------------------------------------------------------
+void packMake() {
+    uint8_t *p=&hostFlash[PACK_AT];
+    pack_t *h=(pack_t *)p;
+    uint32_t count=COUNT,size=(sizeof(pack_t)+count*6+3)&~3u,i;
+    uint16_t *order=(uint16_t *)&h->index[count];
+    for(i=0;i<count;i++) {
+        h->index[i]=size;
+        if(i<SNAPS) size+=snapMake(&p[size],i);
+        else {
+            memcpy(&p[size],roms[1],lzSkip(roms[1],34));
+            size+=lzSkip(roms[1],34);
+        }
+        size=(size+3)&~3u;
+    }
+    for(i=0;i<count;i++) { // name order for the search
+        uint32_t k=i;
+        for(;k>0&&strncasecmp((char *)&p[h->index[order[k-1]-1]+2],(char *)&p[h->index[i]+2],32)>0;k--) order[k]=order[k-1];
+        order[k]=i+1;
+    }
+    *h=(pack_t){PACK_MAGIC,PACK_VERSION,count,size,1,0};
+    packSeal(h);
+}
+void packSeal(pack_t *h) {
+    const uint8_t *b=(const uint8_t *)h;
+    uint32_t check=0,i;
+    for(i=0;i<offsetof(pack_t,check);i++) check+=b[i];
+    for(i=0;i<h->count*6u;i++) check+=b[sizeof(pack_t)+i];
+    h->check=check;
+}
+//
+// ---------------------------------------------------------------------------
+// shows - the screen window is all one shade
+// ---------------------------------------------------------------------------
+bool shows(uint8_t shade) {
+    for(uint i=0;i<6912;i++) if(romSelector[SCREEN_WINDOW+i]!=shade) return false;
+    return true;
+}
+//
+// ---------------------------------------------------------------------------
+// preview - ask for the loading screen of pos as the ROM Explorer does
+// output:
+//   true if it came from the cache, the mark put in its slot is shown
+// ---------------------------------------------------------------------------
+bool preview(uint16_t pos) {
+    for(uint s=0;s<PREVIEW_SLOTS;s++) if(previewRom[s]==pos) previewSlot(s)[0]=0xee;
+    previewReply(pos);
+    bool hit=romSelector[SCREEN_WINDOW]==0xee;
+    for(uint s=0;s<PREVIEW_SLOTS;s++) if(previewRom[s]==pos) previewSlot(s)[0]=snaps[pos-1].shade;
+    romSelector[SCREEN_WINDOW]=snaps[pos-1].shade;
+    return hit;
+}
+//
+// ---------------------------------------------------------------------------
+// kept - slot holding the loading screen of pos, -1 none
+// ---------------------------------------------------------------------------
+int kept(uint16_t pos) {
+    for(uint s=0;s<PREVIEW_SLOTS;s++) if(previewRom[s]==pos) return s;
+    return -1;
+}
+
+//
+// ---------------------------------------------------------------------------
+// page - move the ROM Explorer cursor as a key does & show the page
+// output:
+//   true if it came from the cache, the mark put in its slot is shown
+// ---------------------------------------------------------------------------
+bool page(uint8_t keys) {
+    navKey(keys,0);
+    uint32_t key=(viewEpoch<<16)|(navPos/MENU_ROWS);
+    int s=-1;
+    uint8_t was=0;
+    for(uint k=0;k<MENU_SLOTS;k++) if(menuKey[k]==key) s=k;
+    if(s>=0) {
+        was=menuSlot(s)[0];
+        menuSlot(s)[0]=~was;
+    }
+    navReply();
+    if(s<0) return false;
+    uint8_t mark=~was;
+    bool hit=romSelector[SCREEN_WINDOW]==mark;
+    menuSlot(s)[0]=was;
+    romSelector[SCREEN_WINDOW]=was;
+    return hit;
+}
+//
+// ---------------------------------------------------------------------------
+// pageKept - slot holding the drawn page, -1 none
+// ---------------------------------------------------------------------------
+int pageKept(uint16_t page) {
+    for(uint s=0;s<MENU_SLOTS;s++) if(menuKey[s]==((uint32_t)viewEpoch<<16|page)) return s;
+    return -1;
+}
+
+int main() {
+    packMake();
+    hostBoot();
+    romLoad(0);
+    uint8_t *reply=&romSelector[REPLY_WINDOW];
+    CHECK("screens: the pack of snapshots is used",pack!=NULL&&romCount==COUNT+1&&romSize(romEntry(4))==131072);
+    // a loading screen is decoded once then copied from its slot
+    CHECK("screens: first preview of A is decoded",!preview(1)&&shows(0x11)&&reply[1]==2);
+    CHECK("screens: A again is copied from its slot",preview(1)&&shows(0x11));
+    CHECK("screens: B is decoded",!preview(2)&&shows(0x22));
+    CHECK("screens: A & B are both kept",preview(1)&&preview(2)&&shows(0x22));
+    CHECK("screens: C is decoded",!preview(3)&&shows(0x33));
+    CHECK("screens: it took the slot of A, used longest ago",kept(1)<0&&kept(2)>=0&&kept(3)>=0);
+    previewReply(PLAIN);
+    CHECK("screens: a ROM that isn't a snapshot has no screen",reply[1]==0&&kept(PLAIN)<0);
+    // bank1 lent to the cache while the ROM Explorer is served
+    romLoad(2);
+    romLoad(0);
+    CHECK("screens: a 48kB snapshot in bank1 leaves the borrowed screen",kept(2)>=0&&kept(3)>=0);
+    CHECK("screens: & both are still copied",preview(2)&&preview(3));
+    uint s=kept(3)==0?2:3;
+    romLoad(4);
+    CHECK("screens: a 128kB snapshot in bank1 drops the borrowed screen",kept(s)<0&&kept(s==2?3:2)==0);
+    romLoad(0);
+    CHECK("screens: bank1 still holds it back in the ROM Explorer",bank1Rom==4);
+    CHECK("screens: the screen is decoded again",!preview(s)&&shows(snaps[s-1].shade)&&preview(s));
+    CHECK("screens: into bank1, which forgets the 128kB snapshot",kept(s)>0&&bank1Rom==-1);
+    romLoad(2);
+    romLoad(0);
+    preview(1);
+    preview(3);
+    CHECK("screens: the 48kB snapshot stays in bank1 as screens go in",bank1Rom==2&&kept(1)>=0&&kept(3)>=0);
+    // nothing borrowed while bank1 is serving a ROM
+    romLoad(2);
+    CHECK("screens: with a ROM in bank1 being served only the first slot is used",!preview(4)&&kept(4)==0&&shows(0x44));
+    // menu pages, drawn once & copied after that
+    romLoad(0);
+    navStart(0);
+    CHECK("screens: the first page is drawn",pageKept(0)>=0&&memcmp(&romSelector[SCREEN_WINDOW],menuSlot(pageKept(0)),6912)==0);
+    preview(1);
+    CHECK("screens: drawn again after a preview it is copied",page(0x40));
+    CHECK("screens: the second page is drawn",!page(0x04)&&navPos/MENU_ROWS==1);
+    CHECK("screens: back to the first page is a copy",page(0x02)&&navPos==0);
+    CHECK("screens: & forward to the second",page(0x04)&&pageKept(0)>=0&&pageKept(1)>=0);
+    CHECK("screens: one page is in SRAM, the other in bank1",pageKept(0)+pageKept(1)==1);
+    romLoad(4);
+    romLoad(0);
+    CHECK("screens: a 128kB snapshot in bank1 drops the page there",pageKept(0)+pageKept(1)==-1);
+    CHECK("screens: the page kept in SRAM is still a copy",page(pageKept(0)==0?0x02:0x04)&&bank1Rom==4);
+    CHECK("screens: the other is drawn again into bank1",!page(navPos<MENU_ROWS?0x04:0x02)&&bank1Rom==-1);
+    // a search draws new pages, the old ones aren't shown with the new title
+    navKey(0x20,'S');
+    CHECK("screens: a search draws its page",!page(0x40)&&pageKept(0)>=0);
+    return testFailed!=0;
+}
@@ -0,0 +1,124 @@
+// test_select.c - the ROM Explorer's select command as the firmware sees it
+// on the bus: resetButton() with the button held runs the ROM Explorer,
+// which is fed reads from a script instead of a Spectrum. Checks a frame is
+// picked out from between instruction fetches, from part way through an
+// earlier frame, that a bad checksum never selects anything & that a damaged
+// pack index entry is never served
+#include <setjmp.h>
+#include "firmware.h"
+
+#define TRACE_MAX 4096
+uint32_t trace[TRACE_MAX];
+uint traceLen,tracePos,windowFirst;
+jmp_buf traceEnd;
+
+//
+// ---------------------------------------------------------------------------
+// traceRead - next address of the script, back to the test when it runs out
+// ---------------------------------------------------------------------------
+uint32_t traceRead() {
+    if(tracePos>=traceLen) longjmp(traceEnd,1);
+    if(windowFirst==0&&(trace[tracePos]&0x3f00)==CMD_WINDOW) windowFirst=tracePos+1;
+    return trace[tracePos++];
+}
+void traceAdd(uint32_t a) {
+    if(traceLen<TRACE_MAX) trace[traceLen++]=a;
+}
+//
+// ---------------------------------------------------------------------------
+// traceFrame - a command frame as the ROM Explorer reads it, with fetches
+// from its own code between each window read
+// input:
+//   chk - checksum byte, -1 for the right one
+// ---------------------------------------------------------------------------
+void traceFrame(uint8_t cmd,uint16_t arg,int chk,uint fetches) {
+    uint8_t f[6]={0xa5,0x5a,cmd,arg,arg>>8,cmd^arg^(arg>>8)^0xff};
+    if(chk>=0) f[5]=chk;
+    for(uint k=0;k<6;k++) {
+        for(uint i=0;i<fetches;i++) traceAdd(0x0200+i); // LD A,(nn) & friends outside the window
+        traceAdd(CMD_WINDOW|f[k]);
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// select - the button held for a second then the script, as the ROM
+// Explorer would start after the menu came up
+// output:
+//   rompos afterwards, -1 if the script ran out first
+// ---------------------------------------------------------------------------
+int32_t selectRun() {
+    hostButton=true;
+    hostBus=traceRead;
+    tracePos=windowFirst=0;
+    rompos=0;
+    if(setjmp(traceEnd)) {
+        hostButton=false;
+        buttonBusy=false;
+        return -1;
+    }
+    resetButton(PIN_USER,GPIO_IRQ_EDGE_FALL);
+    hostButton=false;
+    return rompos;
+}
+void traceStart() {
+    traceLen=0;
+    for(uint i=0;i<10;i++) { // the ROM Explorer running, IM1 every frame
+        traceAdd(0x0038);
+        traceAdd(0x0039);
+    }
+}
+
+int main() {
+    hostBoot();
+    uint16_t last=romCount-1;
+    // cmdByte on its own, 16bit argument
+    cmdPos=0;
+    bool got=false;
+    const uint8_t frame[6]={0xa5,0x5a,CMD_SELECT,0x34,0x12,CMD_SELECT^0x34^0x12^0xff};
+    for(uint k=0;k<6;k++) got=cmdByte(frame[k]);
+    CHECK("cmdByte: frame with a 16bit argument",got&&(cmdFrame[3]|cmdFrame[4]<<8)==0x1234);
+    // a frame with fetches between each window read, selected within the frame
+    traceStart();
+    traceFrame(CMD_SELECT,3,-1,4);
+    traceAdd(0x0000); // nothing after, it must have selected on the checksum read
+    CHECK("interleaved: selects ROM 3",selectRun()==3);
+    CHECK("interleaved: selected on the 6th window read",tracePos==traceLen-1);
+    // the Pico joining part way through an earlier frame
+    traceStart();
+    traceAdd(CMD_WINDOW|0x01);
+    traceAdd(CMD_WINDOW|0x07);
+    traceAdd(CMD_WINDOW|0x00);
+    traceAdd(CMD_WINDOW|0xa5); // stray 0xa5 then the real frame starting 0xa5 0x5a
+    traceFrame(CMD_SELECT,last,-1,1);
+    CHECK("mid-frame: selects the last ROM",selectRun()==last);
+    // a bad checksum is never taken, a good frame straight after still is
+    traceStart();
+    for(uint i=0;i<50;i++) traceFrame(CMD_SELECT,2,0x00,2);
+    CHECK("bad checksum: never selects",selectRun()==-1);
+    traceStart();
+    traceFrame(CMD_SELECT,2,0x00,2);
+    traceFrame(CMD_SELECT,5,-1,2);
+    CHECK("bad checksum then good: selects ROM 5",selectRun()==5);
+    // a ROM selector from before the command window, 256 reads from 0x3f80 up
+    traceStart();
+    for(uint i=0;i<256;i++) traceAdd(0x3f80+4);
+    CHECK("old protocol: selects ROM 4",selectRun()==4);
+    // a pack whose index points past its end, selected ROM 1 keeps the last one
+    static uint32_t bad[16];
+    pack_t *p=(pack_t *)bad;
+    *p=(pack_t){PACK_MAGIC,PACK_VERSION,1,sizeof(bad),0,0};
+    p->index[0]=0x100000;
+    const pack_t *was=pack;
+    uint16_t wasCount=romCount,wasStore=storeBase;
+    pack=p;
+    romCount=storeBase=2;
+    settings.rompos=0;
+    CHECK("damaged index: shows as a data entry",romEntry(1)[0]==4&&romEntry(1)[2]=='(');
+    romSelect(1);
+    CHECK("damaged index: select keeps the last ROM",rompos==0);
+    pack=was;
+    romCount=wasCount;
+    storeBase=wasStore;
+    printf("%s\n",testFailed?"FAILED":"passed");
+    return testFailed!=0;
+}
@@ -0,0 +1,69 @@
+// test_seq.c - seqPoll() sampling made up ROM reads. With I below 0x40 every
+// other read is a refresh cycle at I<<8|R, so a ROM parked in DI HALT with I
+// at 0 reads 0x0000-0x007f as much as its HALT & 0x0038 thousands of times a
+// second. It must still end its stage as parked, while EI HALT with IM1 at
+// 50 a second & a tight loop running through a few bytes must not
+#include "firmware.h"
+
+//
+// ---------------------------------------------------------------------------
+// run - ms of the Spectrum with seqPoll() called every ms as the core 1 loop
+// does. The address it samples is one the program reads or, every other
+// time with I below 0x40, a refresh cycle
+// input:
+//   at, loop - the program reads at to at+loop-1
+//   i - the I register
+//   im1 - IM1 interrupts a frame
+// ---------------------------------------------------------------------------
+void run(uint32_t ms,uint16_t at,uint16_t loop,uint8_t i,uint32_t im1) {
+    static uint8_t r=0;
+    static uint32_t n=0;
+    for(uint32_t k=0;k<ms;k++,n++) {
+        hostNow+=1000;
+        fetchCount+=1000;
+        if(i==0) im1Count+=(500+r)/128; // R going round 0x0038 with every 128 refresh cycles
+        if(k%20==0) im1Count+=im1;
+        r=(r+97)&0x7f;
+        lastAddress=i<0x40&&n%2?(uint16_t)(i<<8|r):(uint16_t)(at+n*7%loop);
+        seqPoll();
+        if(seqStages[0].end!=NULL) return;
+    }
+}
+//
+// ---------------------------------------------------------------------------
+// stage - a one stage sequence with no time limit, its ROM lifted from RESET
+// ---------------------------------------------------------------------------
+const seqStage_t *stage() {
+    seqStage_t st={1,0,0,NULL};
+    seqBegin(&st,1,true);
+    seqPoll();
+    launchEpoch++;
+    launchLift=time_us_32();
+    seqPoll();
+    return &seqStages[0];
+}
+
+int main() {
+    hostBoot();
+    // DI HALT with I at 0
+    const seqStage_t *st=stage();
+    run(10000,0x1234,1,0,0);
+    CHECK("seq: DI HALT with refresh cycles parks",st->end!=NULL&&strcmp(st->end,"parked")==0);
+    CHECK("seq: parked within two sample runs",st->ran>0&&st->ran<=2*SEQ_PARK_US/1000+SEQ_SAMPLE_US/1000);
+    // JR $ with I at 0x3f, as the Spectrum's ROM leaves it
+    st=stage();
+    run(10000,0x2000,2,0x3f,0);
+    CHECK("seq: JR $ with refresh cycles parks",st->end!=NULL&&strcmp(st->end,"parked")==0);
+    // EI HALT, IM1 50 a second
+    st=stage();
+    run(10000,0x1234,1,0x3f,1);
+    CHECK("seq: EI HALT with IM1 50 a second doesn't park",st->end==NULL);
+    // a loop through 20 bytes, with & without interrupts
+    st=stage();
+    run(10000,0x0500,20,0,0);
+    CHECK("seq: a tight loop with refresh cycles doesn't park",st->end==NULL);
+    st=stage();
+    run(10000,0x0500,20,0x3f,0);
+    CHECK("seq: a tight loop doesn't park",st->end==NULL);
+    return testFailed!=0;
+}
@@ -0,0 +1,77 @@
+// test_settings.c - the last ROM selected & the boot policy kept in flash:
+// a select from the shell is there after a reboot, selecting it again writes
+// nothing, the records go round the settings sector with the newest always
+// found, a half written page is skipped & a power cut during a save leaves
+// the old settings or the new ones
+#include "firmware.h"
+
+//
+// ---------------------------------------------------------------------------
+// pick - select from the USB shell, resetButton() run as the forced
+// interrupt would run it
+// ---------------------------------------------------------------------------
+void pick(uint16_t pos) {
+    char line[16];
+    snprintf(line,sizeof(line),"select %d",pos);
+    shellRun(line);
+    resetButton(PIN_USER,GPIO_IRQ_EDGE_FALL);
+    shellWait=false; // the first ROM read would report it
+}
+//
+// ---------------------------------------------------------------------------
+// kept - the settings after a reboot are pos with fast boot as given
+// ---------------------------------------------------------------------------
+bool kept(uint16_t pos,bool fastBoot) {
+    hostBoot();
+    return settingsPage>=0&&settings.rompos==pos&&settings.mode==romEntry(pos)[0]&&settings.fastBoot==fastBoot;
+}
+
+int main() {
+    hostBoot();
+    CHECK("settings: none in blank flash, the defaults",settingsPage<0&&settings.rompos==0&&settings.fastBoot==FAST_BOOT_DEFAULT);
+    pick(3);
+    CHECK("settings: ROM 3 selected",rompos==3&&settings.rompos==3);
+    CHECK("settings: ROM 3 is there after a reboot",kept(3,FAST_BOOT_DEFAULT));
+    uint32_t writes=hostFlashWrites;
+    pick(3);
+    CHECK("settings: selecting it again writes nothing",hostFlashWrites==writes);
+    settings.fastBoot=!FAST_BOOT_DEFAULT;
+    settingsSave();
+    CHECK("settings: fast boot toggled is kept with the ROM",kept(3,!FAST_BOOT_DEFAULT));
+    // round the sector a few times, one erase per SETTINGS_PAGES saves
+    uint lost=0;
+    writes=hostFlashWrites;
+    for(uint i=0;i<3*SETTINGS_PAGES;i++) {
+        pick(i%2?1:2);
+        if(!kept(i%2?1:2,!FAST_BOOT_DEFAULT)) lost++;
+    }
+    CHECK("settings: the newest record is found all the way round the sector",lost==0);
+    CHECK("settings: the sector is erased once every 16 saves",hostFlashWrites-writes==3*SETTINGS_PAGES+3);
+    // a record half written by a power cut in the next page
+    uint8_t *next=&hostFlash[settingsOffset+(settingsPage+1)%SETTINGS_PAGES*FLASH_PAGE_SIZE];
+    memset(next,0xff,FLASH_PAGE_SIZE);
+    memcpy(next,&settings,8); // magic & seq, the rest never written
+    hostBoot();
+    CHECK("settings: a torn record is skipped",kept(1,!FAST_BOOT_DEFAULT));
+    pick(4);
+    CHECK("settings: the save after it erases & starts again",settingsPage==0&&kept(4,!FAST_BOOT_DEFAULT));
+    // a power cut part way through each save's first flash write, round the
+    // sector so the erase is cut too
+    uint torn=0;
+    for(uint n=0;n<2*SETTINGS_PAGES;n++) {
+        volatile uint16_t was=settings.rompos,now=was==5?6:5;
+        hostCutAfter=0;
+        if(setjmp(hostCut)==0) {
+            pick(now);
+            torn++; // never got to a flash write
+        }
+        hostCutAfter=-1;
+        buttonBusy=shellWait=false; // the cut was inside resetButton()
+        shellJob=-1;
+        hostBoot();
+        if(settingsPage<0||(settings.rompos!=was&&settings.rompos!=now)) torn++;
+        if(settings.rompos==now&&settings.mode!=romEntry(now)[0]) torn++;
+    }
+    CHECK("settings: a power cut during a save leaves the old or the new settings",torn==0);
+    return testFailed!=0;
+}
@@ -0,0 +1,195 @@
+// test_shell.c - the USB shell through shellPoll as its lines arrive: a
+// select by number, by whole name, by the start of one & in lower case
+// switches ROM through the forced button interrupt & is reported once the
+// Spectrum reads the new ROM, while a bad number, an unknown or ambiguous
+// name & a second select before the first is served are refused without
+// touching the ROM. A listing goes out a ROM per pass and
+// no pass takes more than 256 bytes, so the housekeeping loop keeps going
+#include "firmware.h"
+
+static char said[4096];
+static char *out;
+static size_t outLen;
+static FILE *console;
+
+//
+// ---------------------------------------------------------------------------
+// listen - what the shell prints from now on is kept, not shown
+// ---------------------------------------------------------------------------
+void listen() {
+    fflush(stdout);
+    console=stdout;
+    stdout=open_memstream(&out,&outLen);
+}
+//
+// ---------------------------------------------------------------------------
+// heard - what the shell has printed since listen()
+// ---------------------------------------------------------------------------
+const char *heard() {
+    fclose(stdout);
+    stdout=console;
+    snprintf(said,sizeof(said),"%s",out);
+    free(out);
+    return said;
+}
+//
+// ---------------------------------------------------------------------------
+// type - bytes over USB, shellPoll called until it has read them all & at
+// least once, so "" is a pass of the housekeeping loop with nothing new
+// output:
+//   what the shell printed
+// ---------------------------------------------------------------------------
+const char *type(const char *text) {
+    listen();
+    hostIn=(const uint8_t *)text;
+    hostInLen=strlen(text);
+    hostInPos=0;
+    do shellPoll(); while(hostInPos<hostInLen);
+    return heard();
+}
+const char *shell(const char *line) {
+    static char text[80];
+    snprintf(text,sizeof(text),"%s\r",line);
+    return type(text);
+}
+//
+// ---------------------------------------------------------------------------
+// forced - the shell has forced the user button's interrupt for core 0
+// ---------------------------------------------------------------------------
+bool forced() {
+    return (iobank0_hw->proc0_irq_ctrl.intf[PIN_USER>>3]&(GPIO_IRQ_EDGE_FALL<<(4*(PIN_USER&7))))!=0;
+}
+//
+// ---------------------------------------------------------------------------
+// selects - line switches ROM: the interrupt forced, resetButton() run as
+// core 0 would run it, then the report once the new ROM is read
+// ---------------------------------------------------------------------------
+bool selects(const char *line,uint16_t pos) {
+    shell(line);
+    if(shellJob!=pos||!forced()) return false;
+    resetButton(PIN_USER,GPIO_IRQ_EDGE_FALL);
+    if(rompos!=pos||shellJob>=0||forced()||!shellWait) return false;
+    type(""); // RESET lifted, nothing read yet
+    if(!shellWait) return false;
+    fetchCount++; // the serving loop reading the new ROM
+    type("");
+    return !shellWait&&strstr(said,"after the command")!=NULL;
+}
+//
+// ---------------------------------------------------------------------------
+// refused - line is answered with text & leaves the ROM as it was
+// ---------------------------------------------------------------------------
+bool refused(const char *line,const char *text) {
+    uint16_t was=rompos;
+    shell(line);
+    return strstr(said,text)!=NULL&&shellJob<0&&!forced()&&rompos==was;
+}
+//
+// ---------------------------------------------------------------------------
+// data - a data entry that isn't a sequence, only there to be streamed
+// ---------------------------------------------------------------------------
+bool data(uint16_t pos) {
+    return romEntry(pos)[0]==4&&seqText(pos,NULL,0)==0;
+}
+//
+// ---------------------------------------------------------------------------
+// starting - ROMs that can be selected whose names start with len bytes of
+// pos's, any case
+// ---------------------------------------------------------------------------
+uint starting(uint16_t pos,uint len) {
+    const char *name=(const char *)&romEntry(pos)[2];
+    uint n=0;
+    for(uint16_t i=1;i<romCount;i++) n+=!data(i)&&strncasecmp((const char *)&romEntry(i)[2],name,len)==0;
+    return n;
+}
+
+int main() {
+    hostBoot();
+    char line[64];
+    uint16_t a=0,b=0,other=0;
+    for(uint16_t i=1;i<romCount;i++) {
+        if(data(i)) continue;
+        if(a==0) a=i;
+        else if(b==0&&strcmp((const char *)&romEntry(i)[2],(const char *)&romEntry(a)[2])!=0) b=i;
+    }
+    for(uint16_t i=1;i<romCount&&other==0;i++) {
+        if(!data(i)&&starting(i,1)>1) other=i;
+    }
+    CHECK("shell: the ROMs compiled in have two to select",a&&b&&other);
+    // by number
+    snprintf(line,sizeof(line),"select %d",a);
+    CHECK("select: by number switches & is reported once served",selects(line,a));
+    CHECK("select: it is remembered like the ROM Explorer's",settings.rompos==a&&romLen>0);
+    // by name, whole & in lower case
+    snprintf(line,sizeof(line),"select %.32s",&romEntry(b)[2]);
+    CHECK("select: by its whole name",selects(line,b));
+    for(char *c=&line[7];*c;c++) if(*c>='A'&&*c<='Z') *c+=32;
+    CHECK("select: lower case finds the same ROM",selects(line,b));
+    // by the shortest start of a's name that only it has
+    uint len=1;
+    while(starting(a,len)>1&&romEntry(a)[2+len]!=0) len++;
+    snprintf(line,sizeof(line),"select %.*s",len,&romEntry(a)[2]);
+    CHECK("select: by the start of a name only one ROM has",starting(a,len)==1&&selects(line,a));
+    // refused, the ROM left as it was
+    snprintf(line,sizeof(line),"select %.1s",&romEntry(other)[2]);
+    CHECK("select: the start of more than one name is refused",refused(line,"ROMs start with"));
+    CHECK("select: a name nothing has is refused",refused("select Nothing Has This Name","no ROM called"));
+    snprintf(line,sizeof(line),"select %d",romCount);
+    CHECK("select: a number past the end is refused",refused(line,"no ROM"));
+    CHECK("select: a negative number is refused",refused("select -1","no ROM"));
+    CHECK("select: nothing to select is refused",refused("select","select <number or name>"));
+    // a second select while the first is still waiting to be served
+    snprintf(line,sizeof(line),"select %d",b);
+    shell(line);
+    resetButton(PIN_USER,GPIO_IRQ_EDGE_FALL);
+    snprintf(line,sizeof(line),"select %d",a);
+    CHECK("select: another before the first is served is refused",refused(line,"busy")&&rompos==b);
+    fetchCount++;
+    type("");
+    CHECK("select: then the first is reported",!shellWait&&strstr(said,"after the command"));
+    // a select the Spectrum never reads
+    snprintf(line,sizeof(line),"select %d",a);
+    shell(line);
+    resetButton(PIN_USER,GPIO_IRQ_EDGE_FALL);
+    type("");
+    hostNow+=SHELL_SERVE_US+1;
+    type("");
+    CHECK("select: a ROM never read is reported as such",!shellWait&&strstr(said,"not read since RESET"));
+    // typing, backspace & the echo
+    snprintf(line,sizeof(line),"selecx\bt %d\r",b);
+    type(line);
+    CHECK("shell: backspace edits the line",shellJob==b);
+    resetButton(PIN_USER,GPIO_IRQ_EDGE_FALL);
+    fetchCount++;
+    type("");
+    CHECK("shell: an unknown command is answered",strstr(shell("frobnicate"),"frobnicate? try help")!=NULL);
+    // a listing, one ROM per pass with * on the one being served
+    shell("list");
+    uint passes=0,marked=0;
+    for(;shellListPos>=0&&passes<=romCount;passes++) {
+        type("");
+        char mark[16];
+        snprintf(mark,sizeof(mark),"* %4d",b);
+        marked+=strstr(said,mark)!=NULL;
+    }
+    CHECK("list: a ROM a pass till all are listed",shellListPos<0&&passes==romCount);
+    CHECK("list: the ROM being served is marked",marked==1);
+    // a long line takes several passes, at most 256 bytes each
+    static char flood[1000];
+    memset(flood,'x',sizeof(flood)-1);
+    hostIn=(const uint8_t *)flood;
+    hostInLen=sizeof(flood)-1;
+    hostInPos=0;
+    listen();
+    shellPoll();
+    uint took=hostInPos;
+    while(hostInPos<hostInLen) shellPoll();
+    heard();
+    CHECK("shell: a pass takes at most 256 bytes",took==256);
+    type("\r");
+    char most[SHELL_LINE+1];
+    memset(most,'x',SHELL_LINE);
+    most[SHELL_LINE]=0;
+    CHECK("shell: a line too long is cut short, not overrun",strstr(said,"? try help")&&!strstr(said,most)&&rompos==b);
+    return testFailed!=0;
+}
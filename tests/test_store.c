@@ -0,0 +1,139 @@
+// test_store.c - the flash store through power cuts. Two ROMs are kept while
+// a third is stored & deleted over & over until the head has gone round and
+// storing it again has to move the kept ones out of the oldest sector. That
+// store is then cut off at every flash write in turn: after the reboot the
+// kept ROMs must each be there once & whole, the new one whole or not at all,
+// and the store must still take it
+#include "firmware.h"
+
+static uint8_t saved[PICO_FLASH_SIZE_BYTES];
+
+//
+// ---------------------------------------------------------------------------
+// store - a catalogue ROM into the store as it is stored, header & all
+// output:
+//   NULL if it went in, otherwise why not
+// ---------------------------------------------------------------------------
+const char *store(uint16_t pos) {
+    const uint8_t *rom=romEntry(pos);
+    uint32_t len=lzSkip(rom,34),check=0;
+    for(uint32_t i=0;i<len;i++) check+=rom[i];
+    const char *why=storeStart(len,check);
+    if(why!=NULL) return why;
+    for(uint32_t i=0;i<len;i++) storeByte(rom[i]);
+    return storeEnd();
+}
+//
+// ---------------------------------------------------------------------------
+// copies - entries in the store holding catalogue ROM pos, -1 if one of them
+// isn't the whole ROM
+// ---------------------------------------------------------------------------
+int copies(uint16_t pos) {
+    const uint8_t *rom=romEntry(pos);
+    uint32_t len=lzSkip(rom,34);
+    int n=0;
+    for(uint i=0;i<STORE_MAXROMS;i++) {
+        if(storePage[i]<0) continue;
+        const store_t *h=storeAt(storePage[i]);
+        if(h->size!=len||memcmp(h+1,rom,34)!=0) continue;
+        if(memcmp(h+1,rom,len)!=0) return -1;
+        n++;
+    }
+    return n;
+}
+void send(const uint8_t *data,uint32_t len) {
+    hostIn=data;
+    hostInLen=len;
+    hostInPos=0;
+    while(hostInPos<hostInLen) shellPoll();
+}
+int entries() {
+    int n=0;
+    for(uint i=0;i<STORE_MAXROMS;i++) n+=storePage[i]>=0;
+    return n;
+}
+bool moved(const int32_t *was) {
+    for(uint i=0;i<2;i++) {
+        if(storePage[i]!=was[i]) return true;
+    }
+    return false;
+}
+
+int main() {
+    hostBoot();
+    char del[16];
+    // kept ROMs, then ROM 1 stored & deleted until storing it moves them
+    CHECK("store: first kept ROM",store(5)==NULL);
+    CHECK("store: second kept ROM",store(6)==NULL);
+    hostBoot();
+    CHECK("store: both in the catalogue after a reboot",storeCount==2&&copies(5)==1&&copies(6)==1);
+    uint laps=0;
+    for(;laps<200;laps++) {
+        int32_t was[2]={storePage[0],storePage[1]};
+        memcpy(saved,hostFlash,PICO_FLASH_SIZE_BYTES);
+        if(store(1)!=NULL) break;
+        if(moved(was)) break;
+        hostBoot();
+        snprintf(del,sizeof(del),"store del %d",storeBase+2);
+        shellRun(del);
+        hostBoot();
+    }
+    CHECK("store: storing goes round & moves the kept ROMs on",laps<200&&copies(1)==1&&copies(5)==1&&copies(6)==1);
+    memcpy(hostFlash,saved,PICO_FLASH_SIZE_BYTES);
+    hostBoot();
+    uint32_t writes=hostFlashWrites;
+    store(1);
+    writes=hostFlashWrites-writes;
+    printf("storing ROM 1 with the kept ROMs moved takes %lu flash writes\n",(unsigned long)writes);
+    // the power cut at each write in turn
+    uint lost=0,torn=0,stuck=0,kept=0;
+    for(uint32_t cut=0;cut<writes;cut++) {
+        memcpy(hostFlash,saved,PICO_FLASH_SIZE_BYTES);
+        hostBoot();
+        hostCutAfter=cut;
+        if(setjmp(hostCut)==0) {
+            store(1);
+            hostCutAfter=-1;
+            stuck++; // got to the end without the cut
+            continue;
+        }
+        hostBoot();
+        if(copies(5)!=1||copies(6)!=1) lost++;
+        if(copies(1)<0||copies(1)>1||entries()!=2+copies(1)) torn++;
+        kept+=copies(1)==1;
+        if(copies(1)==0) {
+            if(store(1)!=NULL) stuck++;
+            hostBoot();
+            if(copies(1)!=1||copies(5)!=1||copies(6)!=1||entries()!=3) stuck++;
+        }
+    }
+    printf("cut at each of %lu writes, ROM 1 there after %u of them\n",(unsigned long)writes,kept);
+    CHECK("store: power cuts never lose a kept ROM",lost==0);
+    CHECK("store: power cuts never leave half an entry or a second copy",torn==0);
+    CHECK("store: the store takes the ROM again after a power cut",stuck==0);
+    // a delete cut short is either done or not
+    memcpy(hostFlash,saved,PICO_FLASH_SIZE_BYTES);
+    hostBoot();
+    hostCutAfter=0;
+    if(setjmp(hostCut)==0) {
+        snprintf(del,sizeof(del),"store del %d",storeBase);
+        shellRun(del);
+    }
+    hostCutAfter=-1;
+    hostBoot();
+    CHECK("store: a delete cut short leaves the others alone",copies(5)<=1&&copies(6)==1&&entries()==1+copies(5));
+    // over USB, the ROM a poll behind the command & well after power on
+    memcpy(hostFlash,saved,PICO_FLASH_SIZE_BYTES);
+    hostBoot();
+    hostNow+=10000000;
+    const uint8_t *rom=romEntry(1);
+    uint32_t len=lzSkip(rom,34),check=0;
+    for(uint32_t i=0;i<len;i++) check+=rom[i];
+    char line[48];
+    snprintf(line,sizeof(line),"store lz %lu %lu\r",(unsigned long)len,(unsigned long)check);
+    send((const uint8_t *)line,strlen(line));
+    send(rom,len);
+    hostBoot();
+    CHECK("store: store lz from the shell",copies(1)==1&&entries()==3);
+    return testFailed!=0;
+}
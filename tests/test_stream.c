@@ -0,0 +1,175 @@
+// test_stream.c - the stream port from a ROM pack of made up entries, read
+// through romServe() as the Spectrum would: a data file read faster than core
+// 1 fills the ring gives 0xff & sets the dry flag in the reply, read as it is
+// filled it comes through whole & the flag stays clear. A streamed launch's
+// RAM banks & a tape are in bank1 whole before anything reads them, so they
+// never depend on core 1 keeping up
+#include <setjmp.h>
+#include "firmware.h"
+
+#define PACK_AT 0x100000
+
+void packSeal(pack_t *h);
+
+// entries, each stream some random bytes then copies of them
+static const struct {
+    const char *name;
+    uint8_t mode,flags;
+    uint streams;
+    uint32_t len[4];
+} entries[]={
+    {"Stream ROM",1,FLAG_STREAM,1,{16384}},
+    {"Data file",4,0,1,{8000}},
+    {"Launch",3,FLAG_STREAM|FLAG_LAUNCH,4,{16384,16384,16384,16384}},
+    {"Tape",5,FLAG_LAUNCH,2,{16384,30000}},
+};
+#define ENTRIES (sizeof(entries)/sizeof(entries[0]))
+static uint8_t expect[ENTRIES][65536]; // what each streams, everything after stream 0 for a launch or tape
+static uint8_t got[65536];
+
+//
+// ---------------------------------------------------------------------------
+// streamMake - one simple LZ stream of len bytes, unpacked into out too
+// output:
+//   end of the stream
+// ---------------------------------------------------------------------------
+uint8_t *streamMake(uint8_t *t,uint8_t *out,uint32_t len) {
+    uint32_t i=0;
+    while(i<len) {
+        uint32_t n=len-i<129?len-i:129;
+        if(i<256||n<3||rand()%4==0) {
+            if(n>128) n=128;
+            *t++=n-1;
+            for(uint32_t k=0;k<n;k++,i++) out[i]=*t++=rand();
+        } else {
+            if(len-i-n>0&&len-i-n<3) n-=3;
+            uint8_t o=rand();
+            *t++=n+126;
+            *t++=o;
+            for(uint32_t k=0;k<n;k++,i++) out[i]=out[i-(o+1)];
+        }
+    }
+    *t++=128;
+    return t;
+}
+//
+// ---------------------------------------------------------------------------
+// packMake - the entries as a pack, laid out as packROM lays it out
+// ---------------------------------------------------------------------------
+void packMake() {
+    static uint8_t scrap[16384];
+    uint8_t *p=&hostFlash[PACK_AT];
+    pack_t *h=(pack_t *)p;
+    uint32_t size=(sizeof(pack_t)+ENTRIES*6+3)&~3u,i;
+    uint16_t *order=(uint16_t *)&h->index[ENTRIES];
+    srand(39);
+    for(i=0;i<ENTRIES;i++) {
+        uint8_t *t=&p[size];
+        h->index[i]=size;
+        order[i]=i+1; // already in name order
+        memset(t,0,34);
+        t[0]=entries[i].mode;
+        t[1]=entries[i].flags;
+        strcpy((char *)&t[2],entries[i].name);
+        t+=34;
+        uint32_t at=0;
+        for(uint k=0;k<entries[i].streams;k++) {
+            bool rom=k==0&&entries[i].streams>1; // loader or tape ROM, served not streamed
+            t=streamMake(t,rom?scrap:&expect[i][at],entries[i].len[k]);
+            if(!rom) at+=entries[i].len[k];
+        }
+        size=(t-p+3)&~3u;
+    }
+    *h=(pack_t){PACK_MAGIC,PACK_VERSION,ENTRIES,size,1,0};
+    packSeal(h);
+}
+void packSeal(pack_t *h) {
+    const uint8_t *b=(const uint8_t *)h;
+    uint32_t check=0,i;
+    for(i=0;i<offsetof(pack_t,check);i++) check+=b[i];
+    for(i=0;i<h->count*6u;i++) check+=b[sizeof(pack_t)+i];
+    h->check=check;
+}
+
+uint32_t busPos,busLen;
+jmp_buf busEnd;
+//
+// ---------------------------------------------------------------------------
+// busRead - the Spectrum reading the stream window, each byte served is kept
+// ---------------------------------------------------------------------------
+uint32_t busRead() {
+    if(busPos>0) got[busPos-1]=hostData;
+    if(busPos==busLen) longjmp(busEnd,1);
+    return STREAM_WINDOW|(busPos++&0xff);
+}
+//
+// ---------------------------------------------------------------------------
+// read - len bytes of the stream through romServe() into got
+// ---------------------------------------------------------------------------
+void portRead(uint32_t len) {
+    busPos=0;
+    busLen=len;
+    hostBus=busRead;
+    if(setjmp(busEnd)==0) romServe();
+    hostBus=NULL;
+}
+//
+// ---------------------------------------------------------------------------
+// replyLen - stream length in the reply window
+// ---------------------------------------------------------------------------
+uint32_t replyLen() {
+    const uint8_t *reply=&romData[REPLY_WINDOW];
+    return reply[1]|reply[2]<<8|reply[3]<<16|(uint32_t)reply[4]<<24;
+}
+bool all(const uint8_t *from,uint8_t v,uint32_t len) {
+    for(uint32_t i=0;i<len;i++) if(from[i]!=v) return false;
+    return true;
+}
+
+int main() {
+    packMake();
+    hostBoot();
+    CHECK("stream: the pack is used",pack!=NULL&&romCount==ENTRIES+1);
+    uint8_t *dry=&romData[REPLY_WINDOW+5];
+    // a data file read faster than the ring is filled
+    romSelect(1);
+    dry=&romData[REPLY_WINDOW+5];
+    CHECK("stream: the stream port ROM is served",rompos==1&&romStream&&streamWindow==STREAM_WINDOW);
+    streamOpen(2);
+    CHECK("data: open replies with its length & the ring full",romData[REPLY_WINDOW]==1&&replyLen()==8000&&streamHead-streamTail==STREAM_RING&&*dry==0);
+    portRead(3000);
+    CHECK("data: the ring comes through",memcmp(got,expect[1],STREAM_RING)==0);
+    CHECK("data: then 0xff as it has run dry",all(&got[STREAM_RING],0xff,3000-STREAM_RING));
+    CHECK("data: which the ROM can see in the reply",*dry==1);
+    // read as core 1 fills it
+    streamOpen(2);
+    CHECK("data: opening it again clears the flag",*dry==0);
+    bool whole=true;
+    for(uint32_t at=0;at<8000;at+=250) {
+        portRead(250);
+        whole&=memcmp(got,&expect[1][at],250)==0;
+        streamFill();
+    }
+    CHECK("data: read as it is filled it comes through whole",whole&&*dry==0);
+    portRead(10);
+    CHECK("data: after the end 0xff without the flag",all(got,0xff,10)&&*dry==0);
+    // a streamed launch, every RAM bank unpacked before the reply
+    romSelect(3);
+    dry=&romData[REPLY_WINDOW+5];
+    streamOpen(3);
+    CHECK("launch: the RAM banks are in bank1 before the reply",streamBuf==bank1&&streamLeft==0&&streamHead-streamTail==49152&&replyLen()==49152);
+    portRead(49152);
+    CHECK("launch: all read with nothing more unpacked",memcmp(got,expect[2],49152)==0&&*dry==0);
+    // a tape, all of it & the start again fill bank1 at RESET. Core 1 has
+    // already dropped the launch's stream, romLoad() waits on it for that
+    streamLeft=0;
+    streamBuf=streamRing;
+    streamMask=STREAM_RING-1;
+    romSelect(4);
+    streamOpen(4);
+    bool tape=true;
+    for(uint32_t i=0;i<sizeof(bank1);i++) tape&=streamBuf[(streamTail+i)&streamMask]==expect[3][i%(30000)];
+    CHECK("tape: bank1 full before LD-BYTES opens the window",streamBuf==bank1&&streamHead-streamTail==sizeof(bank1));
+    CHECK("tape: the whole tape then its start again",tape);
+    return testFailed!=0;
+}
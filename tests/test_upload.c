@@ -0,0 +1,102 @@
+// test_upload.c - ROMs sent over USB through shellPoll as they would arrive:
+// good raw & lz uploads, then a bad checksum, a stream that stops part way,
+// bytes after the end marker & no free end of the cache, none of which may
+// leave slots held for an upload that isn't coming. A 32kB ROM being served
+// always leaves an end free
+#include "firmware.h"
+
+static uint8_t image[32768];
+static uint8_t packed[32768];
+
+//
+// ---------------------------------------------------------------------------
+// send - bytes over USB, shellPoll called until it has read them all
+// ---------------------------------------------------------------------------
+void send(const uint8_t *data,uint32_t len) {
+    hostIn=data;
+    hostInLen=len;
+    hostInPos=0;
+    while(hostInPos<hostInLen) shellPoll();
+}
+void sendLine(const char *line) {
+    static char text[80];
+    snprintf(text,sizeof(text),"%s\r",line);
+    send((const uint8_t *)text,strlen(text));
+}
+uint32_t sum(const uint8_t *data,uint32_t len) {
+    uint32_t s=0;
+    for(uint32_t i=0;i<len;i++) s+=data[i];
+    return s;
+}
+uint busy() {
+    uint n=0;
+    for(uint k=0;k<CACHE_SLOTS;k++) n+=cacheRom[k]==UPLOAD_BUSY;
+    return n;
+}
+void sendRom(bool lz,const uint8_t *data,uint32_t len,uint32_t check) {
+    char line[64];
+    snprintf(line,sizeof(line),"upload %s %lu %lu",lz?"lz":"raw",(unsigned long)len,(unsigned long)check);
+    sendLine(line);
+    send(data,len);
+}
+
+int main() {
+    hostBoot();
+    char line[64];
+    // raw 16kB image
+    for(uint i=0;i<16384;i++) image[i]=i*7+(i>>8);
+    sendRom(false,image,16384,sum(image,16384));
+    CHECK("upload: raw 16kB image waits for the next reset",uploadSwap&&upload.size==0&&busy()==1);
+    CHECK("upload: raw 16kB image is in the cache as sent",upload.out==16384&&memcmp(upload.to,image,16384)==0);
+    // ROM 1 from the catalogue as it is stored, unpacked as it arrives
+    romLoad(1);
+    uint32_t romBytes=romLen;
+    memcpy(image,romData,romBytes);
+    const uint8_t *rom=romEntry(1);
+    uint32_t len=lzSkip(rom,34);
+    memcpy(packed,rom,len);
+    sendRom(true,packed,len,sum(packed,len));
+    CHECK("upload: lz ROM waits for the next reset",uploadSwap&&upload.size==0&&busy()>=1);
+    CHECK("upload: lz ROM unpacks to the catalogue's copy",upload.out==romBytes&&memcmp(upload.to,image,romBytes)==0);
+    // bad checksum
+    sendRom(true,packed,len,sum(packed,len)+1);
+    CHECK("upload: bad checksum is refused",!uploadSwap&&upload.size==0);
+    CHECK("upload: bad checksum frees its slots",busy()==0);
+    // stops part way, given up after UPLOAD_IDLE_US
+    snprintf(line,sizeof(line),"upload lz %lu %lu",(unsigned long)len,(unsigned long)sum(packed,len));
+    sendLine(line);
+    send(packed,len/2);
+    CHECK("upload: truncated stream still waiting for the rest",upload.size==len&&busy()>0);
+    hostNow+=UPLOAD_IDLE_US+1000;
+    shellPoll();
+    CHECK("upload: truncated stream given up",!uploadSwap&&upload.size==0&&busy()==0);
+    // the declared size runs on past the end marker
+    memcpy(&packed[len],"\x00\x41\x42",3);
+    sendRom(true,packed,len+3,sum(packed,len+3));
+    CHECK("upload: bytes after the end marker are refused",!uploadSwap&&upload.size==0&&busy()==0);
+    // the shell is back reading commands after each of them
+    sendRom(false,image,16384,sum(image,16384));
+    CHECK("upload: shell takes the next upload after the bad ones",uploadSwap&&busy()==1);
+    // ROM being served across the middle of the cache, neither end free for 32kB
+    romData=romCache[1];
+    romLen=(CACHE_SLOTS-2)*16384;
+    sendLine("upload raw 32768 0");
+    CHECK("upload: no free end of the cache is refused",upload.size==0&&busy()==0);
+    uint8_t rest[256]={0};
+    send(rest,sizeof(rest)); // a ROM sent anyway is only line noise to the shell
+    CHECK("upload: nothing taken from a refused upload",upload.size==0&&busy()==0);
+    // a 32kB ROM loaded while the ROMs either side of it were used more
+    // recently still leaves one end of the cache free
+    for(uint k=0;k<CACHE_SLOTS;k++) {
+        cacheRom[k]=-1;
+        cacheUsed[k]=0;
+    }
+    for(uint16_t pos=1;pos<=4;pos++) romLoad(pos); // a slot each in order
+    romLoad(1);
+    romLoad(4);
+    romLoad(7);
+    CHECK("upload: a 32kB ROM is cached at one end",romLen==32768&&(romData==romCache[0]||romData==romCache[CACHE_SLOTS-2]));
+    sendRom(true,packed,len,sum(packed,len));
+    CHECK("upload: an lz upload takes the other end",uploadSwap&&busy()>=1);
+    return testFailed!=0;
+}
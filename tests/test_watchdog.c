@@ -0,0 +1,82 @@
+// test_watchdog.c - watchdog() driven with made up ROM read counts: a launch
+// that never reads the ROM is reset, so is a snapshot loader that doesn't
+// finish until the watchdog gives up on it, a game that goes from IM1 to IM2
+// with its vectors in RAM & a ROM that turns interrupts off are left alone,
+// refresh cycles at 0x0038 aren't taken for IM1 & wd off leaves a dead
+// launch alone
+#include "firmware.h"
+
+//
+// ---------------------------------------------------------------------------
+// run - calls watchdog() every ms as the core 1 loop does, with the reads &
+// IM1 interrupts the Spectrum makes each ms
+// ---------------------------------------------------------------------------
+void run(uint32_t ms,uint32_t reads,uint32_t im1) {
+    for(uint32_t i=0;i<ms;i++) {
+        hostNow+=1000;
+        fetchCount+=reads;
+        if(i%20==0) im1Count+=im1;
+        watchdog();
+    }
+}
+void launch() {
+    romLoad(rompos);
+    launchDone=true;
+    launchLift=time_us_32();
+    launchEpoch++;
+    watchdog();
+}
+
+int main() {
+    hostBoot();
+    rompos=1;
+    // nothing read after the launch
+    launch();
+    uint32_t was=wdRecoveries;
+    run(1500,0,0);
+    CHECK("watchdog: a launch with no ROM reads is reset",wdRecoveries==was+1);
+    // the relaunch works, IM1 at 50 a second
+    run(2000,200,1);
+    CHECK("watchdog: the relaunch is reported running again",wdRecoverUs!=0);
+    // a game that switches to IM2 & runs from RAM
+    launch();
+    was=wdRecoveries;
+    run(3000,200,1);
+    run(10000,0,0);
+    CHECK("watchdog: a game that leaves IM1 for IM2 in RAM isn't reset",wdRecoveries==was);
+    // a ROM that runs with IM1 then turns interrupts off, still reading the ROM
+    launch();
+    run(3000,200,1);
+    run(10000,200,0);
+    CHECK("watchdog: a ROM that goes on with interrupts off isn't reset",wdRecoveries==was);
+    // a snapshot loader that never switches the interface off, reset until it is given up on
+    launch();
+    romMode=3;
+    launchDone=false;
+    run(WD_LOAD_US/1000+100,200,0);
+    CHECK("watchdog: a snapshot loader that doesn't finish is reset",wdRecoveries==was+1&&!wdGaveUp);
+    run(WD_RETRIES*(WD_LOAD_US/1000+1000),200,0);
+    CHECK("watchdog: it gives up after WD_RETRIES resets",wdGaveUp&&wdRecoveries==was+WD_RETRIES);
+    was=wdRecoveries;
+    run(10000,200,0);
+    CHECK("watchdog: and leaves it alone after that",wdRecoveries==was);
+    launchDone=true;
+    // refresh cycles with I=0 read 0x0038 thousands of times a second
+    launch();
+    run(1500,0,0);
+    was=wdRecoveries;
+    wdRecoverUs=0;
+    run(3000,200,70);
+    CHECK("watchdog: refresh cycles at 0x0038 aren't a working relaunch",wdRecoverUs==0);
+    // switched off from the shell
+    char off[]="wd off",on[]="wd on";
+    shellRun(off);
+    CHECK("watchdog: wd off",!wdEnabled);
+    launch();
+    was=wdRecoveries;
+    run(5000,0,0);
+    CHECK("watchdog: wd off leaves a dead launch alone",wdRecoveries==was);
+    shellRun(on);
+    CHECK("watchdog: wd on",wdEnabled);
+    return testFailed!=0;
+}
@@ -0,0 +1,102 @@
+# verify_catalog.cmake - run by ctest, builds a catalog of the samples with
+# romcatalog.cmake & checks the ROMs linked in against ROMs converted here
+#
+#   cmake -DCOMPRESSROM=<tool> -DZ80TOROM=<tool> -DHOST_CC=<compiler>
+#         -DPICOIF2_DIR=<repo> -DWORK=<scratch folder> -P verify_catalog.cmake
+#
+# The manifest has a line of each kind, names & options given or not, and a
+# ROM in a folder below it. Changing one ROM must only reconvert that ROM and
+# relink, not recompile, and a manifest naming a missing file must stop CMake.
+file(REMOVE_RECURSE ${WORK})
+file(MAKE_DIRECTORY ${WORK}/roms/sub ${WORK}/expect)
+set(TESTS ${PICOIF2_DIR}/tests)
+configure_file(${PICOIF2_DIR}/rominc/romexplorer.h ${WORK}/roms/romexplorer.h COPYONLY)
+configure_file(${TESTS}/park/park.rom ${WORK}/roms/park.rom COPYONLY)
+configure_file(${TESTS}/stream/streamdemo.rom ${WORK}/roms/sub/streamdemo.rom COPYONLY)
+configure_file(${TESTS}/snapshots/v3_128.z80 ${WORK}/roms/v3_128.z80 COPYONLY)
+configure_file(${TESTS}/snapshots/s48.sna ${WORK}/roms/s48.sna COPYONLY)
+file(WRITE ${WORK}/roms/seq.txt "seq\n# the park sample then the stream port one\n1 park.rom\n2 streamdemo.rom\n")
+file(WRITE ${WORK}/roms/catalog.txt
+"# test catalog\n\
+romexplorer.h\n\
+\n\
+park.rom | Park\n\
+sub/streamdemo.rom | Stream demo | -s\n\
+v3_128.z80 | | -l\n\
+s48.sna\n\
+seq.txt | Sequence\n")
+
+# expect(n tool args...) - ROM n converted here as the manifest says it should be
+function(expect n)
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE rc OUTPUT_QUIET WORKING_DIRECTORY ${WORK}/expect)
+    list(GET ARGN 0 tool)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "${tool} for ROM ${n} failed [E${rc}]")
+    endif()
+endfunction()
+expect(1 ${COMPRESSROM} -o ${WORK}/expect/rom_1.bin ${WORK}/roms/park.rom Park)
+expect(2 ${COMPRESSROM} -s -o ${WORK}/expect/rom_2.bin ${WORK}/roms/sub/streamdemo.rom "Stream demo")
+expect(3 ${Z80TOROM} -l -o ${WORK}/expect/rom_3.bin ${WORK}/roms/v3_128.z80 v3_128)
+expect(4 ${Z80TOROM} -o ${WORK}/expect/rom_4.bin ${WORK}/roms/s48.sna s48)
+expect(5 ${COMPRESSROM} -x -o ${WORK}/expect/rom_5.bin ${WORK}/roms/seq.txt Sequence)
+set(expected ${WORK}/expect/rom_1.bin ${WORK}/expect/rom_2.bin ${WORK}/expect/rom_3.bin
+    ${WORK}/expect/rom_4.bin ${WORK}/expect/rom_5.bin)
+
+# build(dir what) - build the catalog in dir, what it printed left in out
+function(build dir what)
+    execute_process(COMMAND ${CMAKE_COMMAND} --build ${dir}
+        RESULT_VARIABLE rc OUTPUT_VARIABLE output ERROR_VARIABLE output)
+    if(NOT rc EQUAL 0)
+        message("${output}")
+        message(FATAL_ERROR "${what}: the catalog build failed")
+    endif()
+    set(out "${output}" PARENT_SCOPE)
+endfunction()
+# check(what) - catalog_check against the ROMs converted here
+function(check what)
+    execute_process(COMMAND ${WORK}/build/catalog_check ${expected} RESULT_VARIABLE rc OUTPUT_VARIABLE output)
+    message("${output}")
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "${what}: the ROMs linked in differ from the ROMs converted")
+    endif()
+endfunction()
+
+execute_process(COMMAND ${CMAKE_COMMAND} -S ${TESTS}/catalog -B ${WORK}/build -DCMAKE_C_COMPILER=${HOST_CC}
+        -DCMAKE_ASM_COMPILER=${HOST_CC} -DPICOIF2_DIR=${PICOIF2_DIR} -DMANIFEST=${WORK}/roms/catalog.txt
+    RESULT_VARIABLE rc OUTPUT_VARIABLE out ERROR_VARIABLE out)
+if(NOT rc EQUAL 0)
+    message("${out}")
+    message(FATAL_ERROR "the catalog didn't configure")
+endif()
+if(NOT out MATCHES "ROM catalog: 6 ROMs")
+    message(FATAL_ERROR "the catalog should have 6 ROMs")
+endif()
+build(${WORK}/build "first build")
+check("first build")
+
+# another snapshot in place of s48.sna, only ROM 4 is converted again
+configure_file(${TESTS}/snapshots/s128.sna ${WORK}/roms/s48.sna COPYONLY)
+execute_process(COMMAND ${CMAKE_COMMAND} -E touch ${WORK}/roms/s48.sna)
+expect(4 ${Z80TOROM} -o ${WORK}/expect/rom_4.bin ${WORK}/roms/s48.sna s48)
+build(${WORK}/build "changed ROM")
+string(REGEX MATCHALL "rom_[0-9]+\\.bin" made "${out}")
+list(REMOVE_DUPLICATES made)
+if(NOT made STREQUAL "rom_4.bin")
+    message("${out}")
+    message(FATAL_ERROR "changing s48.sna should only convert rom_4.bin again, not ${made}")
+endif()
+if(out MATCHES "catalog_check\\.c")
+    message("${out}")
+    message(FATAL_ERROR "changing a ROM recompiled the code using the catalog")
+endif()
+check("changed ROM")
+
+# a manifest with a file that isn't there
+file(WRITE ${WORK}/roms/missing.txt "romexplorer.h\nnot_here.rom\n")
+execute_process(COMMAND ${CMAKE_COMMAND} -S ${TESTS}/catalog -B ${WORK}/missing -DCMAKE_C_COMPILER=${HOST_CC}
+        -DCMAKE_ASM_COMPILER=${HOST_CC} -DPICOIF2_DIR=${PICOIF2_DIR} -DMANIFEST=${WORK}/roms/missing.txt
+    RESULT_VARIABLE rc OUTPUT_VARIABLE out ERROR_VARIABLE out)
+if(rc EQUAL 0 OR NOT out MATCHES "not_here.rom not found")
+    message("${out}")
+    message(FATAL_ERROR "a manifest naming a missing ROM should stop CMake")
+endif()
@@ -0,0 +1,28 @@
+# verify_snapshots.cmake - run by ctest, converts every snapshot in a folder
+# with Z80toROM & checks the headers made with benchROM -v
+#
+#   cmake -DZ80TOROM=<tool> -DBENCHROM=<tool> -DOPTIONS=<Z80toROM options>
+#         -DSNAPSHOTS=<folder> -DWORK=<scratch folder> -P verify_snapshots.cmake
+#
+# The snapshots are copied to WORK first as Z80toROM leaves each header next
+# to its snapshot, which is where benchROM -v looks for it.
+file(REMOVE_RECURSE ${WORK})
+file(MAKE_DIRECTORY ${WORK})
+separate_arguments(opts UNIX_COMMAND "${OPTIONS}")
+file(GLOB snaps RELATIVE ${SNAPSHOTS} ${SNAPSHOTS}/*.z80 ${SNAPSHOTS}/*.sna)
+list(SORT snaps)
+if(NOT snaps)
+    message(FATAL_ERROR "no snapshots in ${SNAPSHOTS}")
+endif()
+foreach(snap IN LISTS snaps)
+    configure_file(${SNAPSHOTS}/${snap} ${WORK}/${snap} COPYONLY)
+    execute_process(COMMAND ${Z80TOROM} ${opts} ${snap}
+        WORKING_DIRECTORY ${WORK} RESULT_VARIABLE rc OUTPUT_QUIET)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "Z80toROM ${OPTIONS} ${snap} failed [E${rc}]")
+    endif()
+endforeach()
+execute_process(COMMAND ${BENCHROM} -v ${snaps} WORKING_DIRECTORY ${WORK} RESULT_VARIABLE rc)
+if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "benchROM -v: converted snapshots differ from the snapshots")
+endif()
@@ -18,13 +18,32 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#define VERSION_NUM "v1.3"
+#include <time.h>
+#include <setjmp.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
+#endif
+#define VERSION_NUM "v1.11"
 #define PROGNAME "Z80toROM"
 
 //v1.0 initial release
 //v1.1 attempt to fix issue with earlier Spectrums
 //v1.2 refactoring, bug fix on loader introduced in v1.1, handle pc in stack, stack in screen & ability to force final loader to screen
 //v1.3 changed output header format and routine to create names from filename to match compressrom
+//v1.4 128k snapshots compressed bank by bank so the interface can unpack them lazily
+//v1.5 -l streamed launch, RAM banks unpacked by the interface & copied by the loader through its stream port
+//v1.6 snapshot read in one go & parsed from memory with bounds checks, -t to time a set of snapshots
+//v1.7 -a batch conversion of folders & lists in parallel, -c cache of converted ROMs, -r JSON summary
+//v1.8 128k banks that are all one value left out of the ROM & filled by the loader, -k to keep them
+//v1.9 -o writes the ROM as it is stored (header & compressed data) for the CMake catalog build
+//v1.10 final loader in the stack of a 128k snapshot goes in the bank paged in at 0xc000, not bank 0
+//v1.11 -t carries on past a broken snapshot, shown with its error, & ends with E12 if any were
 
 // E00 - invalid option
 // E01 - input file not Z80 or SNA snapshot
@@ -35,53 +54,247 @@
 // E06 - not enough memory
 // E07 - input file read error, issue with Z80/SNA snapshot
 // E11 - cannot compress as won't fit into ROM
+// E12 - some snapshots in a batch could not be converted
 //
 typedef union {
 	uint32_t rrrr; //byte number
 	uint8_t r[4]; //split number into 4 8bit bytes in case of overflow
 } rrrr;
+typedef struct {
+	uint8_t* buf; // whole snapshot file
+	uint32_t len; // its length
+	uint32_t pos; // next byte to read
+} snap_t;
 //
-uint16_t dcz80(FILE** fp_in, uint8_t* out, uint16_t size);
+void snapLoad(snap_t* s, char* fname);
+uint8_t snapByte(snap_t* s);
+void snapSkip(snap_t* s, uint32_t n);
+void snapBlock(snap_t* s, uint8_t* out, uint32_t n);
+int snapParse(snap_t* s, uint8_t sna, uint8_t* romReg, uint8_t* pcReg, uint8_t* romReg_i, uint8_t** out);
+void snapBench(int files, char* fname[]);
+uint8_t isSNA(char* fname);
+uint16_t dcz80(snap_t* s, uint8_t* out, uint16_t size);
 uint32_t simplelz(uint8_t* fload, uint8_t* store, uint32_t filesize);
 void error(uint8_t errorcode);
-void printOut(FILE* fp, uint8_t* buffer, uint32_t filesize, char* name,uint8_t cm,char *oname);
+void printOut(FILE* fp, uint8_t* buffer, uint32_t filesize, char* name,uint8_t cm,uint8_t flags,char *oname);
+// conversion options, bits so they can go into the cache key
+#define OPT_BIN 0x01	// -b also create binary files
+#define OPT_SCREEN 0x02	// -s force final loader into screen
+#define OPT_STREAM 0x04	// -l streamed launch
+#define OPT_KEEP 0x08	// -k keep every 128k bank in the ROM, even empty ones
+// what a conversion did, filled in by convert() and handed back from batch jobs
+typedef struct {
+	uint8_t err;	// 0 ok, otherwise the E number it stopped with
+	uint8_t otek;	// 1 if 128k
+	uint8_t cached;	// 1 if the ROM came from the cache
+	uint8_t screen;	// 1 if the final loader is in the screen, 0 in the stack
+	uint8_t sparse;	// 128k banks left out of the ROM as they are all one value, bit per bank
+	uint16_t at;	// where the final loader is
+	uint32_t insize;	// snapshot size
+	uint32_t cmsize;	// compressed ROM size
+	double ms;	// time taken
+} conv_t;
+//
+void convert(char* fZ80, char* dispName, uint8_t opts, char* cache, conv_t* r);
+char* romOut = NULL;	// -o, the ROM itself goes here instead of a header file
+jmp_buf* errorTrap = NULL;	// -t, error() comes back here for the next snapshot rather than exiting
+uint8_t romBuild(snap_t* s, uint8_t sna, uint8_t opts, conv_t* r, uint8_t** storeOut, uint8_t** compOut);
+void batch(int args, char* arg[], uint8_t opts, char* cache, int jobs, char* report);
+void batchAdd(char* path, int top);
+void batchReport(char* report, int jobs, double ms);
+void cacheName(char* cpath, char* cache, snap_t* s, uint8_t opts);
+uint8_t cacheRead(char* cpath, uint8_t opts, conv_t* r, uint8_t* flags, uint8_t** store, uint8_t** comp);
+void cacheWrite(char* cpath, uint8_t opts, conv_t* r, uint8_t flags, uint8_t* store, uint8_t* comp);
+uint8_t isSnapshot(char* fname);
+int romCount(conv_t* r, uint8_t opts);
+char* bankList(uint8_t bits);
+double msNow();
 
 //main
 int main(int argc, char* argv[]) {
 	if (argc < 2) {
 		fprintf(stdout, "Usage: Z80toROM <-b> infile.z80/sna <displayname>\n");
+		fprintf(stdout, "       Z80toROM -a <-j jobs> <-c cachedir> <-r report.json> snapshots, folders or @lists\n");
 		fprintf(stdout, "  -b also create binary files\n");
 		fprintf(stdout, "  -s force final loader into screen\n");
+		fprintf(stdout, "  -l streamed launch, needs ZX PicoIF2Lite v0.8 or later\n");
+		fprintf(stdout, "  -k keep empty 128k banks in the ROM, needed before ZX PicoIF2Lite v0.8\n");
+		fprintf(stdout, "  -t time loading, parsing & compressing every snapshot given, nothing is written\n");
+		fprintf(stdout, "  -a convert every snapshot given, in folders given or listed in @files, in parallel\n");
+		fprintf(stdout, "  -j number of conversions to run at once, defaults to one per core\n");
+		fprintf(stdout, "  -c keep converted ROMs in cachedir & reuse them if the snapshot hasn't changed\n");
+		fprintf(stdout, "  -r write a JSON summary of the conversions\n");
+		fprintf(stdout, "  -o outfile write the ROM as it is stored, header & all, instead of a header file\n");
 		fprintf(stdout,"  if no displayname given infile filename will be used\n");		
 		exit(0);
 	}
 	//
-	uint8_t forceScreen=0,produceBinary = 0;
-	uint8_t command=1;
-	while(argv[command][0]=='-') {
+	uint8_t opts = 0,timeOnly = 0,all = 0;
+	char* cache = NULL, * report = NULL;
+	int jobs = 0;
+	int command=1;
+	while(command<argc&&argv[command][0]=='-') {
 		if (argv[command][1] == 'b') {
-			produceBinary = 1;
+			opts |= OPT_BIN;
 		} else if(argv[command][1] == 's') {
-			forceScreen = 1;
+			opts |= OPT_SCREEN;
+		} else if(argv[command][1] == 'l') {
+			opts |= OPT_STREAM;
+		} else if(argv[command][1] == 'k') {
+			opts |= OPT_KEEP;
+		} else if(argv[command][1] == 't') {
+			timeOnly = 1;
+		} else if(argv[command][1] == 'a') {
+			all = 1;
+		} else if(argv[command][1] == 'j' && command+1<argc) {
+			jobs = atoi(argv[++command]);
+		} else if(argv[command][1] == 'c' && command+1<argc) {
+			cache = argv[++command];
+		} else if(argv[command][1] == 'r' && command+1<argc) {
+			report = argv[++command];
+		} else if(argv[command][1] == 'o' && command+1<argc) {
+			romOut = argv[++command];
 		} else {
 			error(0);
 		}
 		command++;
 	}
+	if (command>=argc || (romOut != NULL && all)) error(0); // -o is one ROM
+	if (cache != NULL) { // make the cache folder if it isn't there
+#ifdef _WIN32
+		_mkdir(cache);
+#else
+		mkdir(cache, 0777);
+#endif
+	}
+	if (timeOnly) {
+		snapBench(argc - command, &argv[command]);
+		exit(0);
+	}
+	if (all) {
+		batch(argc - command, &argv[command], opts, cache, jobs, report);
+		exit(0);
+	}
 	// check infile is a snapshot
-	if (strcmp(&argv[command][strlen(argv[command]) - 4], ".z80") != 0 && strcmp(&argv[command][strlen(argv[command]) - 4], ".Z80") != 0 &&
-		strcmp(&argv[command][strlen(argv[command]) - 4], ".sna") != 0 && strcmp(&argv[command][strlen(argv[command]) - 4], ".SNA") != 0) error(1); // argument isn't .z80/sna or .Z80/SNA
+	if (!isSnapshot(argv[command])) error(1); // argument isn't .z80/sna or .Z80/SNA
+	conv_t r;
+	convert(argv[command], command<argc-1 ? argv[argc-1] : NULL, opts, cache, &r);
+	// all done
+	return 0;
+}
+
+//
+// ---------------------------------------------------------------------------
+// convert - turn one snapshot into a ROM header (and binaries with -b) next to it,
+// from the cache if there is one and it has this snapshot & options
+// ---------------------------------------------------------------------------
+void convert(char* fZ80, char* dispName, uint8_t opts, char* cache, conv_t* r) {
+	double start = msNow();
+	int i;
 	// create output file
-	char* fZ80 = argv[command];
 	char fROM[256]; // limit to 256chars
-	int i=0;
+	i=0;
 	do {
 		fROM[i] = fZ80[i];
 		i++;
-	} while(i<254&&(argv[command][i]!='.'||i<strlen(argv[command])-4));
+	} while(i<254&&(fZ80[i]!='.'||i<strlen(fZ80)-4));
 	fROM[i] = '\0';
+	FILE* fp_out;
+	memset(r, 0, sizeof(conv_t));
+	//read the whole snapshot in, the cache key is made from it so read it even if cached
+	snap_t s;
+	snapLoad(&s, fZ80);
+	r->insize = s.len;
+	uint8_t* store = NULL, * comp = NULL, flags;
+	char cpath[512];
+	if (cache != NULL) cacheName(cpath, cache, &s, opts);
+	if (cache != NULL && cacheRead(cpath, opts, r, &flags, &store, &comp)) {
+		fprintf(stdout, "  %s from cache %s, %dbytes\n", fZ80, cpath, r->cmsize);
+	} else {
+		flags = romBuild(&s, isSNA(fZ80), opts, r, &store, &comp);
+		if (cache != NULL) cacheWrite(cpath, opts, r, flags, store, comp);
+	}
+	free(s.buf);
+	// if required produce the binary files, 16384bytes each
+	int roms = romCount(r, opts);
+	strcat(fROM, ".0");
+	if (opts & OPT_BIN) {
+		for (i = 0; i < roms; i++) {
+			if ((fp_out = fopen(fROM, "wb")) == NULL) error(3); // cannot open file for write	
+			if (fwrite(&store[i * 16384], sizeof(uint8_t), 16384, fp_out) != 16384) error(7);
+			fclose(fp_out);
+			fROM[strlen(fROM) - 1]++;
+		}
+	}
+	free(store);
+	// create ROM name, from the filename without any folders
+	char outName[33],headerName[33];
+	char* fName = fZ80;
+	for (i = 0; fZ80[i]; i++) if (fZ80[i] == '/' || fZ80[i] == '\\') fName = &fZ80[i + 1];
+
+	//char headerName[256];
+	//char outName[33];
+	i=0;
+	unsigned int j=0;
+	if((fName[j]>='0'&&fName[j]<='9')) {
+		headerName[j]='_';	// starts with a number
+		j++;
+	}
+	do {
+		outName[i]=fName[i];
+		if(j<32) {
+			if(fName[i]>='A'&&fName[i]<='Z') {
+				headerName[j++]=fName[i]+32;
+			} else if((fName[i]>='0'&&fName[i]<='9')||
+					(fName[i]>='a'&&fName[i]<='z')) {
+				headerName[j++]=fName[i];
+			} else {
+				headerName[j++]='_';
+			}
+		}
+		i++;
+	} while(i<32&&(fName[i]!='.'||i<strlen(fName)-4));
+	outName[i]=headerName[j]='\0';
+	if (romOut != NULL) {
+		// 34byte header then the compressed ROM, exactly what ends up in flash
+		uint8_t head[34] = { r->otek ? 0x08 : 0x03, flags };
+		char* oname = dispName != NULL ? dispName : outName;
+		for (i = 0; i < 32 && i < strlen(oname); i++) head[2 + i] = oname[i];
+		if ((fp_out = fopen(romOut, "wb")) == NULL) error(3);
+		if (fwrite(head, sizeof(uint8_t), 34, fp_out) != 34 || fwrite(comp, sizeof(uint8_t), r->cmsize, fp_out) != r->cmsize) error(3);
+		fclose(fp_out);
+		free(comp);
+		r->ms = msNow() - start;
+		return;
+	}
+	fROM[strlen(fROM)-1] = 'h';
+	if ((fp_out = fopen(fROM, "wb")) == NULL) error(3); // cannot open rom for write	
+	//
+	fprintf(fp_out,"// ,%s",headerName);
+	for(i=strlen(headerName);i<35;i++) fprintf(fp_out," ");
+	fprintf(fp_out,"// xx - %dbytes\n",r->cmsize+34);
+	if(dispName != NULL) {
+		printOut(fp_out, comp, r->cmsize, headerName,r->otek,flags,dispName);
+	} else {
+		printOut(fp_out, comp, r->cmsize, headerName,r->otek,flags,outName);
+	}	
+	//
+	fclose(fp_out);
+	free(comp);
+	r->ms = msNow() - start;
+}
+
+//
+// ---------------------------------------------------------------------------
+// romBuild - set up the loaders from the snapshot & compress it into a ROM
+//   storeOut gets the uncompressed ROMs, compOut the compressed ROM & the header flags are returned
+// ---------------------------------------------------------------------------
+uint8_t romBuild(snap_t* s, uint8_t sna, uint8_t opts, conv_t* r, uint8_t** storeOut, uint8_t** compOut) {
+	int i;
 	// loader machine code
 #define romReg_brd 34	// Border Colour
+#define romReg_sp0 37	// LD SP,0 before unpacking bank 5, JP to the fill if any banks are left out
+#define romReg_sparse 49	// 128k banks left out of the ROM, bit per bank (unused byte, read by the interface)
 #define romReg_ffff 87	// restore 0xffff
 #define romReg_fffd 121	// last OUT to 0xfffd
 #define romReg_out 127	// last OUT to 0x7ffd
@@ -124,76 +337,662 @@ int main(int argc, char* argv[]) {
 #define pcReg_jp 11	// PC
 #define pcReg_len 13
 	uint8_t pcReg[] = { 0x3a,0xff,0x3f,0xed,0x47,0xed,0x5e,0x3e,0x00,0xfb,0xc3,0xb7,0xd9 };
+// streamed launch loader, replaces 0x0000-0x0020 & 0x0021-0x0055 of the one above. Opens its
+// own RAM banks on the stream port (command 0x04, 0) then copies each 16kB from the 0x3d00
+// window with unrolled LDI, bank 5, 2 & 0 (then 1,3,4,6,7 if 128k) using the table at romReg_bnks,
+// before carrying on at 0x0056 to set up the registers. Nothing is decompressed on the Z80 and
+// no ROM paging is done so the first 0x3fff read (final loader) switches the interface off
+#define launchReg_at 0x0100
+#define launchReg_blk 0x38	// 256 x LDI
+#define launchReg_len 0x25f
+	uint8_t launchReg[launchReg_len] = { 0x3e,0x80,0xed,0x47,0xaf,0xd3,0xfe,0x21,0x00,0x58,0x77,0x54,0x1e,0x01,0x01,0xff,
+	                                     0x02,0xed,0xb0,0x3a,0xa5,0x3e,0x3a,0x5a,0x3e,0x3a,0x04,0x3e,0x3a,0x00,0x3e,0x3a,
+	                                     0x00,0x3e,0x3a,0xfb,0x3e,0x3a,0x00,0x3f,0xb7,0x28,0xfa,0xdd,0x21,0xe5,0x00,0x11,
+	                                     0x00,0x40,0x01,0x00,0x40,0x21,0x00,0x3d };
+	uint8_t launchEnd[] = { 0xea,0x35,0x01,0x7a,0xfe,0x80,0xca,0x32,0x01,0xdd,0x7e,0x00,0xdd,0x23,0xb7,0x28,
+	                        0x0b,0x01,0xfd,0x7f,0xed,0x79,0x11,0x00,0xc0,0xc3,0x32,0x01,0x3a,0x22,0x00,0xd3,
+	                        0xfe,0x31,0x00,0x00,0xc3,0x56,0x00 };
+	for (i = 0; i < 256; i++) {
+		launchReg[launchReg_blk + i * 2] = 0xed;
+		launchReg[launchReg_blk + i * 2 + 1] = 0xa0;
+	}
+	for (i = 0; i < sizeof(launchEnd); i++) launchReg[launchReg_blk + 512 + i] = launchEnd[i];
+// 128k banks that are all one value (most often never used so 0) are left out of the ROM &
+// filled by this instead, 32 x PUSH DE a loop so ~6T a byte rather than 21T for LDIR. Goes in
+// ROM 0 after bank 5 (or the streamed loader) & is jumped to in place of the LD SP,0 at 0x0025
+// (or the JP 0x0056 at the end of the streamed loader). Table after it is 7ffd value & fill
+// byte for each bank, 0 ends, then it goes back with SP=0
+#define fillReg_tbl 1	// LD HL,table
+#define fillReg_push 21	// 32 x PUSH DE
+#define fillReg_exit 61	// JP back into the loader
+#define fillReg_len 63
+	uint8_t fillReg[fillReg_len] = { 0x21,0x00,0x00,0x7e,0x23,0xb7,0x28,0x31,0x01,0xfd,0x7f,0xed,0x79,0x5e,0x23,0x53,
+	                                 0x31,0x00,0x00,0x06,0x00 };
+	uint8_t fillEnd[] = { 0x10,0xde,0x18,0xca,0x31,0x00,0x00,0xc3,0x28,0x00 };
+	for (i = 0; i < 32; i++) fillReg[fillReg_push + i] = 0xd5;
+	for (i = 0; i < sizeof(fillEnd); i++) fillReg[fillReg_push + 32 + i] = fillEnd[i];
 	uint8_t romReg_i = 0x00;
 //
-	//open read/write
-	FILE* fp_in, * fp_out;
-	if ((fp_in = fopen(fZ80, "rb")) == NULL) error(2); // cannot open snapshot for read
+	//pick the snapshot apart
+	uint8_t* main;
+	int otek = snapParse(s, sna, romReg, pcReg, &romReg_i, &main);
+	r->otek = otek;
+	int fullsize = 49152;
+	if (otek) fullsize = 131072;
+	//
+	//              12345678901234567890123456789012345678901234567890123456789012345678901234567890
+	//						 1         2         3         4         5         6         7         8
+	fprintf(stdout,"  /----------------------------------------------------------------------------\\\n");
+	fprintf(stdout," /|af$%02x%02x af'$%02x%02x hl$%02x%02x hl'$%02x%02x bc$%02x%02x bc'$%02x%02x de$%02x%02x de'$%02x%02x ix$%02x%02x |\n",
+		pcReg[pcReg_a],romReg[romReg_f],romReg[romReg_afa+1],romReg[romReg_afa],
+		romReg[romReg_hl+1],romReg[romReg_hl],romReg[romReg_hla+1],romReg[romReg_hla],
+		romReg[romReg_bc+1],romReg[romReg_bc],romReg[romReg_bca+1],romReg[romReg_bca],
+		romReg[romReg_de+1],romReg[romReg_de],romReg[romReg_dea+1],romReg[romReg_dea],
+		romReg[romReg_ix+1],romReg[romReg_ix]);
+	fprintf(stdout,"/ |iy$%02x%02x brd$%02x ",romReg[romReg_iy+1],romReg[romReg_iy],romReg[romReg_brd]);
+	if (pcReg[pcReg_ei] == 0xf3) fprintf(stdout,"di ");	//di
+	else fprintf(stdout,"ei ");	//ei
+	if (pcReg[pcReg_im] == 0x46) fprintf(stdout,"im0 "); //im 0
+	else if (pcReg[pcReg_im] == 0x56) fprintf(stdout,"im1 "); //im 1
+	else fprintf(stdout,"im2 "); // im 2
+	fprintf(stdout,"ir$%02x%02x pc$%02x%02x sp$%02x%02x ",romReg_i,romReg[romReg_r],pcReg[pcReg_jp + 1],pcReg[pcReg_jp],romReg[romReg_sp+1],romReg[romReg_sp]);
+	if(romReg[romReg_r]<9) romReg[romReg_r]+=119;
+	else romReg[romReg_r] -= 9; // so it is correct on launch
+	// where to put the final loader?
+	uint16_t stackPos = (romReg[romReg_sp + 1] * 256) + romReg[romReg_sp];
+	uint16_t pcPos = (pcReg[pcReg_jp + 1] * 256) + pcReg[pcReg_jp];
+	//fprintf(stdout,"%d %d gap:%d\n",stackPos,pcPos,stackPos-pcPos);
+	if ((stackPos>pcPos&&(stackPos-pcPos<32))||(opts & OPT_SCREEN)||(stackPos!=0&&stackPos<16384+pcReg_len)) {
+		if(stackPos<16384&&stackPos>=(16384-pcReg_len)) {
+			fprintf(stdout, "(Final Loader in Screen @%04x)|\n", 0x4000);
+			r->screen = 1;
+			r->at = 0x4000;
+			for (i = 0; i < pcReg_len; i++) {
+				main[i] = pcReg[i];
+			}
+			romReg[romReg_jp + 1] = 0x40;
+			romReg[romReg_jp] = 0x00;			
+		}
+		else {
+			fprintf(stdout, "(Final Loader in Screen @%04x)|\n", 0x5800-pcReg_len);
+			r->screen = 1;
+			r->at = 0x5800-pcReg_len;
+			for (i = 0; i < pcReg_len; i++) {
+				main[(6144-pcReg_len) + i] = pcReg[i];
+			}
+			romReg[romReg_jp + 1] = 0x57;
+			romReg[romReg_jp] = 0x100-pcReg_len;
+		}
+	}
+	else {
+		stackPos -= pcReg_len;
+		fprintf(stdout, "(Final Loader in Stack @%04x) |\n", stackPos);
+		r->at = stackPos;
+		// main is in ROM order (5, 2, 0, 1, 3, 4, 6, 7) & on a 128k the top 16kB is whichever
+		// bank 7ffd has paged in, not always bank 0
+		const uint8_t bankPiece[8] = { 2, 3, 1, 4, 5, 0, 6, 7 };
+		for (i = 0; i < pcReg_len; i++) {
+			uint16_t at = stackPos + i;
+			if (otek && at >= 0xc000) main[bankPiece[romReg[romReg_out] & 7] * 16384 + at - 0xc000] = pcReg[i];
+			else main[at - 16384] = pcReg[i];
+		}
+		romReg[romReg_jp + 1] = stackPos / 256;
+		romReg[romReg_jp] = stackPos - (romReg[romReg_jp] * 256);
+	}
+	if(otek) {
+		fprintf(stdout,"  |128k -> 7ffd$%02x fffd$%02x ay",romReg[romReg_out],romReg[romReg_fffd]);
+		for(i=0;i<16;i++) fprintf(stdout,"$%02x",romReg[romReg_ay+i]);
+		fprintf(stdout,"  |\n");
+	}
+	fprintf(stdout,"  |----------------------------------------------------------------------------|\n");
+	//              12345678901234567890123456789012345678901234567890123456789012345678901234567890
+	//						 1         2         3         4         5         6         7         8
+	//
+	// compress every page and write out with
+	uint8_t* store;
+	uint32_t size = 49152;
+	int banks = 3;
+	// 16kB pieces of main in ROM order after bank 5, all 128k ones that are one value can be left out
+	int piece[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+	const uint8_t pieceBank[8] = { 5, 2, 0, 1, 3, 4, 6, 7 };
+	uint8_t fillTbl[13], fills = 0, last = 2;
+	char line[80];
+	if (otek) {
+		banks = 0;
+		size = 0;
+		for (i = 0; i < 8; i++) {
+			int k = 0;
+			if (i >= 2 && !(opts & OPT_KEEP)) {
+				for (k = 1; k < 16384 && main[16384 * i + k] == main[16384 * i]; k++);
+			}
+			if (k == 16384) {
+				// one value, fill it
+				r->sparse |= 1 << pieceBank[i];
+				fillTbl[fills * 2] = 0x10 | pieceBank[i];
+				fillTbl[fills * 2 + 1] = main[16384 * i];
+				fills++;
+				last = i; // fill pages it last so its 0xffff is the one restored
+			} else {
+				piece[banks++] = i;
+				if (i >= 2) romReg[romReg_bnks + banks - 3] = 0x10 | pieceBank[i];
+				if (!fills) last = i;
+				size += 16384;
+			}
+		}
+		romReg[romReg_bnks + banks - 2] = 0x00;
+		fillTbl[fills * 2] = 0x00;
+		romReg[romReg_sparse] = r->sparse;
+	}
+	romReg[romReg_ffff] = main[16384 * last + 16382];
+	romReg[romReg_ffff + 1] = main[16384 * last + 16383];
+	//
+	rrrr cmsize;
+	// streamed launch has the loader ROM then every bank, so one more 16kB
+	int roms = banks;
+	if (opts & OPT_STREAM) {
+		roms = banks + 1;
+		size += 16384;
+	}
+	uint16_t fillAt = 0;
+	if ((store = (uint8_t*)malloc(size * sizeof(uint8_t))) == NULL) error(6);
+	for (i = 0; i < size; i++) store[i] = 0x00; // clear store
+	for (i = 0; i < romReg_len; i++) store[i] = romReg[i]; // copy in the loader
+	if (opts & OPT_STREAM) {
+		for (i = 0; i < launchReg_len; i++) store[launchReg_at + i] = launchReg[i];
+		store[1] = 0xc3; // di then jp to the streamed loader
+		store[2] = launchReg_at & 0xff;
+		store[3] = launchReg_at >> 8;
+		store[0x3fff]=romReg_i; // put i at end of ROM
+		if (fills) {
+			fillAt = launchReg_at + launchReg_len;
+			store[launchReg_at + launchReg_blk + 512 + sizeof(launchEnd) - 2] = fillAt & 0xff; // jp fill not 0x0056
+			store[launchReg_at + launchReg_blk + 512 + sizeof(launchEnd) - 1] = fillAt >> 8;
+			fillReg[fillReg_exit] = 0x56;
+		}
+		fprintf(stdout, "  |ROM 0   (    0- 16383) Streamed Launch Loader (%3dbytes)                     |\n", launchReg_at + launchReg_len);
+		if (fills) {
+			snprintf(line, sizeof(line), "Banks %s streamed, compressed on their own", bankList(~r->sparse));
+			fprintf(stdout, "  |%-76s|\n", line);
+		} else fprintf(stdout, "  |Banks 5,2 & 0%s streamed, compressed on their own               |\n", otek ? ",1,3,4,6 & 7" : "            ");
+		for (i = 0; i < banks; i++) {
+			for (int k = 0; k < 16384; k++) store[16384 * (i + 1) + k] = main[16384 * piece[i] + k];
+		}
+	} else {
+		cmsize.rrrr = simplelz(main, &store[romReg_len], 16384);
+		fprintf(stdout, "  |ROM 0   (16384- 32767) Compressing Bank 5 (%5dbytes) + Loader (%3dbytes)  |\n", cmsize.rrrr, romReg_len);
+		if (cmsize.rrrr + (fills ? fillReg_len + fills * 2 + 1 : 0) >= (16384 - (romReg_len+1))) error(11);
+		store[0x3fff]=romReg_i; // put i at end of ROM
+		if (fills) {
+			fillAt = romReg_len + cmsize.rrrr;
+			store[romReg_sp0] = 0xc3; // jp fill not ld sp,0
+			store[romReg_sp0 + 1] = fillAt & 0xff;
+			store[romReg_sp0 + 2] = fillAt >> 8;
+		}
+		//
+		if (fills) {
+			snprintf(line, sizeof(line), "ROM 1-%d (32768-%6d) Copying Banks %s", banks - 1, (banks + 1) * 16384 - 1, bankList(~r->sparse & 0xdf));
+			fprintf(stdout, "  |%-76s|\n", line);
+		} else {
+			fprintf(stdout, "  |ROM 1,2 (32768- 65535) Copying Banks 2 & 0                                  |\n");
+		}
+		if (otek && !fills) fprintf(stdout, "  |ROM 3-7 (65536-131071) Copying Banks 1,3,4,6 & 7                            |\n");
+		for (i = 1; i < banks; i++) {
+			for (int k = 0; k < 16384; k++) store[16384 * i + k] = main[16384 * piece[i] + k];
+		}
+	}
+	if (fills) {
+		fillReg[fillReg_tbl] = (fillAt + fillReg_len) & 0xff;
+		fillReg[fillReg_tbl + 1] = (fillAt + fillReg_len) >> 8;
+		for (i = 0; i < fillReg_len; i++) store[fillAt + i] = fillReg[i];
+		for (i = 0; i <= fills * 2; i++) store[fillAt + fillReg_len + i] = fillTbl[i];
+		// LDIR is 21T a byte & LDI 16T, the fill ~5.7T & there's nothing for the interface to unpack or send
+		snprintf(line, sizeof(line), "Banks %s all one value, filled by the loader instead (~%dms less)", bankList(r->sparse), fills * ((opts & OPT_STREAM) ? 48 : 72));
+		fprintf(stdout, "  |%-76s|\n", line);
+	}
+	fprintf(stdout,"\\ |----------------------------------------------------------------------------|\n");
+	free(main);
+	// compress the ROM ready for use on the interface
+	// 128k is compressed bank by bank (header flag 0x01) so the interface can start the
+	// loader as soon as ROM 0 is unpacked and do the rest in the background.
+	// Streamed launch is always bank by bank, flags 0x02 (stream port) & 0x04 (streamed launch)
+	uint8_t* comp;
+	uint8_t flags = 0x00;
+	if ((comp = (uint8_t*)malloc((size + size / 64) * sizeof(uint8_t))) == NULL) error(6);
+	if (opts & OPT_STREAM) {
+		flags = 0x06;
+		cmsize.rrrr = 0;
+		for (i = 0; i < roms; i++) cmsize.rrrr += simplelz(&store[i * 16384], &comp[cmsize.rrrr], 16384);
+		if (fills) flags |= 0x08;
+	} else if (otek) {
+		flags = 0x01;
+		cmsize.rrrr = 0;
+		for (i = 0; i < banks; i++) cmsize.rrrr += simplelz(&store[i * 16384], &comp[cmsize.rrrr], 16384);
+		if (fills) flags |= 0x08;
+	} else {
+		cmsize.rrrr = simplelz(store, comp, size);
+	}
+	fprintf(stdout, " \\|Full ROM Compressed to %5dbytes (%4.1f%% saving)                            |\n", cmsize.rrrr,(((double)fullsize-(double)cmsize.rrrr)/(double)fullsize)*100);
+	fprintf(stdout,"  \\----------------------------------------------------------------------------/\n");
+	r->cmsize = cmsize.rrrr;
+	*storeOut = store;
+	*compOut = comp;
+	return flags;
+}
+
+//
+// ---------------------------------------------------------------------------
+// romCount - 16kB ROMs in a converted snapshot, less any banks left out
+// ---------------------------------------------------------------------------
+int romCount(conv_t* r, uint8_t opts) {
+	int roms = (r->otek ? 8 : 3) + ((opts & OPT_STREAM) ? 1 : 0);
+	for (int i = 0; i < 8; i++) if (r->sparse & (1 << i)) roms--;
+	return roms;
+}
+
+//
+// ---------------------------------------------------------------------------
+// bankList - "5,2,0 & 7" style list of the banks set in bits, in ROM order
+// ---------------------------------------------------------------------------
+char* bankList(uint8_t bits) {
+	static char list[24];
+	const uint8_t order[8] = { 5, 2, 0, 1, 3, 4, 6, 7 };
+	int i, n = 0, k = 0;
+	for (i = 0; i < 8; i++) if (bits & (1 << order[i])) n++;
+	for (i = 0; i < 8; i++) {
+		if (bits & (1 << order[i])) {
+			k += sprintf(&list[k], "%s%d", k == 0 ? "" : --n == 1 ? " & " : ",", order[i]);
+		}
+	}
+	return list;
+}
+
+//
+// ---------------------------------------------------------------------------
+// isSnapshot - 1 if the filename ends .z80 or .sna (either case)
+// ---------------------------------------------------------------------------
+uint8_t isSnapshot(char* fname) {
+	if (strlen(fname) < 4) return 0;
+	if (strcmp(&fname[strlen(fname) - 4], ".z80") == 0 || strcmp(&fname[strlen(fname) - 4], ".Z80") == 0) return 1;
+	return isSNA(fname);
+}
+
+//
+// ---------------------------------------------------------------------------
+// msNow - milliseconds from a fixed point, for timing
+// ---------------------------------------------------------------------------
+double msNow() {
+#ifdef _WIN32
+	return (double)clock() * 1000 / CLOCKS_PER_SEC;
+#else
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec * 1000 + (double)t.tv_nsec / 1000000;
+#endif
+}
+
+//
+// ---------------------------------------------------------------------------
+// batch - convert a whole collection, each snapshot in its own process so an
+// error only stops that one, up to jobs at once (one per core if 0). Results
+// come back through shared memory for the summary & the JSON report.
+// Windows has no fork so there they are done one after another
+// ---------------------------------------------------------------------------
+char** batchFile = NULL;	// every snapshot found
+int batchFiles = 0, batchMax = 0;
+conv_t* batchRes;	// one result per snapshot
+void batch(int args, char* arg[], uint8_t opts, char* cache, int jobs, char* report) {
+	int i, done = 0, failed = 0, cached = 0;
+	double start = msNow();
+	for (i = 0; i < args; i++) batchAdd(arg[i], 1);
+	if (batchFiles == 0) error(1);
+#ifdef _WIN32
+	jobs = 1;
+	if ((batchRes = (conv_t*)malloc(batchFiles * sizeof(conv_t))) == NULL) error(6);
+	for (i = 0; i < batchFiles; i++) convert(batchFile[i], NULL, opts, cache, &batchRes[i]);
+	done = batchFiles;
+#else
+	if (jobs < 1) jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	if (jobs < 1) jobs = 1;
+	batchRes = (conv_t*)mmap(NULL, batchFiles * sizeof(conv_t), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (batchRes == MAP_FAILED) error(6);
+	pid_t* pid;
+	if ((pid = (pid_t*)malloc(batchFiles * sizeof(pid_t))) == NULL) error(6);
+	int next = 0, running = 0, status;
+	while (done < batchFiles) {
+		// start as many as allowed
+		while (running < jobs && next < batchFiles) {
+			fflush(stdout); // or the child would print it again
+			pid[next] = fork();
+			if (pid[next] < 0) error(6);
+			if (pid[next] == 0) {
+				if (freopen("/dev/null", "w", stdout) == NULL) exit(3); // keep the per file box quiet
+				convert(batchFile[next], NULL, opts, cache, &batchRes[next]);
+				exit(0);
+			}
+			next++;
+			running++;
+		}
+		// wait for one to finish
+		pid_t p = wait(&status);
+		if (p < 0) break;
+		for (i = 0; i < next && pid[i] != p; i++);
+		if (i == next) continue;
+		running--;
+		done++;
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+			memset(&batchRes[i], 0, sizeof(conv_t));
+			batchRes[i].err = WIFEXITED(status) ? WEXITSTATUS(status) : 99;
+			fprintf(stdout, "  [%4d/%4d] %-40s [E%02d]\n", done, batchFiles, batchFile[i], batchRes[i].err);
+		} else {
+			fprintf(stdout, "  [%4d/%4d] %-40s %4s %6dbytes %s @%04x %8.1fms%s\n", done, batchFiles, batchFile[i],
+				batchRes[i].otek ? "128k" : "48k", batchRes[i].cmsize, batchRes[i].screen ? "screen" : "stack",
+				batchRes[i].at, batchRes[i].ms, batchRes[i].cached ? " cached" : "");
+		}
+	}
+	free(pid);
+#endif
+	for (i = 0; i < batchFiles; i++) {
+		if (batchRes[i].err) failed++;
+		else if (batchRes[i].cached) cached++;
+	}
+	double ms = msNow() - start;
+	fprintf(stdout, "  %d snapshots, %d converted, %d from the cache, %d failed, %d jobs in %.1fs (%.1f files/s)\n",
+		batchFiles, batchFiles - failed - cached, cached, failed, jobs, ms / 1000, ms > 0 ? batchFiles * 1000 / ms : 0.0);
+	if (report != NULL) batchReport(report, jobs, ms);
+	if (failed) error(12);
+}
+
+//
+// ---------------------------------------------------------------------------
+// batchAdd - add a snapshot, every snapshot in a folder (and the ones below it)
+// or every line of an @list file to the batch
+// ---------------------------------------------------------------------------
+void batchAdd(char* path, int top) {
+	struct stat st;
+	if (path[0] == '@' && top) {
+		FILE* fp_list;
+		char line[1024];
+		if ((fp_list = fopen(&path[1], "r")) == NULL) error(2);
+		while (fgets(line, sizeof(line), fp_list) != NULL) {
+			line[strcspn(line, "\r\n")] = '\0';
+			if (line[0] != '\0' && line[0] != '#') batchAdd(line, 1);
+		}
+		fclose(fp_list);
+		return;
+	}
+	if (stat(path, &st) != 0) {
+		if (top) error(2); // cannot open
+		return;
+	}
+	if (S_ISDIR(st.st_mode)) {
+		DIR* dir;
+		struct dirent* ent;
+		char sub[1024];
+		if ((dir = opendir(path)) == NULL) error(2);
+		while ((ent = readdir(dir)) != NULL) {
+			if (ent->d_name[0] == '.') continue;
+			snprintf(sub, sizeof(sub), "%s/%s", path, ent->d_name);
+			batchAdd(sub, 0);
+		}
+		closedir(dir);
+		return;
+	}
+	if (!isSnapshot(path)) {
+		if (top) error(1); // named but not a snapshot
+		return;
+	}
+	if (batchFiles == batchMax) {
+		batchMax = batchMax ? batchMax * 2 : 256;
+		if ((batchFile = (char**)realloc(batchFile, batchMax * sizeof(char*))) == NULL) error(6);
+	}
+	if ((batchFile[batchFiles] = (char*)malloc(strlen(path) + 1)) == NULL) error(6);
+	strcpy(batchFile[batchFiles++], path);
+}
+
+//
+// ---------------------------------------------------------------------------
+// batchReport - write the JSON summary, one entry per snapshot
+// ---------------------------------------------------------------------------
+void batchReport(char* report, int jobs, double ms) {
+	FILE* fp_out;
+	int i, j;
+	if ((fp_out = fopen(report, "w")) == NULL) error(3);
+	fprintf(fp_out, "{\n  \"tool\": \"%s %s\",\n  \"jobs\": %d,\n  \"ms\": %.1f,\n  \"files\": [\n", PROGNAME, VERSION_NUM, jobs, ms);
+	for (i = 0; i < batchFiles; i++) {
+		fprintf(fp_out, "    { \"file\": \"");
+		for (j = 0; batchFile[i][j]; j++) {
+			if (batchFile[i][j] == '"' || batchFile[i][j] == '\\') fputc('\\', fp_out);
+			if ((uint8_t)batchFile[i][j] >= 32) fputc(batchFile[i][j], fp_out);
+		}
+		fprintf(fp_out, "\", \"error\": %d", batchRes[i].err);
+		if (!batchRes[i].err) {
+			fprintf(fp_out, ", \"cached\": %s, \"ms\": %.1f, \"model\": \"%s\", \"snapshotBytes\": %u, \"romBytes\": %u, \"loader\": \"%s\", \"loaderAt\": %u, \"filledBanks\": [",
+				batchRes[i].cached ? "true" : "false", batchRes[i].ms, batchRes[i].otek ? "128k" : "48k", batchRes[i].insize,
+				batchRes[i].cmsize + 34, batchRes[i].screen ? "screen" : "stack", batchRes[i].at);
+			for (j = 0; j < 8; j++) if (batchRes[i].sparse & (1 << j)) fprintf(fp_out, "%s%d", (batchRes[i].sparse & ((1 << j) - 1)) ? ", " : "", j);
+			fprintf(fp_out, "]");
+		}
+		fprintf(fp_out, " }%s\n", i < batchFiles - 1 ? "," : "");
+	}
+	fprintf(fp_out, "  ]\n}\n");
+	fclose(fp_out);
+}
+
+//
+// ---------------------------------------------------------------------------
+// cacheName - the cache file for a snapshot is named after a FNV-1a hash of
+// its bytes, the options & this version, so changing any of them misses
+// ---------------------------------------------------------------------------
+void cacheName(char* cpath, char* cache, snap_t* s, uint8_t opts) {
+	uint64_t h = 0xcbf29ce484222325ull;
+	uint32_t i;
+	for (i = 0; i < s->len; i++) h = (h ^ s->buf[i]) * 0x100000001b3ull;
+	h = (h ^ opts) * 0x100000001b3ull;
+	for (i = 0; i < strlen(VERSION_NUM); i++) h = (h ^ VERSION_NUM[i]) * 0x100000001b3ull;
+	snprintf(cpath, 512, "%s/%08x%08x.rom", cache, (uint32_t)(h >> 32), (uint32_t)h);
+}
+
+//
+// ---------------------------------------------------------------------------
+// cacheRead & cacheWrite - a cache file is a 16 byte header then the compressed
+// ROM & with -b the uncompressed ROMs
+//   0-3 "ZROM", 4 128k, 5 header flags, 6 loader in screen, 7 options,
+//   8-9 loader address, 10-13 compressed size, 14 banks left out, 15 spare
+// ---------------------------------------------------------------------------
+uint8_t cacheRead(char* cpath, uint8_t opts, conv_t* r, uint8_t* flags, uint8_t** store, uint8_t** comp) {
+	FILE* fp_in;
+	uint8_t head[16];
+	if ((fp_in = fopen(cpath, "rb")) == NULL) return 0;
+	if (fread(head, 1, 16, fp_in) != 16 || memcmp(head, "ZROM", 4) != 0 || head[7] != opts) {
+		fclose(fp_in);
+		return 0;
+	}
+	r->otek = head[4];
+	*flags = head[5];
+	r->screen = head[6];
+	r->at = head[8] + head[9] * 256;
+	r->cmsize = head[10] + (head[11] << 8) + (head[12] << 16) + ((uint32_t)head[13] << 24);
+	r->sparse = head[14];
+	uint32_t roms = (opts & OPT_BIN) ? romCount(r, opts) : 0;
+	*store = NULL;
+	if ((*comp = (uint8_t*)malloc(r->cmsize + 1)) == NULL) error(6);
+	if (roms && (*store = (uint8_t*)malloc(roms * 16384)) == NULL) error(6);
+	if (fread(*comp, 1, r->cmsize, fp_in) != r->cmsize || (roms && fread(*store, 1, roms * 16384, fp_in) != roms * 16384)) {
+		fclose(fp_in);
+		free(*comp);
+		free(*store);
+		return 0; // broken, so convert again
+	}
+	fclose(fp_in);
+	r->cached = 1;
+	return 1;
+}
+void cacheWrite(char* cpath, uint8_t opts, conv_t* r, uint8_t flags, uint8_t* store, uint8_t* comp) {
+	FILE* fp_out;
+	char tmp[544];
+	uint8_t head[16] = { 'Z','R','O','M', r->otek, flags, r->screen, opts, r->at & 0xff, r->at >> 8,
+	                     r->cmsize & 0xff, (r->cmsize >> 8) & 0xff, (r->cmsize >> 16) & 0xff, r->cmsize >> 24, r->sparse, 0 };
+	uint32_t roms = (opts & OPT_BIN) ? romCount(r, opts) : 0;
+	// written under another name & renamed so a parallel job never sees half of it
+#ifdef _WIN32
+	snprintf(tmp, sizeof(tmp), "%s.tmp", cpath);
+#else
+	snprintf(tmp, sizeof(tmp), "%s.%d", cpath, (int)getpid());
+#endif
+	if ((fp_out = fopen(tmp, "wb")) == NULL) return; // no cache, still converted
+	if (fwrite(head, 1, 16, fp_out) != 16 || fwrite(comp, 1, r->cmsize, fp_out) != r->cmsize ||
+		(roms && fwrite(store, 1, roms * 16384, fp_out) != roms * 16384)) {
+		fclose(fp_out);
+		remove(tmp);
+		return;
+	}
+	fclose(fp_out);
+	if (rename(tmp, cpath) != 0) remove(tmp);
+}
+
+//
+// ---------------------------------------------------------------------------
+// printOut - print out the binary in a standard header format
+// ---------------------------------------------------------------------------
+void printOut(FILE* fp, uint8_t* buffer, uint32_t filesize, char* name,uint8_t cm,uint8_t flags,char *oname) {
+	uint32_t i, j;
+	fprintf(fp, "    const uint8_t %s[]={ ", name);
+	//
+	if(cm) fprintf(fp,"0x08,");	// 128k
+	else fprintf(fp,"0x03,");	// 48k
+	fprintf(fp,"0x%02x,",flags);	// flags, 0x01 banks compressed separately
+	j=0;
+	do {
+		if(j<strlen(oname)) fprintf(fp,"0x%02x,",oname[j]); 
+		else fprintf(fp,"0x00,"); 
+	} while(++j<32);
+	fprintf(fp,"\n");
+	for(j=0;j<23+strlen(name);j++) fprintf(fp," ");   
+	//
+	for (i = 0; i < filesize; i++) {
+		if ((i % 32) == 0 && i != 0) {
+			fprintf(fp, "\n");
+			for (j = 0; j < 23 + strlen(name); j++) fprintf(fp, " ");
+		}
+		fprintf(fp, "0x%02x", buffer[i]);
+		if (i < filesize - 1) {
+			fprintf(fp, ",");
+		}
+	}
+	fprintf(fp, " };\n");
+}
+
+//
+// ---------------------------------------------------------------------------
+// isSNA - 1 if the filename is a .sna snapshot, 0 for .z80
+// ---------------------------------------------------------------------------
+uint8_t isSNA(char* fname) {
+	if (strcmp(&fname[strlen(fname) - 4], ".sna") == 0 || strcmp(&fname[strlen(fname) - 4], ".SNA") == 0) return 1;
+	return 0;
+}
+
+//
+// ---------------------------------------------------------------------------
+// snapLoad - read the whole snapshot into memory in one go
+// ---------------------------------------------------------------------------
+void snapLoad(snap_t* s, char* fname) {
+	FILE* fp_in;
+	if ((fp_in = fopen(fname, "rb")) == NULL) error(2); // cannot open snapshot for read
 	// get filesize
 	fseek(fp_in, 0, SEEK_END); // jump to the end of the file to get the length
-	int filesize = ftell(fp_in); // get the file size
+	long filesize = ftell(fp_in); // get the file size
 	rewind(fp_in);
-	// z80 or sna?
-	int snap = 0;
-	if (strcmp(&fZ80[strlen(fZ80) - 4], ".sna") == 0 || strcmp(&fZ80[strlen(fZ80) - 4], ".SNA") == 0) snap = 1;
-	//
-	int otek = 0;
+	if (filesize < 30) error(7); // smaller than any header
+	if ((s->buf = (uint8_t*)malloc(filesize * sizeof(uint8_t))) == NULL) error(6);
+	if (fread(s->buf, sizeof(uint8_t), filesize, fp_in) != (size_t)filesize) error(7);
+	fclose(fp_in);
+	s->len = filesize;
+	s->pos = 0;
+}
+
+//
+// ---------------------------------------------------------------------------
+// snapByte, snapSkip & snapBlock - read from the snapshot in memory, running
+// off the end of it means the snapshot is broken so E07
+// ---------------------------------------------------------------------------
+uint8_t snapByte(snap_t* s) {
+	if (s->pos >= s->len) error(7);
+	return s->buf[s->pos++];
+}
+void snapSkip(snap_t* s, uint32_t n) {
+	if (n > s->len - s->pos) error(7);
+	s->pos += n;
+}
+void snapBlock(snap_t* s, uint8_t* out, uint32_t n) {
+	if (n > s->len - s->pos) error(7);
+	memcpy(out, &s->buf[s->pos], n);
+	s->pos += n;
+}
+
+//
+// ---------------------------------------------------------------------------
+// snapParse - pick a Z80 (v1, v2 or v3) or SNA (48k or 128k) snapshot apart, the
+// registers go into the loaders & the memory is unpacked into a new buffer
+//   returns 1 if 128k
+// ---------------------------------------------------------------------------
+int snapParse(snap_t* s, uint8_t sna, uint8_t* romReg, uint8_t* pcReg, uint8_t* romReg_i, uint8_t** out) {
+	int i, otek = 0;
 	uint8_t compressed = 0;
 	rrrr addlen;
 	addlen.rrrr = 0; // z80 only, 0 indicates v1, 23 for v2 otherwise v3
 	uint8_t c;
 	//read is sna, compressed=0, addlen.rrrr=0, otek=0
-	if (snap) {
-		if (filesize < 49179) error(7);
-		if (filesize >= 131103) otek = 1; // 128k snapshot
+	if (sna) {
+		if (s->len < 49179) error(7);
+		if (s->len >= 131103) otek = 1; // 128k snapshot
 		//	$00  I	Interrupt register
-		romReg_i = fgetc(fp_in);
+		*romReg_i = snapByte(s);
 		//	$01  HL'
-		romReg[romReg_hla] = fgetc(fp_in);
-		romReg[romReg_hla + 1] = fgetc(fp_in);
+		romReg[romReg_hla] = snapByte(s);
+		romReg[romReg_hla + 1] = snapByte(s);
 		//	$03  DE'
-		romReg[romReg_dea] = fgetc(fp_in);
-		romReg[romReg_dea + 1] = fgetc(fp_in);
+		romReg[romReg_dea] = snapByte(s);
+		romReg[romReg_dea + 1] = snapByte(s);
 		// check this is a SNA snapshot
-		if (romReg_i == 'M' && romReg[romReg_hla] == 'V' &&
+		if (*romReg_i == 'M' && romReg[romReg_hla] == 'V' &&
 			romReg[romReg_hla + 1] == ' ' && romReg[romReg_dea] == '-') error(7);
-		if (romReg_i == 'Z' && romReg[romReg_hla] == 'X' &&
+		if (*romReg_i == 'Z' && romReg[romReg_hla] == 'X' &&
 			romReg[romReg_hla + 1] == '8' && romReg[romReg_dea] == '2') error(7);		
 		//	$05  BC'
-		romReg[romReg_bca] = fgetc(fp_in);
-		romReg[romReg_bca + 1] = fgetc(fp_in);
+		romReg[romReg_bca] = snapByte(s);
+		romReg[romReg_bca + 1] = snapByte(s);
 		//	$07  F'
-		romReg[romReg_afa] = fgetc(fp_in);
+		romReg[romReg_afa] = snapByte(s);
 		//	$08  A'
-		romReg[romReg_afa + 1] = fgetc(fp_in);
+		romReg[romReg_afa + 1] = snapByte(s);
 		//	$09  HL	
-		romReg[romReg_hl] = fgetc(fp_in);
-		romReg[romReg_hl + 1] = fgetc(fp_in);
+		romReg[romReg_hl] = snapByte(s);
+		romReg[romReg_hl + 1] = snapByte(s);
 		//	$0B  DE
-		romReg[romReg_de] = fgetc(fp_in);
-		romReg[romReg_de + 1] = fgetc(fp_in);
+		romReg[romReg_de] = snapByte(s);
+		romReg[romReg_de + 1] = snapByte(s);
 		//	$0D  BC
-		romReg[romReg_bc] = fgetc(fp_in);
-		romReg[romReg_bc + 1] = fgetc(fp_in);
+		romReg[romReg_bc] = snapByte(s);
+		romReg[romReg_bc + 1] = snapByte(s);
 		//	$0F  IY
-		romReg[romReg_iy] = fgetc(fp_in);
-		romReg[romReg_iy + 1] = fgetc(fp_in);
+		romReg[romReg_iy] = snapByte(s);
+		romReg[romReg_iy + 1] = snapByte(s);
 		//	$11  IX
-		romReg[romReg_ix] = fgetc(fp_in);
-		romReg[romReg_ix + 1] = fgetc(fp_in);
+		romReg[romReg_ix] = snapByte(s);
+		romReg[romReg_ix + 1] = snapByte(s);
 		//	$13  0 for DI otherwise EI
-		c = fgetc(fp_in);
+		c = snapByte(s);
 		if (c == 0) pcReg[pcReg_ei] = 0xf3;	//di
 		else pcReg[pcReg_ei] = 0xfb;	//ei
 		//	$14  R
-		romReg[romReg_r] = fgetc(fp_in);
+		romReg[romReg_r] = snapByte(s);
 		//	$15  F
-		romReg[romReg_f] = fgetc(fp_in);
+		romReg[romReg_f] = snapByte(s);
 		//	$16  A
-		pcReg[pcReg_a] = fgetc(fp_in);
+		pcReg[pcReg_a] = snapByte(s);
 		//	$17  SP
-		romReg[romReg_sp] = fgetc(fp_in);
-		romReg[romReg_sp + 1] = fgetc(fp_in);
+		romReg[romReg_sp] = snapByte(s);
+		romReg[romReg_sp + 1] = snapByte(s);
 		if (!otek) {
 			if (romReg[romReg_sp] > 253) {
 				romReg[romReg_sp + 1]++;
@@ -204,40 +1003,40 @@ int main(int argc, char* argv[]) {
 			}
 		}
 		// $19  Interrupt mode IM(0, 1 or 2)
-		c = fgetc(fp_in) & 3;
+		c = snapByte(s) & 3;
 		if (c == 0) pcReg[pcReg_im] = 0x46; //im 0
 		else if (c == 1) pcReg[pcReg_im] = 0x56; //im 1
 		else pcReg[pcReg_im] = 0x5e; //im 2
 		//	$1A  Border colour
-		c = fgetc(fp_in) & 7;
+		c = snapByte(s) & 7;
 		romReg[romReg_brd] = c + 0x30;
 	}
 	// read z80
 	else {
 		//read in z80 starting with header
 		//	0       1       A register
-		pcReg[pcReg_a] = fgetc(fp_in);
+		pcReg[pcReg_a] = snapByte(s);
 		//	1       1       F register
-		romReg[romReg_f] = fgetc(fp_in);
+		romReg[romReg_f] = snapByte(s);
 		//	2       2       BC register pair(LSB, i.e. C first)
-		romReg[romReg_bc] = fgetc(fp_in);
-		romReg[romReg_bc + 1] = fgetc(fp_in);
+		romReg[romReg_bc] = snapByte(s);
+		romReg[romReg_bc + 1] = snapByte(s);
 		//	4       2       HL register pair
-		romReg[romReg_hl] = fgetc(fp_in);
-		romReg[romReg_hl + 1] = fgetc(fp_in);
+		romReg[romReg_hl] = snapByte(s);
+		romReg[romReg_hl + 1] = snapByte(s);
 		//	6       2       Program counter (if zero then version 2 or 3 snapshot)
-		pcReg[pcReg_jp] = fgetc(fp_in);
-		pcReg[pcReg_jp + 1] = fgetc(fp_in);
+		pcReg[pcReg_jp] = snapByte(s);
+		pcReg[pcReg_jp + 1] = snapByte(s);
 		//	8       2       Stack pointer
-		romReg[romReg_sp] = fgetc(fp_in);
-		romReg[romReg_sp + 1] = fgetc(fp_in);
+		romReg[romReg_sp] = snapByte(s);
+		romReg[romReg_sp + 1] = snapByte(s);
 		//	10      1       Interrupt register
-		romReg_i = fgetc(fp_in);
+		*romReg_i = snapByte(s);
 		//	11      1       Refresh register (Bit 7 is not significant!)
-		c = fgetc(fp_in);
+		c = snapByte(s);
 		romReg[romReg_r] = c;
 		//	12      1       Bit 0: Bit 7 of r register; Bit 1-3: Border colour; Bit 4=1: SamROM; Bit 5=1:v1 Compressed; Bit 6-7: N/A
-		c = fgetc(fp_in);
+		c = snapByte(s);
 		compressed = (c & 32) >> 5;	// 1 compressed, 0 not
 		if (c & 1 || c > 127) {
 			romReg[romReg_r] = romReg[romReg_r] | 128;	// r high bit set
@@ -247,61 +1046,61 @@ int main(int argc, char* argv[]) {
 		}
 		romReg[romReg_brd] = ((c & 14) >> 1) + 0x30; //border
 		//	13      2       DE register pair
-		romReg[romReg_de] = fgetc(fp_in);
-		romReg[romReg_de + 1] = fgetc(fp_in);
+		romReg[romReg_de] = snapByte(s);
+		romReg[romReg_de + 1] = snapByte(s);
 		//	15      2       BC' register pair
-		romReg[romReg_bca] = fgetc(fp_in);
-		romReg[romReg_bca + 1] = fgetc(fp_in);
+		romReg[romReg_bca] = snapByte(s);
+		romReg[romReg_bca + 1] = snapByte(s);
 		//	17      2       DE' register pair
-		romReg[romReg_dea] = fgetc(fp_in);
-		romReg[romReg_dea + 1] = fgetc(fp_in);
+		romReg[romReg_dea] = snapByte(s);
+		romReg[romReg_dea + 1] = snapByte(s);
 		//	19      2       HL' register pair
-		romReg[romReg_hla] = fgetc(fp_in);
-		romReg[romReg_hla + 1] = fgetc(fp_in);
+		romReg[romReg_hla] = snapByte(s);
+		romReg[romReg_hla + 1] = snapByte(s);
 		//	21      1       A' register
-		romReg[romReg_afa + 1] = fgetc(fp_in);
+		romReg[romReg_afa + 1] = snapByte(s);
 		//	22      1       F' register
-		romReg[romReg_afa] = fgetc(fp_in);
+		romReg[romReg_afa] = snapByte(s);
 		//	23      2       IY register (Again LSB first)
-		romReg[romReg_iy] = fgetc(fp_in);
-		romReg[romReg_iy + 1] = fgetc(fp_in);
+		romReg[romReg_iy] = snapByte(s);
+		romReg[romReg_iy + 1] = snapByte(s);
 		//	25      2       IX register
-		romReg[romReg_ix] = fgetc(fp_in);
-		romReg[romReg_ix + 1] = fgetc(fp_in);
+		romReg[romReg_ix] = snapByte(s);
+		romReg[romReg_ix + 1] = snapByte(s);
 		//	27      1       Interrupt flipflop, 0 = DI, otherwise EI
-		c = fgetc(fp_in);
+		c = snapByte(s);
 		if (c == 0) pcReg[pcReg_ei] = 0xf3;	//di
 		else pcReg[pcReg_ei] = 0xfb;	//ei
 		//	28      1       IFF2 [IGNORED]
-		c = fgetc(fp_in);
+		c = snapByte(s);
 		//	29      1       Bit 0-1: IM(0, 1 or 2); Bit 2-7: N/A
-		c = fgetc(fp_in) & 3;
+		c = snapByte(s) & 3;
 		if (c == 0) pcReg[pcReg_im] = 0x46; //im 0
 		else if (c == 1) pcReg[pcReg_im] = 0x56; //im 1
 		else pcReg[pcReg_im] = 0x5e; //im 2
 		// version 2 & 3 only
 		if (pcReg[pcReg_jp] == 0 && pcReg[pcReg_jp + 1] == 0) {
 			//  30      2       Length of additional header block
-			addlen.r[0] = fgetc(fp_in);
-			addlen.r[1] = fgetc(fp_in);
+			addlen.r[0] = snapByte(s);
+			addlen.r[1] = snapByte(s);
 			//  32      2       Program counter
-			pcReg[pcReg_jp] = fgetc(fp_in);
-			pcReg[pcReg_jp + 1] = fgetc(fp_in);
+			pcReg[pcReg_jp] = snapByte(s);
+			pcReg[pcReg_jp + 1] = snapByte(s);
 			//	34      1       Hardware mode standard 0-6 (2 is SamRAM), 7 +3, 8 +3 & 10 not supported, 11 Didatik, 12 +2, 13 +2A
-			c = fgetc(fp_in);
+			c = snapByte(s);
 			if (c == 2 || c == 10 || c == 11 || c > 13) error(4);
 			if (addlen.rrrr == 23 && c > 2) otek = 1; // v2 & c>2 then 128k, if v3 then c>3 is 128k
 			else if (c > 3) otek = 1;
 			//	35      1       If in 128 mode, contains last OUT to 0x7ffd
-			c = fgetc(fp_in);
+			c = snapByte(s);
 			if (otek) romReg[romReg_out] = c;
 			//	36      1       Contains 0xff if Interface I rom paged [SKIPPED]
 			//	37      1       Hardware Modify Byte [SKIPPED]
-			fseek(fp_in, 2, SEEK_CUR);
+			snapSkip(s, 2);
 			//	38      1       Last OUT to port 0xfffd (soundchip register number)
 			//	39      16      Contents of the sound chip registers
-			romReg[romReg_fffd] = fgetc(fp_in);	// last out to $fffd (38)
-			for (i = 0; i < 16; i++) romReg[romReg_ay + i] = fgetc(fp_in); // ay registers (39-54) 
+			romReg[romReg_fffd] = snapByte(s);	// last out to $fffd (38)
+			for (i = 0; i < 16; i++) romReg[romReg_ay + i] = snapByte(s); // ay registers (39-54) 
 			// following is only in v3 snapshots
 			//	55      2       Low T state counter [SKIPPED]
 			//	57      1       Hi T state counter [SKIPPED]
@@ -315,10 +1114,11 @@ int main(int argc, char* argv[]) {
 			//	83      1       MGT type : 0 = Disciple + Epson, 1 = Disciple + HP, 16 = Plus D [SKIPPED]
 			//	84      1       Disciple inhibit button status : 0 = out, 0ff = in [SKIPPED]
 			//	85      1       Disciple inhibit flag : 0 = rom pageable, 0ff = not [SKIPPED]
-			if (addlen.rrrr > 23) fseek(fp_in, 31, SEEK_CUR);
+			if (addlen.rrrr > 23) snapSkip(s, 31);
 			// only if version 3 & 55 additional length
 			//	86      1       Last OUT to port 0x1ffd, ignored as only applicable on +3/+2A machines [SKIPPED]
-			if (addlen.rrrr == 55) 	if ((fgetc(fp_in) & 1) == 1) error(5); //special page mode so exit as not compatible with earlier 128k machines
+			if (addlen.rrrr == 55) 	if ((snapByte(s) & 1) == 1) error(5); //special page mode so exit as not compatible with earlier 128k machines
+			s->pos = 32 + addlen.rrrr; // memory blocks start after the additional header, whatever its length
 		}
 	}
 	// space for decompression of z80
@@ -330,8 +1130,9 @@ int main(int argc, char* argv[]) {
 		fullsize = 131072;
 	}
 	//
-	uint8_t* main;
-	if ((main = (uint8_t*)malloc(fullsize * sizeof(uint8_t))) == NULL) error(6); // cannot create space for decompressed z80 
+	uint8_t* mem;
+	if ((mem = (uint8_t*)calloc(fullsize, sizeof(uint8_t))) == NULL) error(6); // cannot create space for decompressed z80 
+	*out = mem;
 	//
 	rrrr len;
 	len.rrrr = 0;
@@ -357,26 +1158,27 @@ int main(int argc, char* argv[]) {
 	}
 	if (addlen.rrrr == 0) { // SNA or version 1 z80 snapshot & 48k only
 		if (!compressed) {
-			if (fread(main, sizeof(uint8_t), 49152, fp_in) != 49152) error(7);
-			// sort out pc for SNA
-			if (snap) {
+			snapBlock(s, mem, 49152);
+			// sort out pc for 48k SNA, 128k has it after the memory
+			if (sna && !otek) {
 				uint32_t stackpos = romReg[romReg_sp] + romReg[romReg_sp + 1] * 256;
 				if (stackpos == 0) stackpos = 65536;
-				pcReg[pcReg_jp] = main[stackpos - 16384 - 2];
-				pcReg[pcReg_jp + 1] = main[stackpos - 16384 - 1];
+				if (stackpos < 16386) error(7); // pc would be in ROM
+				pcReg[pcReg_jp] = mem[stackpos - 16384 - 2];
+				pcReg[pcReg_jp + 1] = mem[stackpos - 16384 - 1];
 			}
 		}
 		else {
-			if (dcz80(&fp_in, main, 49152) != 49152) error(7);
+			if (dcz80(s, mem, 49152) != 49152) error(7);
 		}
 		if (otek) {
 			// PC
-			pcReg[pcReg_jp] = fgetc(fp_in);
-			pcReg[pcReg_jp + 1] = fgetc(fp_in);
+			pcReg[pcReg_jp] = snapByte(s);
+			pcReg[pcReg_jp + 1] = snapByte(s);
 			// last out to 0x7ffd
-			romReg[romReg_out] = fgetc(fp_in);
+			romReg[romReg_out] = snapByte(s);
 			// TD-DOS
-			if (fgetc(fp_in) != 0) error(7);
+			if (snapByte(s) != 0) error(7);
 			uint32_t pagelayout[7];
 			for (i = 0; i < 7; i++) pagelayout[i] = 99;
 			pagelayout[0] = romReg[romReg_out] & 7;
@@ -448,11 +1250,11 @@ int main(int argc, char* argv[]) {
 				pagelayout[5] = 98304;
 			}
 			if (pagelayout[0] != 32768) {
-				for (i = 0; i < 16384; i++) main[pagelayout[0] + i] = main[32768 + i]; //copy 0->?
+				for (i = 0; i < 16384; i++) mem[pagelayout[0] + i] = mem[32768 + i]; //copy 0->?
 			}
 			for (i = 1; i < 7; i++) {
 				if (pagelayout[i] != 99) {
-					if (fread(&main[pagelayout[i]], sizeof(uint8_t), 16384, fp_in) != 16384) error(7);
+					snapBlock(s, &mem[pagelayout[i]], 16384);
 				}
 			}
 		}
@@ -469,224 +1271,111 @@ int main(int argc, char* argv[]) {
 		//		only 4, 5 & 8 are valid for this usage, all others are just ignored
 		// for 128k snapshots the order is:
 		//		0 ROM, 1 ROM, 3 Page 0....10 page 7, 11 MF ROM.
-		// all pages are saved and there is no end marker
+		// all pages are saved and there is no end marker, so carry on until every page wanted
+		// is in or the file runs out. Anything else is stepped over using its length
+		uint32_t end;
 		do {
-			len.r[0] = fgetc(fp_in);
-			len.r[1] = fgetc(fp_in);
-			c = fgetc(fp_in);
-			if (bank[c] != 99) {
+			len.r[0] = snapByte(s);
+			len.r[1] = snapByte(s);
+			c = snapByte(s);
+			if (len.rrrr == 65535) end = s->pos + 16384;
+			else end = s->pos + len.rrrr;
+			if (end > s->len) error(7);
+			if (c < 11 && bank[c] != 99) {
 				if (len.rrrr == 65535) {
-					if (fread(&main[bank[c]], sizeof(uint8_t), 16384, fp_in) != 16384) error(7);
+					snapBlock(s, &mem[bank[c]], 16384);
 				}
 				else {
-					if (dcz80(&fp_in, &main[bank[c]], 16384) != 16384) error(7);
+					if (dcz80(s, &mem[bank[c]], 16384) != 16384 || s->pos > end) error(7);
 				}
+				bank[c] = 99; // only once
+				bankend--;
 			}
-			bankend--;
-		} while (bankend);
-	}
-	fclose(fp_in);
-	//
-	//              12345678901234567890123456789012345678901234567890123456789012345678901234567890
-	//						 1         2         3         4         5         6         7         8
-	fprintf(stdout,"  /----------------------------------------------------------------------------\\\n");
-	fprintf(stdout," /|af$%02x%02x af'$%02x%02x hl$%02x%02x hl'$%02x%02x bc$%02x%02x bc'$%02x%02x de$%02x%02x de'$%02x%02x ix$%02x%02x |\n",
-		pcReg[pcReg_a],romReg[romReg_f],romReg[romReg_afa+1],romReg[romReg_afa],
-		romReg[romReg_hl+1],romReg[romReg_hl],romReg[romReg_hla+1],romReg[romReg_hla],
-		romReg[romReg_bc+1],romReg[romReg_bc],romReg[romReg_bca+1],romReg[romReg_bca],
-		romReg[romReg_de+1],romReg[romReg_de],romReg[romReg_dea+1],romReg[romReg_dea],
-		romReg[romReg_ix+1],romReg[romReg_ix]);
-	fprintf(stdout,"/ |iy$%02x%02x brd$%02x ",romReg[romReg_iy+1],romReg[romReg_iy],romReg[romReg_brd]);
-	if (pcReg[pcReg_ei] == 0xf3) fprintf(stdout,"di ");	//di
-	else fprintf(stdout,"ei ");	//ei
-	if (pcReg[pcReg_im] == 0x46) fprintf(stdout,"im0 "); //im 0
-	else if (pcReg[pcReg_im] == 0x56) fprintf(stdout,"im1 "); //im 1
-	else fprintf(stdout,"im2 "); // im 2
-	fprintf(stdout,"ir$%02x%02x pc$%02x%02x sp$%02x%02x ",romReg_i,romReg[romReg_r],pcReg[pcReg_jp + 1],pcReg[pcReg_jp],romReg[romReg_sp+1],romReg[romReg_sp]);
-	if(romReg[romReg_r]<9) romReg[romReg_r]+=119;
-	else romReg[romReg_r] -= 9; // so it is correct on launch
-	// where to put the final loader?
-	uint16_t stackPos = (romReg[romReg_sp + 1] * 256) + romReg[romReg_sp];
-	uint16_t pcPos = (pcReg[pcReg_jp + 1] * 256) + pcReg[pcReg_jp];
-	//fprintf(stdout,"%d %d gap:%d\n",stackPos,pcPos,stackPos-pcPos);
-	if ((stackPos>pcPos&&(stackPos-pcPos<32))||forceScreen==1) {
-		if(stackPos<16384&&stackPos>=(16384-pcReg_len)) {
-			fprintf(stdout, "(Final Loader in Screen @%04x)|\n", 0x4000);
-			for (i = 0; i < pcReg_len; i++) {
-				main[i] = pcReg[i];
-			}
-			romReg[romReg_jp + 1] = 0x40;
-			romReg[romReg_jp] = 0x00;			
-		}
-		else {
-			fprintf(stdout, "(Final Loader in Screen @%04x)|\n", 0x5800-pcReg_len);
-			for (i = 0; i < pcReg_len; i++) {
-				main[(6144-pcReg_len) + i] = pcReg[i];
-			}
-			romReg[romReg_jp + 1] = 0x57;
-			romReg[romReg_jp] = 0x100-pcReg_len;
-		}
-	}
-	else {
-		stackPos -= pcReg_len;
-		fprintf(stdout, "(Final Loader in Stack @%04x) |\n", stackPos);
-		for (i = 0; i < pcReg_len; i++) {
-			main[stackPos - 16384 + i] = pcReg[i];
-		}
-		romReg[romReg_jp + 1] = stackPos / 256;
-		romReg[romReg_jp] = stackPos - (romReg[romReg_jp] * 256);
-	}
-	if(otek) {
-		fprintf(stdout,"  |128k -> 7ffd$%02x fffd$%02x ay",romReg[romReg_out],romReg[romReg_fffd]);
-		for(i=0;i<16;i++) fprintf(stdout,"$%02x",romReg[romReg_ay+i]);
-		fprintf(stdout,"  |\n");
-	}
-	fprintf(stdout,"  |----------------------------------------------------------------------------|\n");
-	//              12345678901234567890123456789012345678901234567890123456789012345678901234567890
-	//						 1         2         3         4         5         6         7         8
-	//
-	// compress every page and write out with
-	uint8_t* store;
-	uint32_t size = 49152;
-	int banks = 3;
-	if (otek) {
-		banks = 8;
-		size = 131072;
-		romReg[romReg_bnks] = 0x10;
-		romReg[romReg_bnks + 1] = 0x11;
-	}
-	romReg[romReg_ffff] = main[size - 2];
-	romReg[romReg_ffff + 1] = main[size - 1];
-	//
-	rrrr cmsize;
-	if ((store = (uint8_t*)malloc(size * sizeof(uint8_t))) == NULL) error(6);
-	for (i = 0; i < size; i++) store[i] = 0x00; // clear store
-	for (i = 0; i < romReg_len; i++) store[i] = romReg[i]; // copy in the loader
-	cmsize.rrrr = simplelz(main, &store[romReg_len], 16384);
-	fprintf(stdout, "  |ROM 0   (16384- 32767) Compressing Bank 5 (%5dbytes) + Loader (%3dbytes)  |\n", cmsize.rrrr, romReg_len);
-	if (cmsize.rrrr >= (16384 - (romReg_len+1))) error(11);
-	store[0x3fff]=romReg_i; // put i at end of ROM
-	//
-	fprintf(stdout, "  |ROM 1,2 (32768- 65535) Copying Banks 2 & 0                                  |\n");
-	if (otek) fprintf(stdout, "  |ROM 3-7 (65536-131071) Copying Banks 1,3,4,6 & 7                            |\n");
-	fprintf(stdout,"\\ |----------------------------------------------------------------------------|\n");
-	for (i = 1; i < banks; i++) {
-		for (int k = 0; k < 16384; k++) store[16384 * i + k] = main[16384 * i + k];
-	}
-	free(main);
-	// if required produce the binary files, 16384bytes each
-	strcat(fROM, ".0");
-	if (produceBinary == 1) {
-		for (i = 0; i < banks; i++) {
-			if ((fp_out = fopen(fROM, "wb")) == NULL) error(3); // cannot open file for write	
-			if (fwrite(&store[i * 16384], sizeof(uint8_t), 16384, fp_out) != 16384) error(7);
-			fclose(fp_out);
-			fROM[strlen(fROM) - 1]++;
-		}
-	}
-	// compress the ROM ready for use on the interface
-	uint8_t* comp;
-	if ((comp = (uint8_t*)malloc(size * sizeof(uint8_t))) == NULL) error(6);
-	cmsize.rrrr = simplelz(store, comp, size);
-	fprintf(stdout, " \\|Full ROM Compressed to %5dbytes (%4.1f%% saving)                            |\n", cmsize.rrrr,(((double)fullsize-(double)cmsize.rrrr)/(double)fullsize)*100);
-	fprintf(stdout,"  \\----------------------------------------------------------------------------/\n");
-	free(store);
-	// create ROM name
-	char outName[33],headerName[33];
-
-	//char headerName[256];
-	//char outName[33];
-	i=0;
-	unsigned int j=0;
-	if((fZ80[j]>='0'&&fZ80[j]<='9')) {
-		headerName[j]='_';	// starts with a number
-		j++;
+			s->pos = end;
+		} while (bankend && s->pos < s->len);
+		if (bankend) error(7); // ran out before every page was in
 	}
-	do {
-		outName[i]=fZ80[i];
-		if(j<32) {
-			if(fZ80[i]>='A'&&fZ80[i]<='Z') {
-				headerName[j++]=fZ80[i]+32;
-			} else if((fZ80[i]>='0'&&fZ80[i]<='9')||
-					(fZ80[i]>='a'&&fZ80[i]<='z')) {
-				headerName[j++]=fZ80[i];
-			} else {
-				headerName[j++]='_';
-			}
-		}
-		i++;
-	} while(i<32&&(fZ80[i]!='.'||i<strlen(fZ80)-4));
-	outName[i]=headerName[j]='\0';
-	fROM[strlen(fROM)-1] = 'h';
-	if ((fp_out = fopen(fROM, "wb")) == NULL) error(3); // cannot open rom for write	
-	//
-	fprintf(fp_out,"// ,%s",headerName);
-	for(i=strlen(headerName);i<35;i++) fprintf(fp_out," ");
-	fprintf(fp_out,"// xx - %dbytes\n",cmsize.rrrr+34);
-	if(command<argc-1) {
-		printOut(fp_out, comp, cmsize.rrrr, headerName,otek,argv[argc-1]);
-	} else {
-		printOut(fp_out, comp, cmsize.rrrr, headerName,otek,outName);
-	}	
-	//
-	fclose(fp_out);
-	free(comp);
-	// all done
-	return 0;
+	return otek;
 }
 
 //
 // ---------------------------------------------------------------------------
-// printOut - print out the binary in a standard header format
+// snapBench - load, parse & compress every snapshot given without writing
+// anything, then print how many files a second each step manages. Loading &
+// parsing is repeated as on its own it is too quick for the clock. A broken
+// snapshot is shown with its error & left out of the totals, ending in E12
 // ---------------------------------------------------------------------------
-void printOut(FILE* fp, uint8_t* buffer, uint32_t filesize, char* name,uint8_t cm,char *oname) {
-	uint32_t i, j;
-	fprintf(fp, "    const uint8_t %s[]={ ", name);
-	//
-	if(cm) fprintf(fp,"0x08,");	// 128k
-	else fprintf(fp,"0x03,");	// 48k
-	fprintf(fp,"0x00,");	// spare
-	j=0;
-	do {
-		if(j<strlen(oname)) fprintf(fp,"0x%02x,",oname[j]); 
-		else fprintf(fp,"0x00,"); 
-	} while(++j<32);
-	fprintf(fp,"\n");
-	for(j=0;j<23+strlen(name);j++) fprintf(fp," ");   
-	//
-	for (i = 0; i < filesize; i++) {
-		if ((i % 32) == 0 && i != 0) {
-			fprintf(fp, "\n");
-			for (j = 0; j < 23 + strlen(name); j++) fprintf(fp, " ");
+#define snapBench_reps 100
+void snapBench(int files, char* fname[]) {
+	uint8_t romReg[romReg_len], pcReg[pcReg_len], romReg_i;
+	uint8_t* comp;
+	static uint8_t* mem;	// static so they are still right after a longjmp
+	static snap_t s;
+	int i, j, otek, err, failed = 0;
+	uint32_t cmsize;
+	clock_t start, parse, pack;
+	double tParse = 0, tPack = 0;
+	jmp_buf trap;
+	if (files < 1) error(1);
+	if ((comp = (uint8_t*)malloc(16384 + 16384 / 64)) == NULL) error(6);
+	fprintf(stdout, "  snapshot                          load+parse    compress       size\n");
+	for (i = 0; i < files; i++) {
+		s.buf = mem = NULL;
+		errorTrap = &trap;
+		if ((err = setjmp(trap)) != 0) {
+			errorTrap = NULL;
+			free(s.buf);
+			free(mem);
+			failed++;
+			fprintf(stdout, "  %-32.32s [E%02d]\n", fname[i], err);
+			continue;
 		}
-		fprintf(fp, "0x%02x", buffer[i]);
-		if (i < filesize - 1) {
-			fprintf(fp, ",");
+		if (!isSnapshot(fname[i])) error(1);
+		start = clock();
+		for (j = 0; j < snapBench_reps; j++) {
+			snapLoad(&s, fname[i]);
+			otek = snapParse(&s, isSNA(fname[i]), romReg, pcReg, &romReg_i, &mem);
+			free(s.buf);
+			s.buf = NULL;
+			if (j < snapBench_reps - 1) {
+				free(mem);
+				mem = NULL;
+			}
 		}
+		errorTrap = NULL;
+		parse = clock();
+		cmsize = 0;
+		for (j = 0; j < (otek ? 8 : 3); j++) cmsize += simplelz(&mem[j * 16384], comp, 16384);
+		pack = clock();
+		free(mem);
+		tParse += (double)(parse - start) / CLOCKS_PER_SEC / snapBench_reps;
+		tPack += (double)(pack - parse) / CLOCKS_PER_SEC;
+		fprintf(stdout, "  %-32.32s %8.3fms %9.1fms %4s %6dbytes\n", fname[i],
+			(double)(parse - start) * 1000 / CLOCKS_PER_SEC / snapBench_reps,
+			(double)(pack - parse) * 1000 / CLOCKS_PER_SEC, otek ? "128k" : "48k", cmsize);
 	}
-	fprintf(fp, " };\n");
+	free(comp);
+	files -= failed;
+	fprintf(stdout, "  %d snapshots, load+parse %.1f files/s, with compression %.1f files/s, %d failed\n", files,
+		tParse > 0 ? files / tParse : 0.0, tParse + tPack > 0 ? files / (tParse + tPack) : 0.0, failed);
+	if (failed) error(12);
 }
 
 //
 // ---------------------------------------------------------------------------
 // dcz80 - decompress z80 snapshot routine
 // ---------------------------------------------------------------------------
-uint16_t dcz80(FILE** fp_in, uint8_t* out, uint16_t size) {
-	uint16_t i = 0, k, j;
+uint16_t dcz80(snap_t* s, uint8_t* out, uint16_t size) {
+	uint32_t i = 0, k, j;
 	uint8_t c;
 	while (i < size) {
-		c = fgetc(*fp_in);
-		if (c == 0xed) { // is it 0xed [0]
-			c = fgetc(*fp_in); // get next
-			if (c == 0xed) { // is 2nd 0xed then a sequence
-				j = fgetc(*fp_in); // counter into j
-				c = fgetc(*fp_in);
-				for (k = 0; k < j; k++) out[i++] = c;
-			}
-			else {
-				out[i++] = 0xed;
-				fseek(*fp_in, -1, SEEK_CUR); // back one
-			}
+		c = snapByte(s);
+		if (c == 0xed && s->pos < s->len && s->buf[s->pos] == 0xed) { // 0xed 0xed is a sequence
+			s->pos++;
+			j = snapByte(s); // counter into j
+			c = snapByte(s);
+			if (j > size - i) error(7); // would run past the page
+			for (k = 0; k < j; k++) out[i++] = c;
 		}
 		else {
 			out[i++] = c; // just copy
@@ -719,7 +1408,7 @@ uint32_t simplelz(uint8_t* fload, uint8_t* store, uint32_t filesize) {
 		if (i > 255) offset = i - 256; else offset = 0;
 		do {
 			repsize = 0;
-			while (fload[offset + repsize] == fload[i + repsize] && i + repsize < filesize && repsize < 129) {
+			while (i + repsize < filesize && fload[offset + repsize] == fload[i + repsize] && repsize < 129) {
 				repsize++;
 			}
 			if (repsize > repmax) {
@@ -758,6 +1447,7 @@ uint32_t simplelz(uint8_t* fload, uint8_t* store, uint32_t filesize) {
 }
 
 void error(uint8_t errorcode) {
+	if (errorTrap != NULL) longjmp(*errorTrap, errorcode);
 	fprintf(stdout, "[E%02d]\n", errorcode);
 	exit(errorcode);
 }